@@ -7,6 +7,7 @@
 #ifndef ZEPHYR_INCLUDE_INIT_H_
 #define ZEPHYR_INCLUDE_INIT_H_
 
+#include <stdbool.h>
 #include <stdint.h>
 #include <stddef.h>
 
@@ -113,6 +114,13 @@ struct init_entry {
 		struct device *dev_rw;
 #endif
 	};
+#if defined(CONFIG_INIT_PROFILING) || defined(__DOXYGEN__)
+	/**
+	 * Name of a SYS_INIT() entry, NULL for device init entries. Only
+	 * available with @kconfig{CONFIG_INIT_PROFILING}.
+	 */
+	const char *name;
+#endif
 };
 
 /** @cond INTERNAL_HIDDEN */
@@ -184,6 +192,12 @@ struct init_entry {
 
 #endif
 
+#ifdef CONFIG_INIT_PROFILING
+#define Z_INIT_SYS_INIT_NAME(init_id) , .name = STRINGIFY(init_id)
+#else
+#define Z_INIT_SYS_INIT_NAME(init_id)
+#endif
+
 /** @endcond */
 
 /**
@@ -239,7 +253,82 @@ struct init_entry {
 	static const Z_DECL_ALIGN(struct init_entry)                                      \
 		Z_INIT_ENTRY_SECTION(level, prio, 0) __used __noasan                      \
 		Z_INIT_ENTRY_NAME(name) = {.init_fn = {.sys = (init_fn_)},                \
-			Z_INIT_SYS_INIT_DEV_NULL}
+			Z_INIT_SYS_INIT_DEV_NULL Z_INIT_SYS_INIT_NAME(name)}
+
+#if defined(CONFIG_INIT_PROFILING) || defined(__DOXYGEN__)
+
+/**
+ * @brief Measured run of an init entry.
+ *
+ * Only available with @kconfig{CONFIG_INIT_PROFILING}.
+ */
+struct sys_init_profile {
+	/** Init entry. */
+	const struct init_entry *entry;
+	/** Name of the device or of the SYS_INIT() entry. */
+	const char *name;
+	/** Time taken by the init function, in nanoseconds, 0 if not measured. */
+	uint64_t duration_ns;
+	/**
+	 * Value returned by the init function, or for a device, the error
+	 * code recorded as its init result.
+	 */
+	int result;
+	/** Init level ordinal, see INIT_LEVEL_ORD(). */
+	int level;
+	/**
+	 * Whether the init function was measured. The timing functions are
+	 * only started after the PRE_KERNEL_2 level, so init entries of
+	 * earlier levels are not.
+	 */
+	bool measured;
+};
+
+/**
+ * @brief Callback for iterating over measured init entries.
+ *
+ * @param profile Measured run of an init entry.
+ * @param user_data User data passed to the iterating function.
+ *
+ * @retval true To continue iterating.
+ * @retval false To stop iterating.
+ */
+typedef bool (*sys_init_profile_cb_t)(const struct sys_init_profile *profile,
+				      void *user_data);
+
+/**
+ * @brief Iterate over the recorded init entries, in init order.
+ *
+ * Init entries that have not run yet, or that did not fit in
+ * @kconfig{CONFIG_INIT_PROFILING_MAX_ENTRIES}, are skipped. Init entries
+ * which were not measured are included, see sys_init_profile::measured.
+ *
+ * @param cb Callback invoked for each recorded init entry.
+ * @param user_data User data passed to @p cb.
+ */
+void sys_init_profile_foreach(sys_init_profile_cb_t cb, void *user_data);
+
+/**
+ * @brief Iterate over the measured init entries, slowest first.
+ *
+ * Init entries taking the same time are ranked in init order. Init
+ * entries which were not measured are skipped.
+ *
+ * @param cb Callback invoked for each measured init entry.
+ * @param user_data User data passed to @p cb.
+ */
+void sys_init_profile_foreach_ranked(sys_init_profile_cb_t cb, void *user_data);
+
+/**
+ * @brief Get the name of an init level.
+ *
+ * @param level Init level ordinal, see INIT_LEVEL_ORD().
+ *
+ * @return Init level name, e.g. "POST_KERNEL", or "unknown".
+ */
+const char *sys_init_level_name(int level);
+
+#endif /* CONFIG_INIT_PROFILING */
 
 /** @} */
 
@@ -1572,6 +1572,19 @@ struct k_timer {
 	/* user-specific data, also used to support legacy features */
 	void *user_data;
 
+#ifdef CONFIG_TIMER_CPU_EXPIRY
+	/* queued on its CPU after expiring on another one */
+	sys_snode_t cpu_node;
+
+	/* CPU the expiry function runs on */
+	uint8_t cpu;
+
+	/* CPU set with k_timer_cpu_set() plus one, 0 if none */
+	uint8_t cpu_pin;
+
+	bool cpu_queued;
+#endif
+
 	SYS_PORT_TRACING_TRACKING_FIELD(k_timer)
 
 #ifdef CONFIG_OBJ_CORE_TIMER
@@ -1659,6 +1672,27 @@ void k_timer_init(struct k_timer *timer,
 			 k_timer_expiry_t expiry_fn,
 			 k_timer_stop_t stop_fn);
 
+#if defined(CONFIG_TIMER_CPU_EXPIRY) || defined(__DOXYGEN__)
+/**
+ * @brief Bind the expiry function of a timer to a CPU.
+ *
+ * By default the expiry function of a timer, and the wakeup of a thread
+ * waiting in k_timer_status_sync(), run on the CPU that last started the
+ * timer. This routine selects a fixed CPU instead. It takes effect the
+ * next time the timer is started.
+ *
+ * @note @kconfig{CONFIG_TIMER_CPU_EXPIRY} must be selected for this
+ * function to be available.
+ *
+ * @param timer Address of timer.
+ * @param cpu   CPU index, or -1 for the CPU that starts the timer.
+ *
+ * @retval 0 on success.
+ * @retval -EINVAL if @a cpu is not a valid CPU index.
+ */
+int k_timer_cpu_set(struct k_timer *timer, int cpu);
+#endif
+
 /**
  * @brief Start a timer.
  *
@@ -2310,6 +2344,34 @@ __syscall int k_futex_wait(struct k_futex *futex, int expected,
  */
 __syscall int k_futex_wake(struct k_futex *futex, bool wake_all);
 
+/**
+ * @brief Wake threads pending on a futex and move others to another futex
+ *
+ * Wakes up to @a nr_wake of the highest priority threads pending on
+ * @a futex, and moves up to @a nr_requeue of the remaining ones to
+ * @a target, where they keep pending as if they had called k_futex_wait()
+ * on it, with the same timeout. A condition variable broadcast can wake a
+ * single waiter and move the others to the futex of the mutex they will
+ * need next, instead of waking them all to contend on it.
+ *
+ * Nothing is done if @a futex does not contain the expected value, as
+ * threads about to pend on it may then have missed the change to it.
+ *
+ * @param futex Futex to wake up and move pending threads from.
+ * @param target Futex to move pending threads to.
+ * @param expected Expected value of @a futex.
+ * @param nr_wake Maximum number of threads to wake up.
+ * @param nr_requeue Maximum number of threads to move to @a target.
+ * @retval -EACCES Caller does not have access to one of the futex addresses.
+ * @retval -EAGAIN If the futex value did not match the expected parameter.
+ * @retval -EINVAL Futex parameter addresses not recognized by the kernel,
+ *                 or identical.
+ * @retval Number of threads that were woken up or moved.
+ */
+__syscall int k_futex_requeue(struct k_futex *futex, struct k_futex *target,
+			      int expected, unsigned int nr_wake,
+			      unsigned int nr_requeue);
+
 /** @} */
 #endif
 
@@ -3033,6 +3095,11 @@ struct k_mutex {
 	/** Original thread priority */
 	int owner_orig_prio;
 
+#ifdef CONFIG_KERNEL_SYNC_OBJ_LOCKS
+	/** Per-object lock */
+	struct k_spinlock lock;
+#endif
+
 	SYS_PORT_TRACING_TRACKING_FIELD(k_mutex)
 
 #ifdef CONFIG_OBJ_CORE_MUTEX
@@ -3136,6 +3203,10 @@ __syscall int k_mutex_unlock(struct k_mutex *mutex);
 struct k_condvar {
 	_wait_q_t wait_q;
 
+#ifdef CONFIG_KERNEL_SYNC_OBJ_LOCKS
+	struct k_spinlock lock;
+#endif
+
 #ifdef CONFIG_OBJ_CORE_CONDVAR
 	struct k_obj_core  obj_core;
 #endif
@@ -3223,6 +3294,10 @@ struct k_sem {
 	unsigned int count;
 	unsigned int limit;
 
+#ifdef CONFIG_KERNEL_SYNC_OBJ_LOCKS
+	struct k_spinlock lock;
+#endif
+
 	Z_DECL_POLL_EVENT
 
 	SYS_PORT_TRACING_TRACKING_FIELD(k_sem)
@@ -3465,6 +3540,29 @@ int k_work_submit_to_queue(struct k_work_q *queue,
  */
 int k_work_submit(struct k_work *work);
 
+/** @brief Submit a batch of work items to a queue.
+ *
+ * This is equivalent to calling k_work_submit_to_queue() for each
+ * item in turn, but the queue's lock is acquired and the queue thread
+ * is notified once for the whole batch rather than once per item.
+ * This includes items that were never submitted before.  Items that
+ * were last associated with a different queue are submitted
+ * individually.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param queue pointer to the work queue on which the items should run.
+ * @param work array of pointers to the work items.
+ * @param count number of entries in @p work.
+ *
+ * @return the number of items that were newly queued (items that were
+ * already queued, or were rejected because they are cancelling, are not
+ * counted), or a negative error code from k_work_submit_to_queue() if
+ * @p queue does not accept submissions.
+ */
+int k_work_submit_batch_to_queue(struct k_work_q *queue,
+				 struct k_work *const *work, size_t count);
+
 /** @brief Wait for last-submitted instance to complete.
  *
  * Resubmissions may occur while waiting, including chained submissions (from
@@ -4151,6 +4249,21 @@ struct k_work_queue_config {
 	 * essential thread.
 	 */
 	bool essential;
+
+	/** Maximum number of work items to run back to back.
+	 *
+	 * When the work queue thread yields between items (see @ref
+	 * no_yield), it instead yields only after this many items
+	 * have been run in a row, or when no more work is pending.
+	 * Consecutive items are then also taken from the queue under
+	 * the same lock acquisition that completes the previous one.
+	 * Batching improves throughput for queues that receive many
+	 * short work items, at the cost of other threads of the same
+	 * priority waiting longer.
+	 *
+	 * Zero or one (the default) yields after every item.
+	 */
+	uint16_t batch_size;
 };
 
 /** @brief A structure used to hold work until it can be processed. */
@@ -4159,7 +4272,8 @@ struct k_work_q {
 	struct k_thread thread;
 
 	/* All the following fields must be accessed only while the
-	 * work module spinlock is held.
+	 * work module spinlock (or with CONFIG_KERNEL_WORK_QUEUE_LOCKS
+	 * the queue's own lock) is held.
 	 */
 
 	/* List of k_work items to be worked. */
@@ -4173,6 +4287,19 @@ struct k_work_q {
 
 	/* Flags describing queue state. */
 	uint32_t flags;
+
+	/* Items to run before yielding, see k_work_queue_config. */
+	uint16_t batch_size;
+
+#ifdef CONFIG_KERNEL_WORK_QUEUE_LOCKS
+	/* Lock for the queue and the work items associated with it. */
+	struct k_spinlock lock;
+#endif /* CONFIG_KERNEL_WORK_QUEUE_LOCKS */
+
+#ifdef CONFIG_WORK_POOL
+	/* Pool this queue is a worker of, or NULL. */
+	struct k_work_pool *pool;
+#endif /* CONFIG_WORK_POOL */
 };
 
 /* Provide the implementation for inline functions declared above */
@@ -4211,6 +4338,153 @@ static inline k_tid_t k_work_queue_thread_get(struct k_work_q *queue)
 	return &queue->thread;
 }
 
+/** @brief A pool of work queues sharing their work.
+ *
+ * A work queue pool is a set of work queues, the workers, each animated
+ * by its own thread.  Work submitted to the pool is queued to one of the
+ * workers, and workers that run out of work take pending work from the
+ * others, so that the work is processed by as many threads (and on SMP
+ * systems, CPUs) as are available.
+ *
+ * The workers are ordinary work queues: work items submitted to a pool
+ * are standard @ref k_work and @ref k_work_delayable items and can be
+ * flushed, cancelled and queried with the usual API.
+ */
+struct k_work_pool {
+	/* The worker queues. */
+	struct k_work_q *workers;
+
+	/* Stacks of the worker threads, and the size of each. */
+	k_thread_stack_t *stacks;
+	size_t stack_size;
+
+	/* Number of workers. */
+	uint8_t num_workers;
+
+	/* Bitmask of the workers waiting for work. */
+	atomic_t idle;
+};
+
+/**
+ * @brief Statically define a work queue pool.
+ *
+ * The pool still has to be started with k_work_pool_start().
+ *
+ * @param name Name of the pool.
+ * @param nworkers Number of worker threads.
+ * @param size Size of the stack of each worker thread, in bytes.
+ */
+#define K_WORK_POOL_DEFINE(name, nworkers, size)				\
+	static struct k_work_q _CONCAT(z_work_pool_workers_, name)[nworkers];	\
+	static K_THREAD_STACK_ARRAY_DEFINE(_CONCAT(z_work_pool_stacks_, name),	\
+					   nworkers, size);			\
+	struct k_work_pool name = {						\
+		.workers = _CONCAT(z_work_pool_workers_, name),			\
+		.stacks = (k_thread_stack_t *)_CONCAT(z_work_pool_stacks_, name), \
+		.stack_size = (size),						\
+		.num_workers = (nworkers),					\
+	}
+
+/** @brief Initialize a work queue pool.
+ *
+ * Sets up a pool defined at runtime.  Pools defined with @ref
+ * K_WORK_POOL_DEFINE need not be initialized.
+ *
+ * @param pool pointer to the pool structure.
+ *
+ * @param workers array of @p num_workers work queue structures.
+ *
+ * @param stacks array of @p num_workers stacks, defined with
+ * K_THREAD_STACK_ARRAY_DEFINE() and a size of @p stack_size.
+ *
+ * @param num_workers number of worker threads, at most @ref ATOMIC_BITS.
+ *
+ * @param stack_size size of each stack area, in bytes.
+ */
+void k_work_pool_init(struct k_work_pool *pool, struct k_work_q *workers,
+		      k_thread_stack_t *stacks, size_t num_workers,
+		      size_t stack_size);
+
+/** @brief Start the workers of a work queue pool.
+ *
+ * With @kconfig{CONFIG_WORK_POOL_PIN_CPUS} worker @c N is pinned to CPU
+ * @c N modulo the number of CPUs.
+ *
+ * @param pool pointer to the pool structure.
+ *
+ * @param prio initial priority of the worker threads.
+ *
+ * @param cfg optional additional configuration parameters, applied to
+ * every worker.  Pass @c NULL if not required.
+ */
+void k_work_pool_start(struct k_work_pool *pool, int prio,
+		       const struct k_work_queue_config *cfg);
+
+/** @brief Submit a work item to a work queue pool.
+ *
+ * The item is queued to the worker associated with the current CPU, or
+ * when called from one of the pool's workers, to that worker.  If
+ * another worker is idle it is woken to take the item over.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param pool pointer to the pool structure.
+ *
+ * @param work pointer to the work item.
+ *
+ * @return as for k_work_submit_to_queue().
+ */
+int k_work_pool_submit(struct k_work_pool *pool, struct k_work *work);
+
+/** @brief Submit an idle delayable work item to a work queue pool after a
+ * delay.
+ *
+ * The item is queued to a worker selected as for k_work_pool_submit().
+ *
+ * @funcprops \isr_ok
+ *
+ * @param pool pointer to the pool structure.
+ *
+ * @param dwork pointer to the delayable work item.
+ *
+ * @param delay the time to wait before submitting the work item.
+ *
+ * @return as for k_work_schedule_for_queue().
+ */
+int k_work_pool_schedule(struct k_work_pool *pool,
+			 struct k_work_delayable *dwork, k_timeout_t delay);
+
+/** @brief Reschedule a delayable work item to a work queue pool.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param pool pointer to the pool structure.
+ *
+ * @param dwork pointer to the delayable work item.
+ *
+ * @param delay the time to wait before submitting the work item.
+ *
+ * @return as for k_work_reschedule_for_queue().
+ */
+int k_work_pool_reschedule(struct k_work_pool *pool,
+			   struct k_work_delayable *dwork, k_timeout_t delay);
+
+/** @brief Wait until all workers of a work queue pool have drained.
+ *
+ * Drains and plugs every worker in turn, see k_work_queue_drain().
+ * Unless @p plug is true the workers are unplugged again once all of
+ * them are drained.
+ *
+ * @param pool pointer to the pool structure.
+ *
+ * @param plug if true the workers will continue to block new submissions
+ * after all items have drained.
+ *
+ * @retval 0 on success
+ * @retval negative if a wait was interrupted or failed
+ */
+int k_work_pool_drain(struct k_work_pool *pool, bool plug);
+
 /** @} */
 
 struct k_work_user;
@@ -4568,6 +4842,15 @@ struct k_msgq {
 	/** Number of used messages */
 	uint32_t used_msgs;
 
+#ifdef CONFIG_MSGQ_ZERO_COPY
+	/** Threads waiting to claim messages or free slots */
+	_wait_q_t claim_wait_q;
+	/** Number of free slots claimed by the producer */
+	uint32_t put_claimed;
+	/** Number of messages claimed by the consumer */
+	uint32_t get_claimed;
+#endif
+
 	Z_DECL_POLL_EVENT
 
 	/** Message queue */
@@ -4594,6 +4877,8 @@ struct k_msgq {
 	.read_ptr = q_buffer, \
 	.write_ptr = q_buffer, \
 	.used_msgs = 0, \
+	IF_ENABLED(CONFIG_MSGQ_ZERO_COPY, \
+		   (.claim_wait_q = Z_WAIT_Q_INIT(&obj.claim_wait_q),)) \
 	Z_POLL_EVENT_OBJ_INIT(obj) \
 	}
 
@@ -4737,6 +5022,183 @@ __syscall int k_msgq_put(struct k_msgq *msgq, const void *data, k_timeout_t time
  */
 __syscall int k_msgq_get(struct k_msgq *msgq, void *data, k_timeout_t timeout);
 
+#if defined(CONFIG_MSGQ_ZERO_COPY) || defined(__DOXYGEN__)
+/**
+ * @brief Claim free slots of a message queue.
+ *
+ * This routine claims up to @a max_msgs free slots at the tail of message
+ * queue @a msgq, for the caller to write messages into in place.  The
+ * slots are contiguous in the queue's ring buffer, starting at @a slot.
+ * The messages are sent by k_msgq_put_commit_batch().
+ *
+ * Only one thread at a time may have slots claimed.  While it does,
+ * k_msgq_put() and further claims fail with -EBUSY.
+ *
+ * @note @a timeout must be set to K_NO_WAIT if called from ISR.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param msgq Address of the message queue.
+ * @param slot Address of a pointer set to the first claimed slot.
+ * @param max_msgs Maximum number of slots to claim.
+ * @param timeout Waiting period for a free slot, or one of the special
+ *                values K_NO_WAIT and K_FOREVER.
+ *
+ * @return Number of claimed slots, at least 1, on success.
+ * @retval -ENOMSG Returned without waiting or queue purged.
+ * @retval -EAGAIN Waiting period timed out.
+ * @retval -EBUSY Slots already claimed.
+ * @retval -EINVAL @a max_msgs is 0.
+ */
+int k_msgq_put_claim_batch(struct k_msgq *msgq, void **slot, uint32_t max_msgs,
+			   k_timeout_t timeout);
+
+/**
+ * @brief Send messages written into claimed slots.
+ *
+ * This routine sends the messages written into the first @a num_msgs slots
+ * claimed by k_msgq_put_claim_batch(), in order, and releases the
+ * remaining claimed slots.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param msgq Address of the message queue.
+ * @param num_msgs Number of messages to send.
+ *
+ * @retval 0 Messages sent.
+ * @retval -EINVAL More messages than claimed slots.
+ */
+int k_msgq_put_commit_batch(struct k_msgq *msgq, uint32_t num_msgs);
+
+/**
+ * @brief Claim the first messages of a message queue.
+ *
+ * This routine claims up to @a max_msgs messages at the head of message
+ * queue @a msgq, for the caller to read in place.  The messages are
+ * contiguous in the queue's ring buffer, starting at @a slot.  They stay
+ * in the queue until received with k_msgq_get_finish_batch().
+ *
+ * Only one thread at a time may have messages claimed.  While it does,
+ * k_msgq_get() and further claims fail with -EBUSY.
+ *
+ * @note @a timeout must be set to K_NO_WAIT if called from ISR.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param msgq Address of the message queue.
+ * @param slot Address of a pointer set to the first claimed message.
+ * @param max_msgs Maximum number of messages to claim.
+ * @param timeout Waiting period for a message, or one of the special
+ *                values K_NO_WAIT and K_FOREVER.
+ *
+ * @return Number of claimed messages, at least 1, on success.
+ * @retval -ENOMSG Returned without waiting or queue purged.
+ * @retval -EAGAIN Waiting period timed out.
+ * @retval -EBUSY Messages already claimed.
+ * @retval -EINVAL @a max_msgs is 0.
+ */
+int k_msgq_get_claim_batch(struct k_msgq *msgq, void **slot, uint32_t max_msgs,
+			   k_timeout_t timeout);
+
+/**
+ * @brief Receive claimed messages.
+ *
+ * This routine removes the first @a num_msgs messages claimed by
+ * k_msgq_get_claim_batch() from the queue, freeing their slots, and
+ * releases the remaining claimed messages.  Purging the queue drops
+ * the claim.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param msgq Address of the message queue.
+ * @param num_msgs Number of messages to receive.
+ *
+ * @retval 0 Messages received.
+ * @retval -EINVAL More messages than claimed, or queue purged.
+ */
+int k_msgq_get_finish_batch(struct k_msgq *msgq, uint32_t num_msgs);
+
+/**
+ * @brief Claim a free slot of a message queue.
+ *
+ * Same as k_msgq_put_claim_batch() for a single slot.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param msgq Address of the message queue.
+ * @param slot Address of a pointer set to the claimed slot.
+ * @param timeout Waiting period for a free slot, or one of the special
+ *                values K_NO_WAIT and K_FOREVER.
+ *
+ * @retval 0 Slot claimed.
+ * @retval -ENOMSG Returned without waiting or queue purged.
+ * @retval -EAGAIN Waiting period timed out.
+ * @retval -EBUSY Slots already claimed.
+ */
+static inline int k_msgq_put_claim(struct k_msgq *msgq, void **slot,
+				   k_timeout_t timeout)
+{
+	int ret = k_msgq_put_claim_batch(msgq, slot, 1, timeout);
+
+	return (ret < 0) ? ret : 0;
+}
+
+/**
+ * @brief Send the message written into the claimed slot.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param msgq Address of the message queue.
+ *
+ * @retval 0 Message sent.
+ * @retval -EINVAL No slot claimed.
+ */
+static inline int k_msgq_put_commit(struct k_msgq *msgq)
+{
+	return k_msgq_put_commit_batch(msgq, 1);
+}
+
+/**
+ * @brief Claim the first message of a message queue.
+ *
+ * Same as k_msgq_get_claim_batch() for a single message.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param msgq Address of the message queue.
+ * @param slot Address of a pointer set to the claimed message.
+ * @param timeout Waiting period for a message, or one of the special
+ *                values K_NO_WAIT and K_FOREVER.
+ *
+ * @retval 0 Message claimed.
+ * @retval -ENOMSG Returned without waiting or queue purged.
+ * @retval -EAGAIN Waiting period timed out.
+ * @retval -EBUSY Messages already claimed.
+ */
+static inline int k_msgq_get_claim(struct k_msgq *msgq, void **slot,
+				   k_timeout_t timeout)
+{
+	int ret = k_msgq_get_claim_batch(msgq, slot, 1, timeout);
+
+	return (ret < 0) ? ret : 0;
+}
+
+/**
+ * @brief Receive the claimed message.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param msgq Address of the message queue.
+ *
+ * @retval 0 Message received.
+ * @retval -EINVAL No message claimed, or queue purged.
+ */
+static inline int k_msgq_get_finish(struct k_msgq *msgq)
+{
+	return k_msgq_get_finish_batch(msgq, 1);
+}
+#endif /* CONFIG_MSGQ_ZERO_COPY || __DOXYGEN__ */
+
 /**
  * @brief Peek/read a message from a message queue.
  *
@@ -5009,6 +5471,12 @@ struct k_pipe {
 
 	uint8_t	       flags;		/**< Flags */
 
+#ifdef CONFIG_PIPE_SPSC
+	atomic_t       spsc_head;	/**< SPSC write position */
+	atomic_t       spsc_tail;	/**< SPSC read position */
+	atomic_t       spsc_waiting;	/**< SPSC blocked reader/writer */
+#endif
+
 	SYS_PORT_TRACING_TRACKING_FIELD(k_pipe)
 
 #ifdef CONFIG_OBJ_CORE_PIPE
@@ -5020,8 +5488,13 @@ struct k_pipe {
  * @cond INTERNAL_HIDDEN
  */
 #define K_PIPE_FLAG_ALLOC	BIT(0)	/** Buffer was allocated */
+#define K_PIPE_FLAG_SPSC	BIT(1)	/** Single producer and consumer */
 
 #define Z_PIPE_INITIALIZER(obj, pipe_buffer, pipe_buffer_size)     \
+	Z_PIPE_INITIALIZER_FLAGS(obj, pipe_buffer, pipe_buffer_size, 0)
+
+#define Z_PIPE_INITIALIZER_FLAGS(obj, pipe_buffer, pipe_buffer_size, \
+				 pipe_flags)                        \
 	{                                                           \
 	.buffer = pipe_buffer,                                      \
 	.size = pipe_buffer_size,                                   \
@@ -5034,7 +5507,7 @@ struct k_pipe {
 		.writers = Z_WAIT_Q_INIT(&obj.wait_q.writers)        \
 	},                                                          \
 	Z_POLL_EVENT_OBJ_INIT(obj)                                   \
-	.flags = 0,                                                 \
+	.flags = pipe_flags,                                        \
 	}
 
 /**
@@ -5060,6 +5533,31 @@ struct k_pipe {
 	STRUCT_SECTION_ITERABLE(k_pipe, name) =				\
 		Z_PIPE_INITIALIZER(name, _k_pipe_buf_##name, pipe_buffer_size)
 
+/**
+ * @brief Statically define and initialize a single-producer/single-consumer
+ * pipe.
+ *
+ * The pipe is written by at most one thread or ISR, and read by at most
+ * one other, at any given time. This lets data pass through the pipe's
+ * ring buffer without taking the pipe's lock, except when the reader or
+ * the writer has to block. k_pipe_flush() and k_pipe_buffer_flush() count
+ * as reads.
+ *
+ * Requires @kconfig{CONFIG_PIPE_SPSC}.
+ *
+ * @param name Name of the pipe.
+ * @param pipe_buffer_size Size of the pipe's ring buffer (in bytes),
+ *                         which must not be zero.
+ * @param pipe_align Alignment of the pipe's ring buffer (power of 2).
+ */
+#define K_PIPE_SPSC_DEFINE(name, pipe_buffer_size, pipe_align)		\
+	BUILD_ASSERT((pipe_buffer_size) != 0, "SPSC pipes need a buffer"); \
+	static unsigned char __noinit __aligned(pipe_align)		\
+		_k_pipe_buf_##name[pipe_buffer_size];			\
+	STRUCT_SECTION_ITERABLE(k_pipe, name) =				\
+		Z_PIPE_INITIALIZER_FLAGS(name, _k_pipe_buf_##name,	\
+					 pipe_buffer_size, K_PIPE_FLAG_SPSC)
+
 /**
  * @brief Initialize a pipe.
  *
@@ -5073,6 +5571,22 @@ struct k_pipe {
  */
 void k_pipe_init(struct k_pipe *pipe, unsigned char *buffer, size_t size);
 
+/**
+ * @brief Initialize a single-producer/single-consumer pipe.
+ *
+ * This routine initializes a pipe object, prior to its first use, like
+ * k_pipe_init(). The pipe may then only be written by one thread or ISR
+ * and read by one other at any given time, see K_PIPE_SPSC_DEFINE().
+ *
+ * Requires @kconfig{CONFIG_PIPE_SPSC}.
+ *
+ * @param pipe Address of the pipe.
+ * @param buffer Address of the pipe's ring buffer.
+ * @param size Size of the pipe's ring buffer (in bytes), which must not
+ *             be zero.
+ */
+void k_pipe_spsc_init(struct k_pipe *pipe, unsigned char *buffer, size_t size);
+
 /**
  * @brief Release a pipe's allocated buffer
  *
@@ -5213,6 +5727,10 @@ struct k_mem_slab {
 	struct k_spinlock lock;
 	char *buffer;
 	char *free_list;
+#ifdef CONFIG_MEM_SLAB_LOCKLESS
+	atomic_t free_head;
+	atomic_t num_used;
+#endif
 	struct k_mem_slab_info info;
 
 	SYS_PORT_TRACING_TRACKING_FIELD(k_mem_slab)
@@ -5368,7 +5886,11 @@ void k_mem_slab_free(struct k_mem_slab *slab, void *mem);
  */
 static inline uint32_t k_mem_slab_num_used_get(struct k_mem_slab *slab)
 {
+#ifdef CONFIG_MEM_SLAB_LOCKLESS
+	return (uint32_t)atomic_get(&slab->num_used);
+#else
 	return slab->info.num_used;
+#endif
 }
 
 /**
@@ -5403,7 +5925,7 @@ static inline uint32_t k_mem_slab_max_used_get(struct k_mem_slab *slab)
  */
 static inline uint32_t k_mem_slab_num_free_get(struct k_mem_slab *slab)
 {
-	return slab->info.num_blocks - slab->info.num_used;
+	return slab->info.num_blocks - k_mem_slab_num_used_get(slab);
 }
 
 /**
@@ -5440,12 +5962,30 @@ int k_mem_slab_runtime_stats_reset_max(struct k_mem_slab *slab);
  * @{
  */
 
+#ifdef CONFIG_KERNEL_HEAP_CACHE
+/* Number of size classes of the k_heap cache: 16, 32, ... bytes up to
+ * CONFIG_KERNEL_HEAP_CACHE_MAX_SIZE.
+ */
+#define Z_HEAP_CACHE_CLASSES (LOG2(CONFIG_KERNEL_HEAP_CACHE_MAX_SIZE) - 3)
+
+/* Per-CPU cache of free small blocks of a k_heap, see kheap.c */
+struct z_heap_cache {
+	struct k_spinlock lock;
+	uint8_t count[Z_HEAP_CACHE_CLASSES];
+	void *blocks[Z_HEAP_CACHE_CLASSES][CONFIG_KERNEL_HEAP_CACHE_DEPTH];
+};
+#endif /* CONFIG_KERNEL_HEAP_CACHE */
+
 /* kernel synchronized heap struct */
 
 struct k_heap {
 	struct sys_heap heap;
 	_wait_q_t wait_q;
 	struct k_spinlock lock;
+#ifdef CONFIG_KERNEL_HEAP_CACHE
+	struct z_heap_cache cache[CONFIG_MP_MAX_NUM_CPUS];
+	atomic_t cache_waiters;
+#endif /* CONFIG_KERNEL_HEAP_CACHE */
 };
 
 /**
@@ -6021,6 +6561,30 @@ __syscall void k_poll_signal_check(struct k_poll_signal *sig,
 
 __syscall int k_poll_signal_raise(struct k_poll_signal *sig, int result);
 
+/**
+ * @brief Signal several poll signal objects at once.
+ *
+ * This routine raises each of @a signals as k_poll_signal_raise() would,
+ * storing the same @a result in all of them, but only reschedules once
+ * all of them have been raised. A thread polling on several of the
+ * signals is thus woken, and switched to, only once.
+ *
+ * @funcprops \isr_ok
+ *
+ * @note Unlike k_poll_signal_raise(), this routine is not available to
+ * user mode threads.
+ *
+ * @param signals Array of poll signals.
+ * @param num_signals Number of poll signals in @a signals.
+ * @param result The value to store in the result field of the signals.
+ *
+ * @retval 0 The signals were delivered successfully.
+ * @retval -EAGAIN The timeout of a thread polling on one of the signals is
+ *                 in the process of expiring.
+ */
+int k_poll_signal_raise_batch(struct k_poll_signal *const *signals,
+			      int num_signals, int result);
+
 /** @} */
 
 /**
@@ -6290,6 +6854,35 @@ void k_sys_runtime_stats_enable(void);
  */
 void k_sys_runtime_stats_disable(void);
 
+#if defined(CONFIG_SCHED_THREAD_USAGE_HISTOGRAM) || defined(__DOXYGEN__)
+/**
+ * @brief Get the scheduling histograms of a thread
+ *
+ * This routine copies the histograms of the time the specified thread ran
+ * for once switched in, and waited for once made ready, without locking.
+ * They are only updated while the gathering of runtime statistics is enabled
+ * for the thread.
+ *
+ * @param thread ID of thread.
+ * @param hist Pointer to struct to copy histograms into.
+ * @return -EINVAL if null pointers, otherwise 0
+ */
+int k_thread_runtime_histogram_get(k_tid_t thread, struct k_sched_histogram *hist);
+
+/**
+ * @brief Get the scheduling histograms of all threads on specified cpu
+ *
+ * The histograms of a CPU are only updated while the gathering of system
+ * runtime statistics is enabled, and are always empty without
+ * CONFIG_SCHED_THREAD_USAGE_ALL. The idle thread run time is not counted.
+ *
+ * @param cpu The cpu number
+ * @param hist Pointer to struct to copy histograms into.
+ * @return -EINVAL if invalid cpu number or null pointer, otherwise 0
+ */
+int k_thread_runtime_histogram_cpu_get(int cpu, struct k_sched_histogram *hist);
+#endif /* CONFIG_SCHED_THREAD_USAGE_HISTOGRAM */
+
 #ifdef __cplusplus
 }
 #endif
@@ -59,6 +59,60 @@ struct k_mem_paging_stats_t {
 		/** Number of dirty pages selected for eviction */
 		unsigned long			dirty;
 	} eviction;
+
+	/**
+	 * Eviction algorithm statistics, only maintained by algorithms
+	 * keeping a history of evicted pages, and not per thread.
+	 */
+	struct {
+		/** Number of resident pages found accessed again */
+		unsigned long			hit;
+
+		/** Number of pages paged in with no eviction history */
+		unsigned long			miss;
+
+		/** Number of pages paged in shortly after being evicted */
+		unsigned long			thrash;
+	} policy;
+
+	/**
+	 * Read-ahead statistics, only maintained with
+	 * CONFIG_DEMAND_PAGING_READ_AHEAD, and not per thread.
+	 */
+	struct {
+		/** Number of page faults which read ahead data pages */
+		unsigned long			batches;
+
+		/** Number of data pages read ahead */
+		unsigned long			pages;
+	} read_ahead;
+
+	/**
+	 * Compression statistics, only maintained by backing stores
+	 * compressing data pages, and not per thread.
+	 *
+	 * The compression ratio of compressible data pages is
+	 * compressed * CONFIG_MMU_PAGE_SIZE / compressed_bytes.
+	 */
+	struct {
+		/** Number of data pages stored compressed */
+		unsigned long			compressed;
+
+		/** Number of data pages stored as is, not being compressible */
+		unsigned long			incompressible;
+
+		/** Number of data pages decompressed */
+		unsigned long			decompressed;
+
+		/** Total size of the data pages stored compressed, in bytes */
+		uint64_t			compressed_bytes;
+
+		/** Time spent compressing data pages, in hardware cycles */
+		uint64_t			compress_cycles;
+
+		/** Time spent decompressing data pages, in hardware cycles */
+		uint64_t			decompress_cycles;
+	} compression;
 #endif /* CONFIG_DEMAND_PAGING_STATS */
 };
 
@@ -205,6 +259,20 @@ __syscall void k_mem_paging_histogram_backing_store_page_in_get(
 __syscall void k_mem_paging_histogram_backing_store_page_out_get(
 	struct k_mem_paging_histogram_t *hist);
 
+/**
+ * Get the page fault timing histogram
+ *
+ * This populates the timing histogram struct being passed in
+ * as argument. Only page faults needing a page-in are accounted for,
+ * from the fault until the data page, and any data page read ahead,
+ * is mapped. The bins have the same bounds as the backing store
+ * timing histograms.
+ *
+ * @param[in,out] hist Timing histogram struct to be filled.
+ */
+__syscall void k_mem_paging_histogram_page_fault_get(
+	struct k_mem_paging_histogram_t *hist);
+
 #include <zephyr/syscalls/demand_paging.h>
 
 /** @} */
@@ -282,6 +350,42 @@ static inline void k_mem_paging_eviction_accessed(uintptr_t phys)
 
 #endif /* CONFIG_EVICTION_TRACKING || __DOXYGEN__ */
 
+/**
+ * Eviction algorithm events counted in the paging statistics
+ */
+enum k_mem_paging_eviction_event {
+	/** A resident page was found accessed again */
+	K_MEM_PAGING_EVICTION_HIT,
+	/** A page with no eviction history was paged in */
+	K_MEM_PAGING_EVICTION_MISS,
+	/** A page was paged in shortly after being evicted */
+	K_MEM_PAGING_EVICTION_THRASH,
+};
+
+#if defined(CONFIG_DEMAND_PAGING_STATS) || defined(__DOXYGEN__)
+
+/**
+ * Count an eviction algorithm event
+ *
+ * Eviction algorithms may call this to report how well they perform in
+ * the policy part of the paging statistics, so that they can be compared
+ * on a given workload.
+ *
+ * This function is invoked with interrupts locked.
+ *
+ * @param [in] event The event to count
+ */
+void k_mem_paging_eviction_stats_inc(enum k_mem_paging_eviction_event event);
+
+#else /* CONFIG_DEMAND_PAGING_STATS || __DOXYGEN__ */
+
+static inline void k_mem_paging_eviction_stats_inc(enum k_mem_paging_eviction_event event)
+{
+	ARG_UNUSED(event);
+}
+
+#endif /* CONFIG_DEMAND_PAGING_STATS || __DOXYGEN__ */
+
 /**
  * Select a page frame for eviction
  *
@@ -412,6 +516,30 @@ void k_mem_paging_backing_store_page_out(uintptr_t location);
  */
 void k_mem_paging_backing_store_page_in(uintptr_t location);
 
+/**
+ * Copy data pages from the provided locations to K_MEM_SCRATCH_BATCH.
+ *
+ * The data page at locations[i] is copied to K_MEM_SCRATCH_BATCH plus
+ * i * CONFIG_MMU_PAGE_SIZE. Immediately before this is called, these pages
+ * will be mapped read-write to the intended destination page frames.
+ *
+ * This is used with CONFIG_DEMAND_PAGING_READ_AHEAD, allowing the backing
+ * store to fetch all data pages with one request, for example when their
+ * locations are contiguous. Backing stores implementing it must select
+ * CONFIG_BACKING_STORE_PAGE_IN_BATCH. It is invoked instead of
+ * k_mem_paging_backing_store_page_in(), and
+ * k_mem_paging_backing_store_page_finalize() is invoked afterwards for each
+ * data page.
+ *
+ * Calls to this, k_mem_paging_backing_store_page_in() and
+ * k_mem_paging_backing_store_page_out() will always be serialized, but
+ * interrupts may be enabled.
+ *
+ * @param locations Location tokens for the data pages
+ * @param count Number of data pages
+ */
+void k_mem_paging_backing_store_page_in_batch(const uintptr_t *locations, size_t count);
+
 /**
  * Update internal accounting after a page-in
  *
@@ -435,6 +563,43 @@ void k_mem_paging_backing_store_page_in(uintptr_t location);
 void k_mem_paging_backing_store_page_finalize(struct k_mem_page_frame *pf,
 					      uintptr_t location);
 
+#if defined(CONFIG_DEMAND_PAGING_STATS) || defined(__DOXYGEN__)
+
+/**
+ * Count a data page compressed by the backing store
+ *
+ * Backing stores compressing data pages may call this from
+ * k_mem_paging_backing_store_page_out() to report their efficiency in the
+ * compression part of the paging statistics.
+ *
+ * @param size Size of the data page once compressed, or
+ *             CONFIG_MMU_PAGE_SIZE if it was stored as is
+ * @param cycles Time spent compressing it, in hardware cycles
+ */
+void k_mem_paging_backing_store_stats_compress(size_t size, uint32_t cycles);
+
+/**
+ * Count a data page decompressed by the backing store
+ *
+ * @param cycles Time spent decompressing it, in hardware cycles
+ */
+void k_mem_paging_backing_store_stats_decompress(uint32_t cycles);
+
+#else /* CONFIG_DEMAND_PAGING_STATS || __DOXYGEN__ */
+
+static inline void k_mem_paging_backing_store_stats_compress(size_t size, uint32_t cycles)
+{
+	ARG_UNUSED(size);
+	ARG_UNUSED(cycles);
+}
+
+static inline void k_mem_paging_backing_store_stats_decompress(uint32_t cycles)
+{
+	ARG_UNUSED(cycles);
+}
+
+#endif /* CONFIG_DEMAND_PAGING_STATS || __DOXYGEN__ */
+
 /**
  * Backing store initialization function.
  *
@@ -10,6 +10,24 @@
 #include <stdint.h>
 #include <stdbool.h>
 
+#if defined(CONFIG_SCHED_THREAD_USAGE_HISTOGRAM) || defined(__DOXYGEN__)
+/**
+ * Histograms of thread scheduling durations, in cycles.
+ *
+ * Bin 0 counts durations below 2^CONFIG_SCHED_THREAD_USAGE_HISTOGRAM_SHIFT
+ * cycles, each following bin durations up to twice as long as the previous
+ * one, and the last bin all longer durations.
+ */
+struct k_sched_histogram {
+	/** Time run for once switched in */
+	uint32_t run[CONFIG_SCHED_THREAD_USAGE_HISTOGRAM_BINS];
+	/** Time waited for once made ready, until switched in */
+	uint32_t latency[CONFIG_SCHED_THREAD_USAGE_HISTOGRAM_BINS];
+	/** Longest time waited for once made ready */
+	uint32_t latency_max;
+};
+#endif /* CONFIG_SCHED_THREAD_USAGE_HISTOGRAM */
+
 /**
  * Structure used to track internal statistics about both thread
  * and CPU usage.
@@ -27,6 +45,10 @@ struct k_cycle_stats {
 	uint32_t  num_windows;  /**< \# of usage windows */
 	/** @} */
 #endif /* CONFIG_SCHED_THREAD_USAGE_ANALYSIS */
+#if defined(CONFIG_SCHED_THREAD_USAGE_HISTOGRAM) || defined(__DOXYGEN__)
+	/** Scheduling histograms, when CONFIG_SCHED_THREAD_USAGE_HISTOGRAM is selected */
+	struct k_sched_histogram  histogram;
+#endif /* CONFIG_SCHED_THREAD_USAGE_HISTOGRAM */
 	bool      track_usage;  /**< true if gathering usage stats */
 };
 
@@ -117,6 +117,11 @@ struct _thread_base {
 	/* Recursive count of irq_lock() calls */
 	uint8_t global_lock_count;
 
+#ifdef CONFIG_SCHED_WORK_STEALING
+	/* Index of the CPU whose ready queue holds this thread */
+	uint8_t runq_cpu;
+#endif /* CONFIG_SCHED_WORK_STEALING */
+
 #endif /* CONFIG_SMP */
 
 #ifdef CONFIG_SCHED_CPU_MASK
@@ -145,6 +150,10 @@ struct _thread_base {
 #ifdef CONFIG_SCHED_THREAD_USAGE
 	struct k_cycle_stats  usage;   /* Track thread usage statistics */
 #endif /* CONFIG_SCHED_THREAD_USAGE */
+
+#ifdef CONFIG_SCHED_THREAD_USAGE_HISTOGRAM
+	uint32_t usage_ready0;         /* Time made ready, 0 once switched in */
+#endif /* CONFIG_SCHED_THREAD_USAGE_HISTOGRAM */
 };
 
 typedef struct _thread_base _thread_base_t;
@@ -248,6 +257,9 @@ typedef struct k_thread_runtime_stats {
 }  k_thread_runtime_stats_t;
 
 struct z_poller {
+#ifdef CONFIG_POLL_LOCK_SHARDING
+	struct k_spinlock lock;
+#endif /* CONFIG_POLL_LOCK_SHARDING */
 	bool is_polling;
 	uint8_t mode;
 };
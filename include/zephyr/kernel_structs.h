@@ -154,7 +154,7 @@ struct _cpu {
 	/* one assigned idle thread per CPU */
 	struct k_thread *idle_thread;
 
-#ifdef CONFIG_SCHED_CPU_MASK_PIN_ONLY
+#ifdef CONFIG_SCHED_CPU_READY_Q
 	struct _ready_q ready_q;
 #endif
 
@@ -184,6 +184,11 @@ struct _cpu {
 
 	uint32_t usage0;
 
+#ifdef CONFIG_SCHED_THREAD_USAGE_HISTOGRAM
+	/* Time the current thread was switched in */
+	uint32_t usage_run0;
+#endif
+
 #ifdef CONFIG_SCHED_THREAD_USAGE_ALL
 	struct k_cycle_stats *usage;
 #endif
@@ -210,7 +215,7 @@ struct z_kernel {
 	 * ready queue: can be big, keep after small fields, since some
 	 * assembly (e.g. ARC) are limited in the encoding of the offset
 	 */
-#ifndef CONFIG_SCHED_CPU_MASK_PIN_ONLY
+#ifndef CONFIG_SCHED_CPU_READY_Q
 	struct _ready_q ready_q;
 #endif
 
@@ -297,7 +302,10 @@ struct _timeout {
 	sys_dnode_t node;
 	_timeout_func_t fn;
 #ifdef CONFIG_TIMEOUT_64BIT
-	/* Can't use k_ticks_t for header dependency reasons */
+	/* Can't use k_ticks_t for header dependency reasons.  With
+	 * CONFIG_TIMEOUT_QUEUE_WHEEL this is the absolute expiry tick
+	 * instead of the delta to the previous timeout.
+	 */
 	int64_t dticks;
 #else
 	int32_t dticks;
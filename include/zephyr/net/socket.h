@@ -76,6 +76,8 @@ extern "C" {
 #define ZSOCK_MSG_DONTWAIT 0x40
 /** zsock_recv: block until the full amount of data can be returned */
 #define ZSOCK_MSG_WAITALL 0x100
+/** zsock_recvmmsg: only block until the first message is received */
+#define ZSOCK_MSG_WAITFORONE 0x10000
 /** @} */
 
 /**
@@ -461,6 +463,45 @@ static inline ssize_t zsock_send(int sock, const void *buf, size_t len,
 	return zsock_sendto(sock, buf, len, flags, NULL, 0);
 }
 
+/**
+ * @typedef zsock_send_zc_cb_t
+ * @brief Called once the data of a zero-copy send is no longer used
+ *
+ * @param user_data User data given to zsock_send_zc().
+ */
+typedef void (*zsock_send_zc_cb_t)(void *user_data);
+
+/**
+ * @brief Send data without copying it
+ *
+ * @details
+ * Zero-copy variant of zsock_send() for SOCK_STREAM sockets. Instead of
+ * being copied, the data is referenced by the network stack until it has
+ * been acknowledged by the peer, or the connection is closed. @p cb is then
+ * called and the buffer can be reused. Until then, the buffer must neither
+ * be modified nor freed. As with zsock_send(), less data than requested may
+ * be sent, and @p cb is called once for the data which was.
+ *
+ * @p cb is called from the network stack, so it must not block nor call
+ * socket functions. It may also be called when an error is returned, if
+ * the connection was closed while the data was being sent.
+ *
+ * This function is only available to kernel threads, and only supported by
+ * the native TCP sockets.
+ * Available if @kconfig{CONFIG_NET_TCP_TX_ZEROCOPY} is enabled.
+ *
+ * @param sock Socket to send the data to.
+ * @param buf Data to send.
+ * @param len Length of the data.
+ * @param flags Flags, as for zsock_send().
+ * @param cb Callback to call once the data is no longer used.
+ * @param user_data User data given to @p cb.
+ *
+ * @return Number of bytes sent, or -1 with errno set on error.
+ */
+ssize_t zsock_send_zc(int sock, const void *buf, size_t len, int flags,
+		      zsock_send_zc_cb_t cb, void *user_data);
+
 /**
  * @brief Send data to an arbitrary network address
  *
@@ -474,6 +515,30 @@ static inline ssize_t zsock_send(int sock, const void *buf, size_t len,
 __syscall ssize_t zsock_sendmsg(int sock, const struct msghdr *msg,
 				int flags);
 
+/**
+ * @brief Send several messages with a single call
+ *
+ * @details
+ * Sends up to @p vlen messages, as if zsock_sendmsg() was called for each
+ * of them, but looking up and locking the socket only once. The number of
+ * bytes sent for each message is stored in its @p msg_len field.
+ * From user mode, at most @kconfig{CONFIG_NET_SOCKETS_MMSG_USER_MAX}
+ * messages are copied and sent per call.
+ * This is the equivalent of the Linux `sendmmsg()` call, and this function
+ * is also exposed as `sendmmsg()` if @kconfig{CONFIG_POSIX_API} is defined.
+ *
+ * @param sock Socket to send the messages with.
+ * @param msgvec Messages to send.
+ * @param vlen Number of messages in @p msgvec.
+ * @param flags Flags, as for zsock_sendmsg().
+ *
+ * @return Number of messages sent, or -1 with errno set if none could be
+ *         sent. The error of a message which could not be sent after
+ *         others were is not reported.
+ */
+__syscall int zsock_sendmmsg(int sock, struct mmsghdr *msgvec,
+			     unsigned int vlen, int flags);
+
 /**
  * @brief Receive data from an arbitrary network address
  *
@@ -500,6 +565,37 @@ __syscall ssize_t zsock_recvfrom(int sock, void *buf, size_t max_len,
  */
 __syscall ssize_t zsock_recvmsg(int sock, struct msghdr *msg, int flags);
 
+/**
+ * @brief Receive several messages with a single call
+ *
+ * @details
+ * Receives up to @p vlen messages, as if zsock_recvmsg() was called for
+ * each of them, but looking up and locking the socket only once. The number
+ * of bytes received for each message is stored in its @p msg_len field.
+ * From user mode, at most @kconfig{CONFIG_NET_SOCKETS_MMSG_USER_MAX}
+ * messages are received per call.
+ * With @ref ZSOCK_MSG_WAITFORONE, the call only blocks until the first
+ * message is received, returning the messages already queued after it.
+ * As with Linux, the @p timeout is only checked once a message is received,
+ * so use a socket receive timeout or ZSOCK_MSG_WAITFORONE not to block
+ * indefinitely.
+ * This is the equivalent of the Linux `recvmmsg()` call, and this function
+ * is also exposed as `recvmmsg()` if @kconfig{CONFIG_POSIX_API} is defined.
+ *
+ * @param sock Socket to receive the messages from.
+ * @param msgvec Messages to fill.
+ * @param vlen Number of messages in @p msgvec.
+ * @param flags Flags, as for zsock_recvmsg(), and ZSOCK_MSG_WAITFORONE.
+ * @param timeout Time after which not to receive more messages, or NULL.
+ *
+ * @return Number of messages received, or -1 with errno set if none could
+ *         be received. The error of a message which could not be received
+ *         after others were is not reported.
+ */
+__syscall int zsock_recvmmsg(int sock, struct mmsghdr *msgvec,
+			     unsigned int vlen, int flags,
+			     struct timespec *timeout);
+
 /**
  * @brief Receive data from a connected peer
  *
@@ -516,6 +612,38 @@ static inline ssize_t zsock_recv(int sock, void *buf, size_t max_len,
 	return zsock_recvfrom(sock, buf, max_len, flags, NULL, NULL);
 }
 
+struct net_buf;
+
+/**
+ * @brief Receive data without copying it
+ *
+ * @details
+ * Zero-copy variant of zsock_recvfrom(). Instead of copying the received
+ * data into a buffer, the network buffer fragments holding it are handed
+ * over to the caller, which must release them with net_buf_unref() once
+ * done with them. Until then, they are not available to receive more data.
+ *
+ * A single datagram is returned for SOCK_DGRAM sockets, and the data of a
+ * single received segment for SOCK_STREAM sockets, whatever their length.
+ * The source address is returned as with zsock_recvfrom().
+ *
+ * This function is only available to kernel threads, and only supported by
+ * the native IPv4/IPv6 sockets.
+ * Available if @kconfig{CONFIG_NET_SOCKETS_RECV_ZEROCOPY} is enabled.
+ *
+ * @param sock Socket to receive the data from.
+ * @param frags Set to the received fragment chain, or to NULL if no data was
+ *              received (end of stream or empty datagram).
+ * @param flags Flags, as for zsock_recvfrom(). ZSOCK_MSG_PEEK and
+ *              ZSOCK_MSG_TRUNC are not supported.
+ * @param src_addr Source address of the data, or NULL.
+ * @param addrlen Length of @p src_addr, updated with the actual length.
+ *
+ * @return Number of bytes received, or -1 with errno set on error.
+ */
+ssize_t zsock_recv_zc(int sock, struct net_buf **frags, int flags,
+		      struct sockaddr *src_addr, socklen_t *addrlen);
+
 /**
  * @brief Control blocking/non-blocking mode of a socket
  *
@@ -11,9 +11,16 @@
  * sys_mutex behaves almost exactly like k_mutex, with the added advantage
  * that a sys_mutex instance can reside in user memory.
  *
- * Further enhancements will support locking/unlocking uncontended sys_mutexes
- * with simple atomic ops instead of syscalls, similar to Linux's
- * FUTEX_LOCK_PI and FUTEX_UNLOCK_PI
+ * Similarly to Linux's FUTEX_LOCK_PI and FUTEX_UNLOCK_PI, uncontended
+ * sys_mutexes are locked and unlocked from user mode with a single atomic
+ * operation on their value, which then holds the owner thread. The kernel
+ * only gets involved once another thread has to wait: the mutex is then
+ * handed to its backing k_mutex, which provides priority inheritance, until
+ * it gets unlocked with no waiters left. Recursive locking always goes
+ * through the kernel.
+ *
+ * The fast path needs CONFIG_CURRENT_THREAD_USE_TLS to avoid a system call
+ * for the thread ID.
  */
 
 #ifdef __cplusplus
@@ -21,18 +28,23 @@ extern "C" {
 #endif
 
 #ifdef CONFIG_USERSPACE
+#include <zephyr/kernel.h>
 #include <zephyr/sys/atomic.h>
 #include <zephyr/types.h>
 #include <zephyr/sys_clock.h>
 
 struct sys_mutex {
-	/* Currently unused, but will be used to store state for fast mutexes
-	 * that can be locked/unlocked with atomic ops if there is no
-	 * contention
+	/* Owner thread when locked without contention, or one of the
+	 * values below
 	 */
 	atomic_t val;
 };
 
+/* Values of sys_mutex.val other than the owner thread */
+#define Z_SYS_MUTEX_UNLOCKED	0
+/* The backing k_mutex holds the state of the mutex */
+#define Z_SYS_MUTEX_KERNEL	1
+
 /**
  * @defgroup user_mutex_apis User mode mutex APIs
  * @ingroup kernel_apis
@@ -97,11 +109,19 @@ __syscall int z_sys_mutex_kernel_unlock(struct sys_mutex *mutex);
  * @retval -EBUSY Returned without waiting.
  * @retval -EAGAIN Waiting period timed out.
  * @retval -EACCES Caller has no access to provided mutex address
- * @retval -EINVAL Provided mutex not recognized by the kernel
+ * @retval -EINVAL Provided mutex not recognized by the kernel, or its value
+ *                 was corrupted
  */
 static inline int sys_mutex_lock(struct sys_mutex *mutex, k_timeout_t timeout)
 {
-	/* For now, make the syscall unconditionally */
+	/* Supervisor threads do not need to avoid system calls, and get
+	 * their arguments checked.
+	 */
+	if (k_is_user_context() &&
+	    atomic_cas(&mutex->val, Z_SYS_MUTEX_UNLOCKED, (atomic_val_t)k_current_get())) {
+		return 0;
+	}
+
 	return z_sys_mutex_kernel_lock(mutex, timeout);
 }
 
@@ -124,7 +144,11 @@ static inline int sys_mutex_lock(struct sys_mutex *mutex, k_timeout_t timeout)
  */
 static inline int sys_mutex_unlock(struct sys_mutex *mutex)
 {
-	/* For now, make the syscall unconditionally */
+	if (k_is_user_context() &&
+	    atomic_cas(&mutex->val, (atomic_val_t)k_current_get(), Z_SYS_MUTEX_UNLOCKED)) {
+		return 0;
+	}
+
 	return z_sys_mutex_kernel_unlock(mutex);
 }
 
@@ -16,10 +16,25 @@
 static struct k_obj_type obj_type_condvar;
 #endif /* CONFIG_OBJ_CORE_CONDVAR */
 
-static struct k_spinlock lock;
+#ifndef CONFIG_KERNEL_SYNC_OBJ_LOCKS
+static struct k_spinlock global_lock;
+#endif /* !CONFIG_KERNEL_SYNC_OBJ_LOCKS */
+
+static inline struct k_spinlock *condvar_lock(struct k_condvar *condvar)
+{
+#ifdef CONFIG_KERNEL_SYNC_OBJ_LOCKS
+	return &condvar->lock;
+#else
+	ARG_UNUSED(condvar);
+	return &global_lock;
+#endif /* CONFIG_KERNEL_SYNC_OBJ_LOCKS */
+}
 
 int z_impl_k_condvar_init(struct k_condvar *condvar)
 {
+#ifdef CONFIG_KERNEL_SYNC_OBJ_LOCKS
+	condvar->lock = (struct k_spinlock) {};
+#endif
 	z_waitq_init(&condvar->wait_q);
 	k_object_init(condvar);
 
@@ -43,7 +58,8 @@ int z_vrfy_k_condvar_init(struct k_condvar *condvar)
 
 int z_impl_k_condvar_signal(struct k_condvar *condvar)
 {
-	k_spinlock_key_t key = k_spin_lock(&lock);
+	struct k_spinlock *lock = condvar_lock(condvar);
+	k_spinlock_key_t key = k_spin_lock(lock);
 
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_condvar, signal, condvar);
 
@@ -54,9 +70,9 @@ int z_impl_k_condvar_signal(struct k_condvar *condvar)
 
 		arch_thread_return_value_set(thread, 0);
 		z_ready_thread(thread);
-		z_reschedule(&lock, key);
+		z_reschedule(lock, key);
 	} else {
-		k_spin_unlock(&lock, key);
+		k_spin_unlock(lock, key);
 	}
 
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_condvar, signal, condvar, 0);
@@ -76,10 +92,11 @@ int z_vrfy_k_condvar_signal(struct k_condvar *condvar)
 int z_impl_k_condvar_broadcast(struct k_condvar *condvar)
 {
 	struct k_thread *pending_thread;
+	struct k_spinlock *lock = condvar_lock(condvar);
 	k_spinlock_key_t key;
 	int woken = 0;
 
-	key = k_spin_lock(&lock);
+	key = k_spin_lock(lock);
 
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_condvar, broadcast, condvar);
 
@@ -93,7 +110,7 @@ int z_impl_k_condvar_broadcast(struct k_condvar *condvar)
 
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_condvar, broadcast, condvar, woken);
 
-	z_reschedule(&lock, key);
+	z_reschedule(lock, key);
 
 	return woken;
 }
@@ -109,15 +126,16 @@ int z_vrfy_k_condvar_broadcast(struct k_condvar *condvar)
 int z_impl_k_condvar_wait(struct k_condvar *condvar, struct k_mutex *mutex,
 			  k_timeout_t timeout)
 {
+	struct k_spinlock *lock = condvar_lock(condvar);
 	k_spinlock_key_t key;
 	int ret;
 
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_condvar, wait, condvar);
 
-	key = k_spin_lock(&lock);
+	key = k_spin_lock(lock);
 	k_mutex_unlock(mutex);
 
-	ret = z_pend_curr(&lock, key, &condvar->wait_q, timeout);
+	ret = z_pend_curr(lock, key, &condvar->wait_q, timeout);
 	k_mutex_lock(mutex, K_FOREVER);
 
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_condvar, wait, condvar, ret);
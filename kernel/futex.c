@@ -74,12 +74,16 @@ int z_impl_k_futex_wait(struct k_futex *futex, int expected,
 		return -EINVAL;
 	}
 
+	key = k_spin_lock(&futex_data->lock);
+
+	/* Checked with the lock held, so that a k_futex_wake() following a
+	 * change of the value can't be missed.
+	 */
 	if (atomic_get(&futex->val) != (atomic_val_t)expected) {
+		k_spin_unlock(&futex_data->lock, key);
 		return -EAGAIN;
 	}
 
-	key = k_spin_lock(&futex_data->lock);
-
 	ret = z_pend_curr(&futex_data->lock,
 			key, &futex_data->wait_q, timeout);
 	if (ret == -EAGAIN) {
@@ -99,3 +103,72 @@ static inline int z_vrfy_k_futex_wait(struct k_futex *futex, int expected,
 	return z_impl_k_futex_wait(futex, expected, timeout);
 }
 #include <zephyr/syscalls/k_futex_wait_mrsh.c>
+
+int z_impl_k_futex_requeue(struct k_futex *futex, struct k_futex *target,
+			   int expected, unsigned int nr_wake,
+			   unsigned int nr_requeue)
+{
+	k_spinlock_key_t key, target_key;
+	unsigned int woken = 0U;
+	unsigned int moved;
+	struct k_thread *thread;
+	struct z_futex_data *futex_data;
+	struct z_futex_data *target_data;
+	struct k_spinlock *first, *second;
+
+	futex_data = k_futex_find_data(futex);
+	target_data = k_futex_find_data(target);
+	if ((futex_data == NULL) || (target_data == NULL) ||
+	    (futex_data == target_data)) {
+		return -EINVAL;
+	}
+
+	/* Always locked in the same order, whichever futex threads move to */
+	if (futex_data < target_data) {
+		first = &futex_data->lock;
+		second = &target_data->lock;
+	} else {
+		first = &target_data->lock;
+		second = &futex_data->lock;
+	}
+
+	key = k_spin_lock(first);
+	target_key = k_spin_lock(second);
+
+	if (atomic_get(&futex->val) != (atomic_val_t)expected) {
+		k_spin_unlock(second, target_key);
+		k_spin_unlock(first, key);
+		return -EAGAIN;
+	}
+
+	while (woken < nr_wake) {
+		thread = z_unpend_first_thread(&futex_data->wait_q);
+		if (thread == NULL) {
+			break;
+		}
+		woken++;
+		arch_thread_return_value_set(thread, 0);
+		z_ready_thread(thread);
+	}
+
+	moved = z_waitq_requeue(&futex_data->wait_q, &target_data->wait_q, nr_requeue);
+
+	k_spin_unlock(second, target_key);
+	z_reschedule(first, key);
+
+	return woken + moved;
+}
+
+static inline int z_vrfy_k_futex_requeue(struct k_futex *futex,
+					 struct k_futex *target, int expected,
+					 unsigned int nr_wake,
+					 unsigned int nr_requeue)
+{
+	if ((K_SYSCALL_MEMORY_WRITE(futex, sizeof(struct k_futex)) != 0) ||
+	    (K_SYSCALL_MEMORY_WRITE(target, sizeof(struct k_futex)) != 0)) {
+		return -EACCES;
+	}
+
+	return z_impl_k_futex_requeue(futex, target, expected, nr_wake, nr_requeue);
+}
+#include <zephyr/syscalls/k_futex_requeue_mrsh.c>
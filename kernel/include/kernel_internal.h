@@ -181,6 +181,31 @@ void z_mem_domain_exit_thread(struct k_thread *thread);
  * not recommended.
  */
 extern struct k_spinlock z_mem_domain_lock;
+
+/* sys_mutex support. The k_mutex backing a sys_mutex is locked exactly
+ * when the sys_mutex value is Z_SYS_MUTEX_KERNEL, which these keep true by
+ * changing that value with the k_mutex lock held.
+ */
+
+/* Lock the k_mutex on behalf of the thread owning the sys_mutex from user
+ * mode, as if that thread had locked it itself, and set the sys_mutex value
+ * to Z_SYS_MUTEX_KERNEL. Returns -EAGAIN if the value is no longer owner,
+ * or -EINVAL if the k_mutex is already locked, which a corrupted value can
+ * claim.
+ */
+int z_mutex_lock_for(struct k_mutex *mutex, atomic_t *user_val,
+		     struct k_thread *owner);
+
+/* As k_mutex_lock(), but returns 1 if the sys_mutex value is not, or no
+ * longer, Z_SYS_MUTEX_KERNEL.
+ */
+int z_mutex_lock_user(struct k_mutex *mutex, atomic_t *user_val,
+		      k_timeout_t timeout);
+
+/* As k_mutex_unlock(), setting the sys_mutex value to Z_SYS_MUTEX_UNLOCKED
+ * if the k_mutex gets unlocked.
+ */
+int z_mutex_unlock_user(struct k_mutex *mutex, atomic_t *user_val);
 #endif /* CONFIG_USERSPACE */
 
 #ifdef CONFIG_GDBSTUB
@@ -223,6 +248,14 @@ void z_mem_manage_boot_finish(void);
 
 void z_handle_obj_poll_events(sys_dlist_t *events, uint32_t state);
 
+#ifdef CONFIG_TIMER_CPU_EXPIRY
+/* Runs the expiry functions of the timers bound to the current CPU
+ * that expired while the tick was announced on another CPU.  Called
+ * from the scheduler IPI.
+ */
+void z_timer_cpu_expiry(void);
+#endif /* CONFIG_TIMER_CPU_EXPIRY */
+
 #ifdef CONFIG_PM
 
 /* When the kernel is about to go idle, it calls this function to notify the
@@ -247,6 +280,8 @@ bool pm_system_suspend(int32_t ticks);
 #endif /* CONFIG_PM */
 
 #ifdef CONFIG_DEMAND_PAGING_TIMING_HISTOGRAM
+struct k_mem_paging_histogram_t;
+
 /**
  * Initialize the timing histograms for demand paging.
  */
@@ -262,6 +297,27 @@ void z_paging_histogram_inc(struct k_mem_paging_histogram_t *hist,
 			    uint32_t cycles);
 #endif /* CONFIG_DEMAND_PAGING_TIMING_HISTOGRAM */
 
+#ifdef CONFIG_INIT_PROFILING
+struct init_entry;
+
+/**
+ * Record the run of an init entry.
+ *
+ * @param entry Init entry that was run.
+ * @param level Init level ordinal.
+ * @param measured Whether the init function was measured.
+ * @param cycles Timing cycles taken by the init function, if measured.
+ * @param result Value returned by the init function.
+ */
+void z_init_profile_record(const struct init_entry *entry, int level,
+			   bool measured, uint64_t cycles, int result);
+
+/**
+ * Log and print the measured init entries, as configured.
+ */
+void z_init_profile_report(void);
+#endif /* CONFIG_INIT_PROFILING */
+
 #ifdef CONFIG_OBJ_CORE_STATS_THREAD
 int z_thread_stats_raw(struct k_obj_core *obj_core, void *stats);
 int z_thread_stats_query(struct k_obj_core *obj_core, void *stats);
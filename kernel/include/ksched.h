@@ -60,6 +60,8 @@ void z_reschedule(struct k_spinlock *lock, k_spinlock_key_t key);
 void z_reschedule_irqlock(uint32_t key);
 void z_unpend_thread(struct k_thread *thread);
 int z_unpend_all(_wait_q_t *wait_q);
+/* Moves up to count threads from one wait queue to another, still pending */
+unsigned int z_waitq_requeue(_wait_q_t *from, _wait_q_t *to, unsigned int count);
 bool z_thread_prio_set(struct k_thread *thread, int prio);
 void *z_get_next_switch_handle(void *interrupted);
 
@@ -73,6 +75,7 @@ struct k_thread *z_swap_next_thread(void);
 void z_thread_abort(struct k_thread *thread);
 void move_thread_to_end_of_prio_q(struct k_thread *thread);
 bool thread_is_sliceable(struct k_thread *thread);
+struct _cpu *thread_active_elsewhere(struct k_thread *thread);
 
 static inline void z_reschedule_unlocked(void)
 {
@@ -340,6 +343,15 @@ void z_sched_cpu_usage(uint8_t core_id, struct k_thread_runtime_stats *stats);
 void z_sched_thread_usage(struct k_thread *thread,
 			  struct k_thread_runtime_stats *stats);
 
+#ifdef CONFIG_SCHED_THREAD_USAGE_HISTOGRAM
+/**
+ * @brief Marks the time a thread is made ready, for the latency histograms
+ */
+void z_sched_usage_ready(struct k_thread *thread);
+#else
+#define z_sched_usage_ready(thread) do { } while (false)
+#endif /* CONFIG_SCHED_THREAD_USAGE_HISTOGRAM */
+
 static inline void z_sched_usage_switch(struct k_thread *thread)
 {
 	ARG_UNUSED(thread);
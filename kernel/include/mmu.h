@@ -328,10 +328,17 @@ void k_mem_page_frames_dump(void);
  * @brief Reserve space at the end of virtual memory.
  */
 #ifdef CONFIG_DEMAND_PAGING
+#ifdef CONFIG_DEMAND_PAGING_READ_AHEAD
+/* Faulting data page plus the data pages read ahead */
+#define K_MEM_SCRATCH_BATCH_PAGES	(CONFIG_DEMAND_PAGING_READ_AHEAD_PAGES + 1)
+#else
+#define K_MEM_SCRATCH_BATCH_PAGES	0
+#endif /* CONFIG_DEMAND_PAGING_READ_AHEAD */
+
 /* We reserve a virtual page as a scratch area for page-ins/outs at the end
- * of the address space
+ * of the address space, preceded by the scratch area for batched page-ins
  */
-#define K_MEM_VM_RESERVED	CONFIG_MMU_PAGE_SIZE
+#define K_MEM_VM_RESERVED	((K_MEM_SCRATCH_BATCH_PAGES + 1) * CONFIG_MMU_PAGE_SIZE)
 
 /**
  * @brief Location of the scratch page used for demand paging.
@@ -339,6 +346,14 @@ void k_mem_page_frames_dump(void);
 #define K_MEM_SCRATCH_PAGE	((void *)((uintptr_t)CONFIG_KERNEL_VM_BASE + \
 					  (uintptr_t)CONFIG_KERNEL_VM_SIZE - \
 					  CONFIG_MMU_PAGE_SIZE))
+
+/**
+ * @brief Location of the scratch area used for batched page-ins.
+ *
+ * This holds K_MEM_SCRATCH_BATCH_PAGES pages.
+ */
+#define K_MEM_SCRATCH_BATCH	((void *)((uintptr_t)K_MEM_SCRATCH_PAGE - \
+					  K_MEM_SCRATCH_BATCH_PAGES * CONFIG_MMU_PAGE_SIZE))
 #else
 #define K_MEM_VM_RESERVED	0
 #endif /* CONFIG_DEMAND_PAGING */
@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_KERNEL_INCLUDE_TIMEOUT_WHEEL_H_
+#define ZEPHYR_KERNEL_INCLUDE_TIMEOUT_WHEEL_H_
+
+/**
+ * @file
+ * @brief Hierarchical timing wheel backend of the timeout queue
+ *
+ * Internal to timeout.c, which owns the lock and the current tick.
+ * Timeouts are stored with their absolute expiry tick in
+ * struct _timeout::dticks.  All functions must be called with the
+ * timeout lock held, with @a now being the kernel's current tick.
+ */
+
+#include <zephyr/kernel.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Add a timeout to the wheel
+ *
+ * @param to Timeout, with @c dticks set to its absolute expiry tick
+ * @param now Current tick
+ * @return Tick at which the wheel will next need servicing because of
+ *         this timeout (its expiry, or an earlier cascade point)
+ */
+uint64_t z_timeout_wheel_add(struct _timeout *to, uint64_t now);
+
+/**
+ * @brief Remove a pending timeout from the wheel
+ *
+ * @param to Timeout, which must be linked into the wheel
+ */
+void z_timeout_wheel_remove(struct _timeout *to);
+
+/**
+ * @brief Tick at which the wheel next needs servicing
+ *
+ * This is either the expiry of the earliest timeout, or an earlier
+ * tick at which timeouts of an upper level must be cascaded down.
+ *
+ * @param now Current tick
+ * @return The tick (never before @a now), or UINT64_MAX if empty
+ */
+uint64_t z_timeout_wheel_next(uint64_t now);
+
+/**
+ * @brief Service the wheel at the current tick
+ *
+ * Cascades any upper level slots that have come due and then unlinks
+ * and returns one expired timeout.  To be called repeatedly at each
+ * tick returned by z_timeout_wheel_next() until it returns NULL.
+ *
+ * @param now Current tick
+ * @return An expired timeout, or NULL if none is left at @a now
+ */
+struct _timeout *z_timeout_wheel_expire(uint64_t now);
+
+/**
+ * @brief Move the wheel to a new current tick
+ *
+ * Re-hashes all pending timeouts after the current tick has been
+ * changed arbitrarily, keeping their remaining time unchanged.
+ *
+ * @param old_now Current tick the wheel was used with so far
+ * @param new_now New current tick
+ */
+void z_timeout_wheel_rebase(uint64_t old_now, uint64_t new_now);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_KERNEL_INCLUDE_TIMEOUT_WHEEL_H_ */
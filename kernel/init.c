@@ -333,6 +333,204 @@ static int do_device_init(const struct init_entry *entry)
 	return rc;
 }
 
+static void init_entry_run(const struct init_entry *entry,
+			   enum init_level level)
+{
+	const struct device *dev = entry->dev;
+	int result;
+#ifdef CONFIG_INIT_PROFILING
+	/* The timing functions are started after the PRE_KERNEL_2 level,
+	 * once the system timer driver they may rely on is initialized.
+	 */
+	bool measured = level > INIT_LEVEL_PRE_KERNEL_2;
+	timing_t start = 0;
+	timing_t end = 0;
+#endif /* CONFIG_INIT_PROFILING */
+
+	sys_trace_sys_init_enter(entry, level);
+#ifdef CONFIG_INIT_PROFILING
+	if (measured) {
+		start = timing_counter_get();
+	}
+#endif /* CONFIG_INIT_PROFILING */
+	if (dev != NULL) {
+		result = do_device_init(entry);
+	} else {
+		result = entry->init_fn.sys();
+	}
+#ifdef CONFIG_INIT_PROFILING
+	if (measured) {
+		end = timing_counter_get();
+	}
+	z_init_profile_record(entry, level, measured,
+			      measured ? timing_cycles_get(&start, &end) : 0U,
+			      result);
+#endif /* CONFIG_INIT_PROFILING */
+	sys_trace_sys_init_exit(entry, level, result);
+}
+
+#ifdef CONFIG_DEVICE_INIT_PARALLEL
+/*
+ * Parallel device initialization
+ *
+ * Consecutive init entries of devicetree devices form a batch. The
+ * entries of a batch are run by the calling thread and by worker threads
+ * in any order that respects the devicetree dependencies between them,
+ * so each entry only waits for the earlier entries of its batch that its
+ * device requires. Any other init entry is run on its own, after all the
+ * entries before it and before any entry after it, as it would be
+ * serially.
+ */
+
+/* Larger runs of devices are split into several batches */
+#define INIT_BATCH_MAX 32
+
+BUILD_ASSERT(INIT_BATCH_MAX <= 32, "batch entries are tracked in 32-bit masks");
+
+static K_KERNEL_STACK_ARRAY_DEFINE(init_worker_stacks,
+				   CONFIG_DEVICE_INIT_PARALLEL_THREADS,
+				   CONFIG_DEVICE_INIT_PARALLEL_STACK_SIZE);
+static struct k_thread init_worker_threads[CONFIG_DEVICE_INIT_PARALLEL_THREADS];
+
+static struct {
+	struct k_mutex lock;
+	struct k_condvar progress;
+	const struct init_entry *entries;
+	enum init_level level;
+	/* Batch entries that each entry has to wait for */
+	uint32_t deps[INIT_BATCH_MAX];
+	uint32_t all;
+	uint32_t started;
+	uint32_t done;
+} init_batch;
+
+static bool init_entry_is_dt_device(const struct init_entry *entry)
+{
+	/* Only devicetree devices have their dependencies recorded */
+	return (entry->dev != NULL) && (entry->dev->dt_meta != NULL);
+}
+
+static size_t init_batch_size(const struct init_entry *entry,
+			      const struct init_entry *end)
+{
+	size_t count = 0;
+
+	while ((entry < end) && (count < INIT_BATCH_MAX) &&
+	       init_entry_is_dt_device(entry)) {
+		entry++;
+		count++;
+	}
+
+	return count;
+}
+
+static uint32_t init_batch_deps(size_t index, const device_handle_t *handles,
+				size_t count)
+{
+	uint32_t deps = 0U;
+
+	for (size_t i = 0; (handles != NULL) && (i < count); i++) {
+		const struct device *dep = device_from_handle(handles[i]);
+
+		/* Dependencies outside of the batch are already initialized,
+		 * or come later in the init order as they would serially.
+		 */
+		for (size_t j = 0; j < index; j++) {
+			if (init_batch.entries[j].dev == dep) {
+				deps |= BIT(j);
+			}
+		}
+	}
+
+	return deps;
+}
+
+static void init_batch_work(void)
+{
+	size_t i;
+
+	k_mutex_lock(&init_batch.lock, K_FOREVER);
+
+	while (init_batch.done != init_batch.all) {
+		/* Pick the first runnable entry, in init order */
+		for (i = 0; i < INIT_BATCH_MAX; i++) {
+			if (((init_batch.all & ~init_batch.started & BIT(i)) != 0U) &&
+			    ((init_batch.deps[i] & ~init_batch.done) == 0U)) {
+				break;
+			}
+		}
+
+		if (i == INIT_BATCH_MAX) {
+			(void)k_condvar_wait(&init_batch.progress,
+					     &init_batch.lock, K_FOREVER);
+			continue;
+		}
+
+		init_batch.started |= BIT(i);
+		k_mutex_unlock(&init_batch.lock);
+
+		init_entry_run(&init_batch.entries[i], init_batch.level);
+
+		k_mutex_lock(&init_batch.lock, K_FOREVER);
+		init_batch.done |= BIT(i);
+		(void)k_condvar_broadcast(&init_batch.progress);
+	}
+
+	k_mutex_unlock(&init_batch.lock);
+}
+
+static void init_worker_entry(void *p1, void *p2, void *p3)
+{
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	init_batch_work();
+}
+
+static void init_batch_run(const struct init_entry *entries, size_t count,
+			   enum init_level level)
+{
+	size_t num_workers = MIN(count - 1, CONFIG_DEVICE_INIT_PARALLEL_THREADS);
+	int prio = k_thread_priority_get(k_current_get());
+	const device_handle_t *handles;
+	size_t num_handles = 0;
+
+	k_mutex_init(&init_batch.lock);
+	k_condvar_init(&init_batch.progress);
+	init_batch.entries = entries;
+	init_batch.level = level;
+	/* BIT_MASK() would shift by the width of the type for a full batch */
+	init_batch.all = (count < 32U) ? BIT_MASK(count) : UINT32_MAX;
+	init_batch.started = 0U;
+	init_batch.done = 0U;
+
+	for (size_t i = 0; i < count; i++) {
+		const struct device *dev = entries[i].dev;
+
+		handles = device_required_handles_get(dev, &num_handles);
+		init_batch.deps[i] = init_batch_deps(i, handles, num_handles);
+
+		handles = device_injected_handles_get(dev, &num_handles);
+		init_batch.deps[i] |= init_batch_deps(i, handles, num_handles);
+	}
+
+	for (size_t w = 0; w < num_workers; w++) {
+		k_thread_create(&init_worker_threads[w], init_worker_stacks[w],
+				K_KERNEL_STACK_SIZEOF(init_worker_stacks[w]),
+				init_worker_entry, NULL, NULL, NULL,
+				prio, 0, K_NO_WAIT);
+		k_thread_name_set(&init_worker_threads[w], "device_init");
+	}
+
+	init_batch_work();
+
+	for (size_t w = 0; w < num_workers; w++) {
+		(void)k_thread_join(&init_worker_threads[w], K_FOREVER);
+	}
+}
+#endif /* CONFIG_DEVICE_INIT_PARALLEL */
+
 /**
  * @brief Execute all the init entry initialization functions at a given level
  *
@@ -361,16 +559,20 @@ static void z_sys_init_run_level(enum init_level level)
 	const struct init_entry *entry;
 
 	for (entry = levels[level]; entry < levels[level+1]; entry++) {
-		const struct device *dev = entry->dev;
-		int result;
-
-		sys_trace_sys_init_enter(entry, level);
-		if (dev != NULL) {
-			result = do_device_init(entry);
-		} else {
-			result = entry->init_fn.sys();
+#ifdef CONFIG_DEVICE_INIT_PARALLEL
+		/* Threads can only be used once the kernel is up */
+		if (level >= INIT_LEVEL_POST_KERNEL) {
+			size_t count = init_batch_size(entry, levels[level+1]);
+
+			if (count > 1) {
+				init_batch_run(entry, count, level);
+				entry += count - 1;
+				continue;
+			}
 		}
-		sys_trace_sys_init_exit(entry, level, result);
+#endif /* CONFIG_DEVICE_INIT_PARALLEL */
+
+		init_entry_run(entry, level);
 	}
 }
 
@@ -552,6 +754,10 @@ static void bg_thread_main(void *unused1, void *unused2, void *unused3)
 	z_mem_manage_boot_finish();
 #endif /* CONFIG_MMU */
 
+#ifdef CONFIG_INIT_PROFILING
+	z_init_profile_report();
+#endif /* CONFIG_INIT_PROFILING */
+
 #ifdef CONFIG_BOOTARGS
 	extern int main(int, char **);
 
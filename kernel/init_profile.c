@@ -0,0 +1,192 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/device.h>
+#include <zephyr/init.h>
+#include <zephyr/sys/printk.h>
+#include <zephyr/timing/timing.h>
+#include <zephyr/logging/log.h>
+#include <kernel_internal.h>
+
+LOG_MODULE_DECLARE(os, CONFIG_KERNEL_LOG_LEVEL);
+
+extern const struct init_entry __init_start[];
+extern const struct init_entry __init_end[];
+
+struct init_record {
+	uint64_t cycles;
+	int result;
+	uint8_t level;
+	bool valid;
+	bool measured;
+};
+
+/* Indexed by the position of the init entry in init order */
+static struct init_record init_records[CONFIG_INIT_PROFILING_MAX_ENTRIES];
+
+static const char *const init_level_names[] = {
+	"EARLY",
+	"PRE_KERNEL_1",
+	"PRE_KERNEL_2",
+	"POST_KERNEL",
+	"APPLICATION",
+	"SMP",
+};
+
+static size_t init_records_count(void)
+{
+	return MIN(__init_end - __init_start, ARRAY_SIZE(init_records));
+}
+
+void z_init_profile_record(const struct init_entry *entry, int level,
+			   bool measured, uint64_t cycles, int result)
+{
+	size_t index = entry - __init_start;
+
+	if (index >= ARRAY_SIZE(init_records)) {
+		return;
+	}
+
+	/* Each entry is only run once, even with parallel initialization */
+	init_records[index].cycles = cycles;
+	init_records[index].result = result;
+	init_records[index].level = (uint8_t)level;
+	init_records[index].measured = measured;
+	init_records[index].valid = true;
+}
+
+static void init_profile_get(size_t index, struct sys_init_profile *profile)
+{
+	const struct init_entry *entry = &__init_start[index];
+
+	profile->entry = entry;
+	profile->name = (entry->dev != NULL) ? entry->dev->name : entry->name;
+	profile->duration_ns = timing_cycles_to_ns(init_records[index].cycles);
+	profile->result = init_records[index].result;
+	profile->level = init_records[index].level;
+	profile->measured = init_records[index].measured;
+}
+
+const char *sys_init_level_name(int level)
+{
+	if ((level < 0) || (level >= ARRAY_SIZE(init_level_names))) {
+		return "unknown";
+	}
+
+	return init_level_names[level];
+}
+
+void sys_init_profile_foreach(sys_init_profile_cb_t cb, void *user_data)
+{
+	struct sys_init_profile profile;
+
+	for (size_t i = 0; i < init_records_count(); i++) {
+		if (!init_records[i].valid) {
+			continue;
+		}
+
+		init_profile_get(i, &profile);
+		if (!cb(&profile, user_data)) {
+			break;
+		}
+	}
+}
+
+/* Whether entry a ranks before entry b: slower, or as slow and earlier */
+static bool init_record_ranks_before(size_t a, size_t b)
+{
+	if (init_records[a].cycles != init_records[b].cycles) {
+		return init_records[a].cycles > init_records[b].cycles;
+	}
+
+	return a < b;
+}
+
+void sys_init_profile_foreach_ranked(sys_init_profile_cb_t cb, void *user_data)
+{
+	struct sys_init_profile profile;
+	size_t count = init_records_count();
+	size_t prev = count;
+	size_t next;
+
+	/* Selecting each entry in turn needs no memory to sort them, and
+	 * there are few enough entries for it to be fast.
+	 */
+	do {
+		next = count;
+
+		for (size_t i = 0; i < count; i++) {
+			if (!init_records[i].valid || !init_records[i].measured ||
+			    ((prev != count) && !init_record_ranks_before(prev, i))) {
+				continue;
+			}
+
+			if ((next == count) || init_record_ranks_before(i, next)) {
+				next = i;
+			}
+		}
+
+		if (next == count) {
+			break;
+		}
+
+		init_profile_get(next, &profile);
+		prev = next;
+	} while (cb(&profile, user_data));
+}
+
+#ifdef CONFIG_INIT_PROFILING_LOG
+static bool init_profile_log(const struct sys_init_profile *profile,
+			     void *user_data)
+{
+	int *remaining = user_data;
+
+	LOG_INF("%-12s %-32s %8llu us (%d)", sys_init_level_name(profile->level),
+		profile->name, profile->duration_ns / NSEC_PER_USEC,
+		profile->result);
+
+	return --(*remaining) > 0;
+}
+#endif /* CONFIG_INIT_PROFILING_LOG */
+
+#ifdef CONFIG_INIT_PROFILING_EXPORT
+static bool init_profile_export(const struct sys_init_profile *profile,
+				void *user_data)
+{
+	ARG_UNUSED(user_data);
+
+	if (!profile->measured) {
+		printk("init_profile,%s,%s,,%d\n", sys_init_level_name(profile->level),
+		       profile->name, profile->result);
+		return true;
+	}
+
+	printk("init_profile,%s,%s,%llu,%d\n", sys_init_level_name(profile->level),
+	       profile->name, profile->duration_ns, profile->result);
+
+	return true;
+}
+#endif /* CONFIG_INIT_PROFILING_EXPORT */
+
+void z_init_profile_report(void)
+{
+#ifdef CONFIG_INIT_PROFILING_LOG
+	int remaining = CONFIG_INIT_PROFILING_LOG_COUNT;
+
+	LOG_INF("Slowest init entries:");
+	sys_init_profile_foreach_ranked(init_profile_log, &remaining);
+
+	if (__init_end - __init_start > ARRAY_SIZE(init_records)) {
+		LOG_WRN("%zu init entries not measured",
+			(size_t)(__init_end - __init_start) - ARRAY_SIZE(init_records));
+	}
+#endif /* CONFIG_INIT_PROFILING_LOG */
+
+#ifdef CONFIG_INIT_PROFILING_EXPORT
+	sys_init_profile_foreach(init_profile_export, NULL);
+#endif /* CONFIG_INIT_PROFILING_EXPORT */
+}
@@ -25,6 +25,25 @@ void flag_ipi(uint32_t ipi_mask)
 /* Create a bitmask of CPUs that need an IPI. Note: sched_spinlock is held. */
 atomic_val_t ipi_mask_create(struct k_thread *thread)
 {
+#ifdef CONFIG_SCHED_WORK_STEALING
+	/* With per-CPU ready queues the thread sits in exactly one
+	 * CPU's queue, so at most that CPU needs to be interrupted.
+	 * Other CPUs find it by stealing when they next reschedule.
+	 */
+	uint32_t  target = thread->base.runq_cpu;
+	struct k_thread *target_thread = _kernel.cpus[target].current;
+
+	if ((target == _current_cpu->id) || (target_thread == NULL)) {
+		return 0;
+	}
+
+	if (((z_sched_prio_cmp(target_thread, thread) < 0) &&
+	     thread_is_preemptible(target_thread)) || thread_is_metairq(thread)) {
+		return (atomic_val_t)IPI_CPU_MASK(target);
+	}
+
+	return 0;
+#else
 	if (!IS_ENABLED(CONFIG_IPI_OPTIMIZE)) {
 		return (CONFIG_MP_MAX_NUM_CPUS > 1) ? IPI_ALL_CPUS_MASK : 0;
 	}
@@ -64,6 +83,7 @@ atomic_val_t ipi_mask_create(struct k_thread *thread)
 	}
 
 	return (atomic_val_t)ipi_mask;
+#endif /* CONFIG_SCHED_WORK_STEALING */
 }
 
 void signal_pending_ipi(void)
@@ -105,4 +125,8 @@ void z_sched_ipi(void)
 		z_time_slice();
 	}
 #endif /* CONFIG_TIMESLICING */
+
+#ifdef CONFIG_TIMER_CPU_EXPIRY
+	z_timer_cpu_expiry();
+#endif /* CONFIG_TIMER_CPU_EXPIRY */
 }
@@ -8,15 +8,219 @@
 #include <zephyr/init.h>
 #include <zephyr/linker/linker-defs.h>
 #include <zephyr/sys/iterable_sections.h>
+#include <zephyr/sys/math_extras.h>
+#include <string.h>
 /* private kernel APIs */
 #include <ksched.h>
 #include <wait_q.h>
 
+#ifdef CONFIG_KERNEL_HEAP_CACHE
+
+/* Per-CPU caches of free small blocks.
+ *
+ * Each CPU has a stack of free blocks per power-of-two size class in
+ * every heap.  Small allocations and frees only take the lock of the
+ * current CPU's cache, which other CPUs only take when they need to
+ * empty all caches after an allocation from the heap itself failed.
+ * When a cache runs empty or full, half of its depth is moved from or
+ * to the heap at once, under a single acquisition of the heap lock.
+ *
+ * The cache lock is always taken before the heap lock.
+ *
+ * Threads that may wait for memory count themselves in cache_waiters
+ * before emptying the caches, and blocks are not cached while it is
+ * non-zero.  As the count is checked under the cache lock, a block is
+ * either returned by that emptying or freed to the heap, waking them.
+ */
+
+#define CACHE_MIN_SHIFT 4
+#define CACHE_CLASSES   Z_HEAP_CACHE_CLASSES
+#define CACHE_DEPTH     CONFIG_KERNEL_HEAP_CACHE_DEPTH
+#define CACHE_BATCH     (CACHE_DEPTH / 2)
+
+BUILD_ASSERT(IS_POWER_OF_TWO(CONFIG_KERNEL_HEAP_CACHE_MAX_SIZE),
+	     "CONFIG_KERNEL_HEAP_CACHE_MAX_SIZE must be a power of two");
+BUILD_ASSERT(CACHE_DEPTH <= UINT8_MAX);
+
+static inline size_t cache_class_size(int cls)
+{
+	return BIT(CACHE_MIN_SHIFT + cls);
+}
+
+/* Size class serving an allocation, or -1 if it is not cached. */
+static int cache_alloc_class(size_t align, size_t bytes)
+{
+	/* Cached blocks have the heap's natural alignment.  The align
+	 * argument may also carry a rewind value, see
+	 * sys_heap_aligned_alloc(), in which case it isn't a power of two.
+	 */
+	if (((align & (align - 1)) != 0U) || (align > sizeof(void *)) ||
+	    (bytes == 0U) || (bytes > CONFIG_KERNEL_HEAP_CACHE_MAX_SIZE)) {
+		return -1;
+	}
+
+	if (bytes <= BIT(CACHE_MIN_SHIFT)) {
+		return 0;
+	}
+
+	return (32 - u32_count_leading_zeros(bytes - 1U)) - CACHE_MIN_SHIFT;
+}
+
+/* Size class a freed block can serve, or -1 if it is not cached. */
+static int cache_free_class(struct k_heap *heap, void *mem)
+{
+	size_t usable = sys_heap_usable_size(&heap->heap, mem);
+	int cls;
+
+	if ((usable < BIT(CACHE_MIN_SHIFT)) || (usable > UINT32_MAX)) {
+		return -1;
+	}
+
+	cls = (31 - u32_count_leading_zeros(usable)) - CACHE_MIN_SHIFT;
+
+	return (cls < CACHE_CLASSES) ? cls : -1;
+}
+
+/* Lock the cache of the current CPU.
+ *
+ * Interrupts are masked before selecting the cache, so that the thread
+ * can't migrate to another CPU in between.
+ */
+static struct z_heap_cache *cache_lock(struct k_heap *heap, unsigned int *irq,
+				       k_spinlock_key_t *key)
+{
+	struct z_heap_cache *cache;
+
+	*irq = arch_irq_lock();
+	cache = &heap->cache[_current_cpu->id];
+	*key = k_spin_lock(&cache->lock);
+
+	return cache;
+}
+
+static void cache_unlock(struct z_heap_cache *cache, unsigned int irq,
+			 k_spinlock_key_t key)
+{
+	k_spin_unlock(&cache->lock, key);
+	arch_irq_unlock(irq);
+}
+
+static void *cache_alloc(struct k_heap *heap, int cls)
+{
+	unsigned int irq;
+	k_spinlock_key_t key;
+	struct z_heap_cache *cache = cache_lock(heap, &irq, &key);
+	void **blocks = cache->blocks[cls];
+	void *ret = NULL;
+
+	if (cache->count[cls] == 0U) {
+		K_SPINLOCK(&heap->lock) {
+			while (cache->count[cls] < CACHE_BATCH) {
+				void *mem = sys_heap_alloc(&heap->heap,
+							   cache_class_size(cls));
+
+				if (mem == NULL) {
+					break;
+				}
+				blocks[cache->count[cls]++] = mem;
+			}
+		}
+	}
+
+	if (cache->count[cls] > 0U) {
+		ret = blocks[--cache->count[cls]];
+	}
+
+	cache_unlock(cache, irq, key);
+
+	return ret;
+}
+
+static bool cache_free(struct k_heap *heap, void *mem)
+{
+	if (mem == NULL) {
+		return false;
+	}
+
+	int cls = cache_free_class(heap, mem);
+
+	if (cls < 0) {
+		return false;
+	}
+
+	unsigned int irq;
+	k_spinlock_key_t key;
+	struct z_heap_cache *cache = cache_lock(heap, &irq, &key);
+	void **blocks = cache->blocks[cls];
+
+	/* Threads waiting for memory need it back in the heap */
+	if (atomic_get(&heap->cache_waiters) != 0) {
+		cache_unlock(cache, irq, key);
+		return false;
+	}
+
+	if (cache->count[cls] == CACHE_DEPTH) {
+		/* Return the least recently freed ones */
+		K_SPINLOCK(&heap->lock) {
+			for (int i = 0; i < CACHE_BATCH; i++) {
+				sys_heap_free(&heap->heap, blocks[i]);
+			}
+		}
+		memmove(&blocks[0], &blocks[CACHE_BATCH],
+			(CACHE_DEPTH - CACHE_BATCH) * sizeof(blocks[0]));
+		cache->count[cls] -= CACHE_BATCH;
+	}
+
+	blocks[cache->count[cls]++] = mem;
+
+	cache_unlock(cache, irq, key);
+
+	return true;
+}
+
+/* Return the blocks of all caches of a heap to the heap.
+ *
+ * Invoked without the heap lock held.
+ *
+ * @return true if any block was returned
+ */
+static bool cache_drain(struct k_heap *heap)
+{
+	bool drained = false;
+
+	for (int cpu = 0; cpu < CONFIG_MP_MAX_NUM_CPUS; cpu++) {
+		struct z_heap_cache *cache = &heap->cache[cpu];
+
+		k_spinlock_key_t cache_key = k_spin_lock(&cache->lock);
+		k_spinlock_key_t key = k_spin_lock(&heap->lock);
+
+		for (int cls = 0; cls < CACHE_CLASSES; cls++) {
+			while (cache->count[cls] > 0U) {
+				sys_heap_free(&heap->heap,
+					      cache->blocks[cls][--cache->count[cls]]);
+				drained = true;
+			}
+		}
+
+		k_spin_unlock(&heap->lock, key);
+		k_spin_unlock(&cache->lock, cache_key);
+	}
+
+	return drained;
+}
+
+#endif /* CONFIG_KERNEL_HEAP_CACHE */
+
 void k_heap_init(struct k_heap *heap, void *mem, size_t bytes)
 {
 	z_waitq_init(&heap->wait_q);
 	sys_heap_init(&heap->heap, mem, bytes);
 
+#ifdef CONFIG_KERNEL_HEAP_CACHE
+	memset(heap->cache, 0, sizeof(heap->cache));
+	atomic_clear(&heap->cache_waiters);
+#endif /* CONFIG_KERNEL_HEAP_CACHE */
+
 	SYS_PORT_TRACING_OBJ_INIT(k_heap, heap);
 }
 
@@ -68,6 +272,21 @@ void *k_heap_aligned_alloc(struct k_heap *heap, size_t align, size_t bytes,
 	k_timepoint_t end = sys_timepoint_calc(timeout);
 	void *ret = NULL;
 
+#ifdef CONFIG_KERNEL_HEAP_CACHE
+	int cls = cache_alloc_class(align, bytes);
+	bool drained = false;
+	bool waiter = false;
+
+	if (cls >= 0) {
+		ret = cache_alloc(heap, cls);
+		if (ret != NULL) {
+			SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_heap, aligned_alloc, heap, timeout);
+			SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_heap, aligned_alloc, heap, timeout, ret);
+			return ret;
+		}
+	}
+#endif /* CONFIG_KERNEL_HEAP_CACHE */
+
 	k_spinlock_key_t key = k_spin_lock(&heap->lock);
 
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_heap, aligned_alloc, heap, timeout);
@@ -79,6 +298,25 @@ void *k_heap_aligned_alloc(struct k_heap *heap, size_t align, size_t bytes,
 	while (ret == NULL) {
 		ret = sys_heap_aligned_alloc(&heap->heap, align, bytes);
 
+#ifdef CONFIG_KERNEL_HEAP_CACHE
+		/* The memory may be sitting in the caches */
+		if ((ret == NULL) && !drained) {
+			drained = true;
+			if (IS_ENABLED(CONFIG_MULTITHREADING) &&
+			    !K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+				/* Keep frees out of the caches from now on */
+				atomic_inc(&heap->cache_waiters);
+				waiter = true;
+			}
+			k_spin_unlock(&heap->lock, key);
+			if (cache_drain(heap)) {
+				key = k_spin_lock(&heap->lock);
+				continue;
+			}
+			key = k_spin_lock(&heap->lock);
+		}
+#endif /* CONFIG_KERNEL_HEAP_CACHE */
+
 		if (!IS_ENABLED(CONFIG_MULTITHREADING) ||
 		    (ret != NULL) || K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
 			break;
@@ -99,6 +337,12 @@ void *k_heap_aligned_alloc(struct k_heap *heap, size_t align, size_t bytes,
 		key = k_spin_lock(&heap->lock);
 	}
 
+#ifdef CONFIG_KERNEL_HEAP_CACHE
+	if (waiter) {
+		atomic_dec(&heap->cache_waiters);
+	}
+#endif /* CONFIG_KERNEL_HEAP_CACHE */
+
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_heap, aligned_alloc, heap, timeout, ret);
 
 	k_spin_unlock(&heap->lock, key);
@@ -127,9 +371,25 @@ void *k_heap_realloc(struct k_heap *heap, void *ptr, size_t bytes, k_timeout_t t
 
 	__ASSERT(!arch_is_in_isr() || K_TIMEOUT_EQ(timeout, K_NO_WAIT), "");
 
+#ifdef CONFIG_KERNEL_HEAP_CACHE
+	bool drained = false;
+#endif /* CONFIG_KERNEL_HEAP_CACHE */
+
 	while (ret == NULL) {
 		ret = sys_heap_aligned_realloc(&heap->heap, ptr, sizeof(void *), bytes);
 
+#ifdef CONFIG_KERNEL_HEAP_CACHE
+		if ((ret == NULL) && (bytes != 0U) && !drained) {
+			drained = true;
+			k_spin_unlock(&heap->lock, key);
+			if (cache_drain(heap)) {
+				key = k_spin_lock(&heap->lock);
+				continue;
+			}
+			key = k_spin_lock(&heap->lock);
+		}
+#endif /* CONFIG_KERNEL_HEAP_CACHE */
+
 		if (!IS_ENABLED(CONFIG_MULTITHREADING) ||
 		    (ret != NULL) || K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
 			break;
@@ -148,6 +408,13 @@ void *k_heap_realloc(struct k_heap *heap, void *ptr, size_t bytes, k_timeout_t t
 
 void k_heap_free(struct k_heap *heap, void *mem)
 {
+#ifdef CONFIG_KERNEL_HEAP_CACHE
+	if (cache_free(heap, mem)) {
+		SYS_PORT_TRACING_OBJ_FUNC(k_heap, free, heap);
+		return;
+	}
+#endif /* CONFIG_KERNEL_HEAP_CACHE */
+
 	k_spinlock_key_t key = k_spin_lock(&heap->lock);
 
 	sys_heap_free(&heap->heap, mem);
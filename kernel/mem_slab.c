@@ -18,6 +18,95 @@
 #include <ksched.h>
 #include <wait_q.h>
 
+#ifdef CONFIG_MEM_SLAB_LOCKLESS
+/* The head of a lock-free free list packs the index of the first free
+ * block plus one (0 when the list is empty), a flag set while threads
+ * may be pending on the slab and a tag that changes with every update,
+ * so that a head read before another thread popped and pushed the same
+ * block back fails to compare (ABA). Each free block holds the index
+ * part of the head that followed it when it was pushed.
+ *
+ * There is no double-word CAS, so this is only built on 64-bit targets,
+ * where the tag has 31 bits. A stale head is then only accepted if a
+ * popping thread is preempted between reading the head and its CAS for
+ * exactly a multiple of 2^31 updates of the list, all of them ending
+ * with the same first block.
+ */
+BUILD_ASSERT(ATOMIC_BITS >= 64, "the head tag is too narrow for ABA protection");
+
+#define HEAD_IDX_BITS (ATOMIC_BITS / 2)
+#define HEAD_IDX_MASK ((atomic_val_t)BIT_MASK(HEAD_IDX_BITS))
+#define HEAD_WAITERS  ((atomic_val_t)BIT(HEAD_IDX_BITS))
+#define HEAD_TAG_ONE  ((atomic_val_t)BIT(HEAD_IDX_BITS + 1))
+
+static inline atomic_val_t next_head(atomic_val_t head, atomic_val_t idx)
+{
+	/* Unsigned arithmetic: the tag wraps around */
+	unsigned long tag = ((unsigned long)head & ~(unsigned long)(HEAD_IDX_MASK | HEAD_WAITERS)) +
+			    (unsigned long)HEAD_TAG_ONE;
+
+	return (atomic_val_t)(tag | (unsigned long)idx);
+}
+
+static char *lockless_pop(struct k_mem_slab *slab)
+{
+	atomic_val_t head;
+	atomic_val_t idx;
+	char *block;
+
+	do {
+		head = atomic_get(&slab->free_head);
+		idx = head & HEAD_IDX_MASK;
+		if (idx == 0) {
+			return NULL;
+		}
+
+		/* The block may be taken and written to by another thread
+		 * after the head was read, in which case the tag won't match
+		 * and whatever was read here is thrown away.
+		 */
+		block = slab->buffer + (idx - 1) * slab->info.block_size;
+	} while (!atomic_cas(&slab->free_head, head,
+			     next_head(head, *(volatile atomic_val_t *)block & HEAD_IDX_MASK)));
+
+	atomic_inc(&slab->num_used);
+
+	return block;
+}
+
+/* Fails, leaving the block allocated, while threads may be waiting */
+static bool lockless_push(struct k_mem_slab *slab, void *mem)
+{
+	atomic_val_t idx = ((char *)mem - slab->buffer) / slab->info.block_size + 1;
+	atomic_val_t head;
+
+	/* Counted as free first so that num_used never exceeds num_blocks */
+	atomic_dec(&slab->num_used);
+
+	do {
+		head = atomic_get(&slab->free_head);
+		if ((head & HEAD_WAITERS) != 0) {
+			atomic_inc(&slab->num_used);
+			return false;
+		}
+
+		*(volatile atomic_val_t *)mem = head & HEAD_IDX_MASK;
+	} while (!atomic_cas(&slab->free_head, head, next_head(head, idx)));
+
+	return true;
+}
+
+static inline void sync_num_used(struct k_mem_slab *slab)
+{
+	slab->info.num_used = (uint32_t)atomic_get(&slab->num_used);
+}
+#else
+static inline void sync_num_used(struct k_mem_slab *slab)
+{
+	ARG_UNUSED(slab);
+}
+#endif /* CONFIG_MEM_SLAB_LOCKLESS */
+
 #ifdef CONFIG_OBJ_CORE_MEM_SLAB
 static struct k_obj_type obj_type_mem_slab;
 
@@ -32,6 +121,7 @@ static int k_mem_slab_stats_raw(struct k_obj_core *obj_core, void *stats)
 
 	slab = CONTAINER_OF(obj_core, struct k_mem_slab, obj_core);
 	key = k_spin_lock(&slab->lock);
+	sync_num_used(slab);
 	memcpy(stats, &slab->info, sizeof(slab->info));
 	k_spin_unlock(&slab->lock, key);
 
@@ -48,6 +138,7 @@ static int k_mem_slab_stats_query(struct k_obj_core *obj_core, void *stats)
 
 	slab = CONTAINER_OF(obj_core, struct k_mem_slab, obj_core);
 	key = k_spin_lock(&slab->lock);
+	sync_num_used(slab);
 	ptr->free_bytes = (slab->info.num_blocks - slab->info.num_used) *
 			  slab->info.block_size;
 	ptr->allocated_bytes = slab->info.num_used * slab->info.block_size;
@@ -112,6 +203,21 @@ static int create_free_list(struct k_mem_slab *slab)
 	}
 
 	slab->free_list = NULL;
+
+#ifdef CONFIG_MEM_SLAB_LOCKLESS
+	CHECKIF(slab->info.num_blocks > HEAD_IDX_MASK) {
+		return -EINVAL;
+	}
+
+	p = slab->buffer;
+	for (uint32_t i = 1; i <= slab->info.num_blocks; i++) {
+		*(atomic_val_t *)p = (i < slab->info.num_blocks) ? (atomic_val_t)i + 1 : 0;
+		p += slab->info.block_size;
+	}
+
+	atomic_set(&slab->free_head, (slab->info.num_blocks != 0U) ? 1 : 0);
+	atomic_set(&slab->num_used, 0);
+#else
 	p = slab->buffer + slab->info.block_size * (slab->info.num_blocks - 1);
 
 	while (p >= slab->buffer) {
@@ -119,6 +225,7 @@ static int create_free_list(struct k_mem_slab *slab)
 		slab->free_list = p;
 		p -= slab->info.block_size;
 	}
+#endif /* CONFIG_MEM_SLAB_LOCKLESS */
 	return 0;
 }
 
@@ -218,6 +325,102 @@ static bool slab_ptr_is_good(struct k_mem_slab *slab, const void *ptr)
 	       ((offset % slab->info.block_size) == 0);
 }
 
+#ifdef CONFIG_MEM_SLAB_LOCKLESS
+int k_mem_slab_alloc(struct k_mem_slab *slab, void **mem, k_timeout_t timeout)
+{
+	k_spinlock_key_t key;
+	atomic_val_t head;
+	int result;
+
+	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_mem_slab, alloc, slab, timeout);
+
+	*mem = lockless_pop(slab);
+	if (likely(*mem != NULL)) {
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_mem_slab, alloc, slab, timeout, 0);
+		return 0;
+	}
+
+	if (K_TIMEOUT_EQ(timeout, K_NO_WAIT) || !IS_ENABLED(CONFIG_MULTITHREADING)) {
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_mem_slab, alloc, slab, timeout, -ENOMEM);
+		return -ENOMEM;
+	}
+
+	key = k_spin_lock(&slab->lock);
+
+	/* Flag the (still) empty list before pending, so that whoever
+	 * frees the next block takes the lock and hands it over.
+	 */
+	for (;;) {
+		*mem = lockless_pop(slab);
+		if (*mem != NULL) {
+			k_spin_unlock(&slab->lock, key);
+			SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_mem_slab, alloc, slab, timeout, 0);
+			return 0;
+		}
+
+		head = atomic_get(&slab->free_head);
+		if (((head & HEAD_IDX_MASK) == 0) &&
+		    atomic_cas(&slab->free_head, head, head | HEAD_WAITERS)) {
+			break;
+		}
+	}
+
+	SYS_PORT_TRACING_OBJ_FUNC_BLOCKING(k_mem_slab, alloc, slab, timeout);
+
+	result = z_pend_curr(&slab->lock, key, &slab->wait_q, timeout);
+	if (result == 0) {
+		*mem = arch_current_thread()->base.swap_data;
+	}
+
+	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_mem_slab, alloc, slab, timeout, result);
+
+	return result;
+}
+
+void k_mem_slab_free(struct k_mem_slab *slab, void *mem)
+{
+	struct k_thread *pending_thread;
+	k_spinlock_key_t key;
+
+	if (!slab_ptr_is_good(slab, mem)) {
+		__ASSERT(false, "Invalid memory pointer provided");
+		k_panic();
+		return;
+	}
+
+	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_mem_slab, free, slab);
+
+	if (likely(lockless_push(slab, mem))) {
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_mem_slab, free, slab);
+		return;
+	}
+
+	/* Threads may be waiting. Nobody else can flag the list or pend
+	 * while the lock is held, and the list stays empty while flagged.
+	 */
+	key = k_spin_lock(&slab->lock);
+
+	pending_thread = z_unpend_first_thread(&slab->wait_q);
+	if (z_waitq_head(&slab->wait_q) == NULL) {
+		atomic_and(&slab->free_head, ~HEAD_WAITERS);
+	}
+
+	if (pending_thread != NULL) {
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_mem_slab, free, slab);
+
+		z_thread_return_value_set_with_data(pending_thread, 0, mem);
+		z_ready_thread(pending_thread);
+		z_reschedule(&slab->lock, key);
+		return;
+	}
+
+	(void)lockless_push(slab, mem);
+
+	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_mem_slab, free, slab);
+
+	k_spin_unlock(&slab->lock, key);
+}
+#else
 int k_mem_slab_alloc(struct k_mem_slab *slab, void **mem, k_timeout_t timeout)
 {
 	k_spinlock_key_t key = k_spin_lock(&slab->lock);
@@ -298,6 +501,7 @@ void k_mem_slab_free(struct k_mem_slab *slab, void *mem)
 
 	k_spin_unlock(&slab->lock, key);
 }
+#endif /* CONFIG_MEM_SLAB_LOCKLESS */
 
 int k_mem_slab_runtime_stats_get(struct k_mem_slab *slab, struct sys_memory_stats *stats)
 {
@@ -307,6 +511,7 @@ int k_mem_slab_runtime_stats_get(struct k_mem_slab *slab, struct sys_memory_stat
 
 	k_spinlock_key_t key = k_spin_lock(&slab->lock);
 
+	sync_num_used(slab);
 	stats->allocated_bytes = slab->info.num_used * slab->info.block_size;
 	stats->free_bytes = (slab->info.num_blocks - slab->info.num_used) *
 			    slab->info.block_size;
@@ -1197,6 +1197,7 @@ struct k_mem_paging_stats_t paging_stats;
 extern struct k_mem_paging_histogram_t z_paging_histogram_eviction;
 extern struct k_mem_paging_histogram_t z_paging_histogram_backing_store_page_in;
 extern struct k_mem_paging_histogram_t z_paging_histogram_backing_store_page_out;
+extern struct k_mem_paging_histogram_t z_paging_histogram_page_fault;
 #endif /* CONFIG_DEMAND_PAGING_STATS */
 
 static inline void do_backing_store_page_in(uintptr_t location)
@@ -1275,6 +1276,63 @@ static inline void do_backing_store_page_out(uintptr_t location)
 #endif /* CONFIG_DEMAND_PAGING_TIMING_HISTOGRAM */
 }
 
+#ifdef CONFIG_DEMAND_PAGING_READ_AHEAD
+/*
+ * Page in the given page frames with one backing store request, mapping
+ * them consecutively in the batch scratch area for the time of the request.
+ */
+static void do_backing_store_page_in_batch(struct k_mem_page_frame **pfs,
+					   const uintptr_t *locations, size_t count)
+{
+	uint8_t *scratch = K_MEM_SCRATCH_BATCH;
+
+	if (count == 1) {
+		/* The scratch page may have been used to page out a read ahead
+		 * victim since the faulting page frame was prepared.
+		 */
+		arch_mem_scratch(k_mem_page_frame_to_phys(pfs[0]));
+		do_backing_store_page_in(locations[0]);
+		return;
+	}
+
+	for (size_t i = 0; i < count; i++) {
+		arch_mem_map(scratch + i * CONFIG_MMU_PAGE_SIZE,
+			     k_mem_page_frame_to_phys(pfs[i]), CONFIG_MMU_PAGE_SIZE,
+			     K_MEM_PERM_RW | K_MEM_CACHE_WB);
+	}
+
+#ifdef CONFIG_DEMAND_PAGING_TIMING_HISTOGRAM
+	uint32_t time_diff;
+
+#ifdef CONFIG_DEMAND_PAGING_STATS_USING_TIMING_FUNCTIONS
+	timing_t time_start, time_end;
+
+	time_start = timing_counter_get();
+#else
+	uint32_t time_start;
+
+	time_start = k_cycle_get_32();
+#endif /* CONFIG_DEMAND_PAGING_STATS_USING_TIMING_FUNCTIONS */
+#endif /* CONFIG_DEMAND_PAGING_TIMING_HISTOGRAM */
+
+	k_mem_paging_backing_store_page_in_batch(locations, count);
+
+#ifdef CONFIG_DEMAND_PAGING_TIMING_HISTOGRAM
+#ifdef CONFIG_DEMAND_PAGING_STATS_USING_TIMING_FUNCTIONS
+	time_end = timing_counter_get();
+	time_diff = (uint32_t)timing_cycles_get(&time_start, &time_end);
+#else
+	time_diff = k_cycle_get_32() - time_start;
+#endif /* CONFIG_DEMAND_PAGING_STATS_USING_TIMING_FUNCTIONS */
+
+	z_paging_histogram_inc(&z_paging_histogram_backing_store_page_in,
+			       time_diff);
+#endif /* CONFIG_DEMAND_PAGING_TIMING_HISTOGRAM */
+
+	arch_mem_unmap(scratch, count * CONFIG_MMU_PAGE_SIZE);
+}
+#endif /* CONFIG_DEMAND_PAGING_READ_AHEAD */
+
 #if defined(CONFIG_SMP) && defined(CONFIG_DEMAND_PAGING_ALLOW_IRQ)
 /*
  * SMP support is very simple. Some resources such as the scratch page could
@@ -1304,18 +1362,19 @@ static void virt_region_foreach(void *addr, size_t size,
  * with a call to k_mem_paging_backing_store_page_out() if it contains
  * a data page.
  *
+ * - If mapped, obtain backing store location and populate location parameter
  * - Map page frame to scratch area if requested. This always is true if we're
  *   doing a page fault, but is only set on manual evictions if the page is
  *   dirty.
- * - If mapped:
- *    - obtain backing store location and populate location parameter
- *    - Update page tables with location
+ * - If mapped, update page tables with location
  * - Mark page frame as busy
  *
- * Returns -ENOMEM if the backing store is full
+ * Returns -ENOMEM if the backing store is full, in which case neither the
+ * page frame nor the scratch page mapping have been touched. Nothing is
+ * logged, as speculative callers like read-ahead just give up.
  */
-static int page_frame_prepare_locked(struct k_mem_page_frame *pf, bool *dirty_ptr,
-				     bool page_fault, uintptr_t *location_ptr)
+static int page_frame_try_prepare_locked(struct k_mem_page_frame *pf, bool *dirty_ptr,
+					 bool page_fault, uintptr_t *location_ptr)
 {
 	uintptr_t phys;
 	int ret;
@@ -1340,17 +1399,19 @@ static int page_frame_prepare_locked(struct k_mem_page_frame *pf, bool *dirty_pt
 		dirty = dirty || !k_mem_page_frame_is_backed(pf);
 	}
 
-	if (dirty || page_fault) {
-		arch_mem_scratch(phys);
-	}
-
 	if (k_mem_page_frame_is_mapped(pf)) {
 		ret = k_mem_paging_backing_store_location_get(pf, location_ptr,
 							      page_fault);
 		if (ret != 0) {
-			LOG_ERR("out of backing store memory");
 			return -ENOMEM;
 		}
+	}
+
+	if (dirty || page_fault) {
+		arch_mem_scratch(phys);
+	}
+
+	if (k_mem_page_frame_is_mapped(pf)) {
 		arch_mem_page_out(k_mem_page_frame_to_virt(pf), *location_ptr);
 
 		if (IS_ENABLED(CONFIG_EVICTION_TRACKING)) {
@@ -1374,6 +1435,19 @@ static int page_frame_prepare_locked(struct k_mem_page_frame *pf, bool *dirty_pt
 	return 0;
 }
 
+static int page_frame_prepare_locked(struct k_mem_page_frame *pf, bool *dirty_ptr,
+				     bool page_fault, uintptr_t *location_ptr)
+{
+	int ret;
+
+	ret = page_frame_try_prepare_locked(pf, dirty_ptr, page_fault, location_ptr);
+	if (ret == -ENOMEM) {
+		LOG_ERR("out of backing store memory");
+	}
+
+	return ret;
+}
+
 static int do_mem_evict(void *addr)
 {
 	bool dirty;
@@ -1610,6 +1684,161 @@ static inline struct k_mem_page_frame *do_eviction_select(bool *dirty)
 	return pf;
 }
 
+#ifdef CONFIG_DEMAND_PAGING_READ_AHEAD
+/*
+ * Data pages to page in with one backing store request, starting with the
+ * faulting one. Like the scratch page, these are protected by the
+ * serialization of page faults.
+ */
+static void *read_ahead_addrs[K_MEM_SCRATCH_BATCH_PAGES];
+static struct k_mem_page_frame *read_ahead_pfs[K_MEM_SCRATCH_BATCH_PAGES];
+static uintptr_t read_ahead_locations[K_MEM_SCRATCH_BATCH_PAGES];
+
+/* Address following the last data page paged in */
+static uint8_t *read_ahead_next;
+/* Number of data pages to read ahead on the next sequential page fault */
+static size_t read_ahead_window;
+
+static inline bool read_ahead_location_valid(uintptr_t location)
+{
+#ifdef CONFIG_DEMAND_MAPPING
+	/* Anonymous memory has no content to read from the backing store */
+	return (location != ARCH_UNPAGED_ANON_ZERO) &&
+	       (location != ARCH_UNPAGED_ANON_UNINIT);
+#else
+	ARG_UNUSED(location);
+
+	return true;
+#endif /* CONFIG_DEMAND_MAPPING */
+}
+
+/*
+ * Get page frames for the data pages following a faulting one, if page
+ * faults look sequential, evicting data pages as needed. Called in the same
+ * context as the page-in of the faulting data page, with its page frame
+ * already prepared.
+ *
+ * Returns the number of data pages to page in, including the faulting one.
+ */
+static size_t read_ahead_prepare(void *addr, struct k_mem_page_frame *pf,
+				 uintptr_t location, struct k_thread *faulting_thread,
+				 k_spinlock_key_t *key)
+{
+	uint8_t *page = UINT_TO_POINTER(ROUND_DOWN(POINTER_TO_UINT(addr),
+						   CONFIG_MMU_PAGE_SIZE));
+	uint8_t *pos = page + CONFIG_MMU_PAGE_SIZE;
+	size_t count = 1;
+
+#ifdef CONFIG_DEMAND_PAGING_ALLOW_IRQ
+	*key = k_spin_lock(&z_mm_lock);
+#else
+	ARG_UNUSED(key);
+#endif /* CONFIG_DEMAND_PAGING_ALLOW_IRQ */
+
+	if ((page == read_ahead_next) && read_ahead_location_valid(location)) {
+		read_ahead_window = CLAMP(read_ahead_window * 2, 1,
+					  CONFIG_DEMAND_PAGING_READ_AHEAD_PAGES);
+	} else {
+		read_ahead_window = 0;
+	}
+
+	read_ahead_addrs[0] = page;
+	read_ahead_pfs[0] = pf;
+	read_ahead_locations[0] = location;
+
+	/* Not mapped anymore, so that it is not selected for eviction */
+	k_mem_page_frame_clear(pf, K_MEM_PAGE_FRAME_MAPPED);
+
+	while ((count <= read_ahead_window) && (pos < Z_VIRT_REGION_END_ADDR)) {
+		struct k_mem_page_frame *ra_pf;
+		uintptr_t ra_location, page_out_location;
+		bool dirty = false;
+		bool evicted = false;
+
+		if ((arch_page_location_get(pos, &ra_location) !=
+		     ARCH_PAGE_LOCATION_PAGED_OUT) ||
+		    !read_ahead_location_valid(ra_location)) {
+			break;
+		}
+
+		ra_pf = free_page_frame_list_get();
+		if (ra_pf == NULL) {
+			ra_pf = do_eviction_select(&dirty);
+			if (ra_pf == NULL) {
+				break;
+			}
+			evicted = true;
+		}
+
+		/* Unlike the faulting data page, read ahead ones may not use
+		 * the backing store location reserved for page faults. A victim
+		 * is left untouched if no location is available for it.
+		 */
+		if (page_frame_try_prepare_locked(ra_pf, &dirty, false,
+						  &page_out_location) != 0) {
+			if (!evicted) {
+				free_page_frame_list_put(ra_pf);
+			}
+			break;
+		}
+
+		if (evicted) {
+			paging_stats_eviction_inc(faulting_thread, dirty);
+		}
+		k_mem_page_frame_clear(ra_pf, K_MEM_PAGE_FRAME_MAPPED);
+
+		read_ahead_addrs[count] = pos;
+		read_ahead_pfs[count] = ra_pf;
+		read_ahead_locations[count] = ra_location;
+		count++;
+		pos += CONFIG_MMU_PAGE_SIZE;
+
+		if (dirty) {
+#ifdef CONFIG_DEMAND_PAGING_ALLOW_IRQ
+			k_spin_unlock(&z_mm_lock, *key);
+#endif /* CONFIG_DEMAND_PAGING_ALLOW_IRQ */
+			do_backing_store_page_out(page_out_location);
+#ifdef CONFIG_DEMAND_PAGING_ALLOW_IRQ
+			*key = k_spin_lock(&z_mm_lock);
+#endif /* CONFIG_DEMAND_PAGING_ALLOW_IRQ */
+		}
+	}
+
+	read_ahead_next = pos;
+
+#ifdef CONFIG_DEMAND_PAGING_ALLOW_IRQ
+	k_spin_unlock(&z_mm_lock, *key);
+#endif /* CONFIG_DEMAND_PAGING_ALLOW_IRQ */
+
+	return count;
+}
+
+/* Map the data pages read ahead, once paged in */
+static void read_ahead_finish_locked(size_t count)
+{
+	for (size_t i = 1; i < count; i++) {
+		struct k_mem_page_frame *pf = read_ahead_pfs[i];
+
+#ifdef CONFIG_DEMAND_PAGING_ALLOW_IRQ
+		k_mem_page_frame_clear(pf, K_MEM_PAGE_FRAME_BUSY);
+#endif /* CONFIG_DEMAND_PAGING_ALLOW_IRQ */
+		frame_mapped_set(pf, read_ahead_addrs[i]);
+		arch_mem_page_in(read_ahead_addrs[i], k_mem_page_frame_to_phys(pf));
+		k_mem_paging_backing_store_page_finalize(pf, read_ahead_locations[i]);
+		if (IS_ENABLED(CONFIG_EVICTION_TRACKING)) {
+			k_mem_paging_eviction_add(pf);
+		}
+	}
+
+#ifdef CONFIG_DEMAND_PAGING_STATS
+	if (count > 1) {
+		paging_stats.read_ahead.batches++;
+		paging_stats.read_ahead.pages += count - 1;
+	}
+#endif /* CONFIG_DEMAND_PAGING_STATS */
+}
+#endif /* CONFIG_DEMAND_PAGING_READ_AHEAD */
+
 static bool do_page_fault(void *addr, bool pin)
 {
 	struct k_mem_page_frame *pf;
@@ -1620,12 +1849,27 @@ static bool do_page_fault(void *addr, bool pin)
 	bool dirty = false;
 	struct k_thread *faulting_thread;
 	int ret;
+#ifdef CONFIG_DEMAND_PAGING_READ_AHEAD
+	size_t batch_count;
+#endif /* CONFIG_DEMAND_PAGING_READ_AHEAD */
 
 	__ASSERT(page_frames_initialized, "page fault at %p happened too early",
 		 addr);
 
 	LOG_DBG("page fault at %p", addr);
 
+#ifdef CONFIG_DEMAND_PAGING_TIMING_HISTOGRAM
+#ifdef CONFIG_DEMAND_PAGING_STATS_USING_TIMING_FUNCTIONS
+	timing_t time_start, time_end;
+
+	time_start = timing_counter_get();
+#else
+	uint32_t time_start;
+
+	time_start = k_cycle_get_32();
+#endif /* CONFIG_DEMAND_PAGING_STATS_USING_TIMING_FUNCTIONS */
+#endif /* CONFIG_DEMAND_PAGING_TIMING_HISTOGRAM */
+
 	/*
 	 * TODO: Add performance accounting:
 	 * - k_mem_paging_eviction_select() metrics
@@ -1734,7 +1978,14 @@ static bool do_page_fault(void *addr, bool pin)
 	if (dirty) {
 		do_backing_store_page_out(page_out_location);
 	}
+#ifdef CONFIG_DEMAND_PAGING_READ_AHEAD
+	batch_count = read_ahead_prepare(addr, pf, page_in_location,
+					 faulting_thread, &key);
+	do_backing_store_page_in_batch(read_ahead_pfs, read_ahead_locations,
+				       batch_count);
+#else
 	do_backing_store_page_in(page_in_location);
+#endif /* CONFIG_DEMAND_PAGING_READ_AHEAD */
 
 #ifdef CONFIG_DEMAND_PAGING_ALLOW_IRQ
 	key = k_spin_lock(&z_mm_lock);
@@ -1751,6 +2002,20 @@ static bool do_page_fault(void *addr, bool pin)
 	if (IS_ENABLED(CONFIG_EVICTION_TRACKING) && (!pin)) {
 		k_mem_paging_eviction_add(pf);
 	}
+#ifdef CONFIG_DEMAND_PAGING_READ_AHEAD
+	read_ahead_finish_locked(batch_count);
+#endif /* CONFIG_DEMAND_PAGING_READ_AHEAD */
+
+#ifdef CONFIG_DEMAND_PAGING_TIMING_HISTOGRAM
+#ifdef CONFIG_DEMAND_PAGING_STATS_USING_TIMING_FUNCTIONS
+	time_end = timing_counter_get();
+	z_paging_histogram_inc(&z_paging_histogram_page_fault,
+			       (uint32_t)timing_cycles_get(&time_start, &time_end));
+#else
+	z_paging_histogram_inc(&z_paging_histogram_page_fault,
+			       k_cycle_get_32() - time_start);
+#endif /* CONFIG_DEMAND_PAGING_STATS_USING_TIMING_FUNCTIONS */
+#endif /* CONFIG_DEMAND_PAGING_TIMING_HISTOGRAM */
 out:
 	k_spin_unlock(&z_mm_lock, key);
 #ifdef CONFIG_DEMAND_PAGING_ALLOW_IRQ
@@ -36,6 +36,55 @@ static inline void handle_poll_events(struct k_msgq *msgq, uint32_t state)
 }
 #endif /* CONFIG_POLL */
 
+#ifdef CONFIG_MSGQ_ZERO_COPY
+/* Wakes up the threads waiting to claim messages or free slots, which
+ * check again for what they are waiting for.
+ */
+static inline bool wake_claim_waiters(struct k_msgq *msgq)
+{
+	return z_sched_wake_all(&msgq->claim_wait_q, 0, NULL);
+}
+
+static inline bool put_claimed(struct k_msgq *msgq)
+{
+	return msgq->put_claimed != 0U;
+}
+
+static inline bool get_claimed(struct k_msgq *msgq)
+{
+	return msgq->get_claimed != 0U;
+}
+#else
+static inline bool wake_claim_waiters(struct k_msgq *msgq)
+{
+	ARG_UNUSED(msgq);
+
+	return false;
+}
+
+static inline bool put_claimed(struct k_msgq *msgq)
+{
+	ARG_UNUSED(msgq);
+
+	return false;
+}
+
+static inline bool get_claimed(struct k_msgq *msgq)
+{
+	ARG_UNUSED(msgq);
+
+	return false;
+}
+#endif /* CONFIG_MSGQ_ZERO_COPY */
+
+static inline void advance(struct k_msgq *msgq, char **ptr, uint32_t num_msgs)
+{
+	*ptr += num_msgs * msgq->msg_size;
+	if (*ptr >= msgq->buffer_end) {
+		*ptr -= msgq->buffer_end - msgq->buffer_start;
+	}
+}
+
 void k_msgq_init(struct k_msgq *msgq, char *buffer, size_t msg_size,
 		 uint32_t max_msgs)
 {
@@ -49,6 +98,11 @@ void k_msgq_init(struct k_msgq *msgq, char *buffer, size_t msg_size,
 	msgq->flags = 0;
 	z_waitq_init(&msgq->wait_q);
 	msgq->lock = (struct k_spinlock) {};
+#ifdef CONFIG_MSGQ_ZERO_COPY
+	z_waitq_init(&msgq->claim_wait_q);
+	msgq->put_claimed = 0;
+	msgq->get_claimed = 0;
+#endif /* CONFIG_MSGQ_ZERO_COPY */
 #ifdef CONFIG_POLL
 	sys_dlist_init(&msgq->poll_events);
 #endif	/* CONFIG_POLL */
@@ -110,6 +164,14 @@ int k_msgq_cleanup(struct k_msgq *msgq)
 		return -EBUSY;
 	}
 
+#ifdef CONFIG_MSGQ_ZERO_COPY
+	CHECKIF(z_waitq_head(&msgq->claim_wait_q) != NULL) {
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_msgq, cleanup, msgq, -EBUSY);
+
+		return -EBUSY;
+	}
+#endif /* CONFIG_MSGQ_ZERO_COPY */
+
 	if ((msgq->flags & K_MSGQ_FLAG_ALLOC) != 0U) {
 		k_free(msgq->buffer_start);
 		msgq->flags &= ~K_MSGQ_FLAG_ALLOC;
@@ -133,7 +195,10 @@ int z_impl_k_msgq_put(struct k_msgq *msgq, const void *data, k_timeout_t timeout
 
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_msgq, put, msgq, timeout);
 
-	if (msgq->used_msgs < msgq->max_msgs) {
+	if (unlikely(put_claimed(msgq))) {
+		/* slots claimed by the zero-copy producer come first */
+		result = -EBUSY;
+	} else if (msgq->used_msgs < msgq->max_msgs) {
 		/* message queue isn't full */
 		pending_thread = z_unpend_first_thread(&msgq->wait_q);
 		if (unlikely(pending_thread != NULL)) {
@@ -160,6 +225,7 @@ int z_impl_k_msgq_put(struct k_msgq *msgq, const void *data, k_timeout_t timeout
 #ifdef CONFIG_POLL
 			handle_poll_events(msgq, K_POLL_STATE_MSGQ_DATA_AVAILABLE);
 #endif /* CONFIG_POLL */
+			(void)wake_claim_waiters(msgq);
 		}
 		result = 0;
 	} else if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
@@ -225,7 +291,10 @@ int z_impl_k_msgq_get(struct k_msgq *msgq, void *data, k_timeout_t timeout)
 
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_msgq, get, msgq, timeout);
 
-	if (msgq->used_msgs > 0U) {
+	if (unlikely(get_claimed(msgq))) {
+		/* messages claimed by the zero-copy consumer come first */
+		result = -EBUSY;
+	} else if (msgq->used_msgs > 0U) {
 		/* take first available message from queue */
 		(void)memcpy((char *)data, msgq->read_ptr, msgq->msg_size);
 		msgq->read_ptr += msgq->msg_size;
@@ -260,6 +329,13 @@ int z_impl_k_msgq_get(struct k_msgq *msgq, void *data, k_timeout_t timeout)
 			return 0;
 		}
 		result = 0;
+
+		/* the slot is free for a zero-copy producer */
+		if (unlikely(wake_claim_waiters(msgq))) {
+			SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_msgq, get, msgq, timeout, result);
+			z_reschedule(&msgq->lock, key);
+			return result;
+		}
 	} else if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
 		/* don't wait for a message to become available */
 		result = -ENOMSG;
@@ -293,6 +369,210 @@ static inline int z_vrfy_k_msgq_get(struct k_msgq *msgq, void *data,
 #include <zephyr/syscalls/k_msgq_get_mrsh.c>
 #endif /* CONFIG_USERSPACE */
 
+#ifdef CONFIG_MSGQ_ZERO_COPY
+/* Number of slots from @p ptr up to the end of the ring buffer */
+static inline uint32_t slots_to_end(struct k_msgq *msgq, char *ptr)
+{
+	return (msgq->buffer_end - ptr) / msgq->msg_size;
+}
+
+int k_msgq_put_claim_batch(struct k_msgq *msgq, void **slot, uint32_t max_msgs,
+			   k_timeout_t timeout)
+{
+	__ASSERT(!arch_is_in_isr() || K_TIMEOUT_EQ(timeout, K_NO_WAIT), "");
+
+	k_timepoint_t end = sys_timepoint_calc(timeout);
+	k_spinlock_key_t key = k_spin_lock(&msgq->lock);
+	uint32_t count;
+	int result;
+
+	CHECKIF(max_msgs == 0U) {
+		k_spin_unlock(&msgq->lock, key);
+		return -EINVAL;
+	}
+
+	while (true) {
+		if (msgq->put_claimed != 0U) {
+			result = -EBUSY;
+			break;
+		}
+
+		if (msgq->used_msgs < msgq->max_msgs) {
+			count = MIN(max_msgs, msgq->max_msgs - msgq->used_msgs);
+			count = MIN(count, slots_to_end(msgq, msgq->write_ptr));
+
+			*slot = msgq->write_ptr;
+			msgq->put_claimed = count;
+			result = (int)count;
+			break;
+		}
+
+		if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+			result = -ENOMSG;
+			break;
+		}
+
+		result = z_sched_wait(&msgq->lock, key, &msgq->claim_wait_q,
+				      sys_timepoint_timeout(end), NULL);
+		if (result != 0) {
+			return result;
+		}
+
+		key = k_spin_lock(&msgq->lock);
+	}
+
+	k_spin_unlock(&msgq->lock, key);
+
+	return result;
+}
+
+int k_msgq_put_commit_batch(struct k_msgq *msgq, uint32_t num_msgs)
+{
+	struct k_thread *pending_thread;
+	k_spinlock_key_t key = k_spin_lock(&msgq->lock);
+
+	CHECKIF(num_msgs > msgq->put_claimed) {
+		k_spin_unlock(&msgq->lock, key);
+		return -EINVAL;
+	}
+
+	msgq->put_claimed = 0;
+
+	if (num_msgs == 0U) {
+		k_spin_unlock(&msgq->lock, key);
+		return 0;
+	}
+
+	advance(msgq, &msgq->write_ptr, num_msgs);
+	msgq->used_msgs += num_msgs;
+
+	/* Threads waiting to receive only wait on an empty queue: give
+	 * them the first messages, as k_msgq_put() would have.
+	 */
+	while (msgq->used_msgs > 0U) {
+		pending_thread = z_unpend_first_thread(&msgq->wait_q);
+		if (pending_thread == NULL) {
+			break;
+		}
+
+		(void)memcpy(pending_thread->base.swap_data, msgq->read_ptr,
+			     msgq->msg_size);
+		advance(msgq, &msgq->read_ptr, 1);
+		msgq->used_msgs--;
+
+		arch_thread_return_value_set(pending_thread, 0);
+		z_ready_thread(pending_thread);
+	}
+
+#ifdef CONFIG_POLL
+	if (msgq->used_msgs > 0U) {
+		handle_poll_events(msgq, K_POLL_STATE_MSGQ_DATA_AVAILABLE);
+	}
+#endif /* CONFIG_POLL */
+
+	(void)wake_claim_waiters(msgq);
+
+	z_reschedule(&msgq->lock, key);
+
+	return 0;
+}
+
+int k_msgq_get_claim_batch(struct k_msgq *msgq, void **slot, uint32_t max_msgs,
+			   k_timeout_t timeout)
+{
+	__ASSERT(!arch_is_in_isr() || K_TIMEOUT_EQ(timeout, K_NO_WAIT), "");
+
+	k_timepoint_t end = sys_timepoint_calc(timeout);
+	k_spinlock_key_t key = k_spin_lock(&msgq->lock);
+	uint32_t count;
+	int result;
+
+	CHECKIF(max_msgs == 0U) {
+		k_spin_unlock(&msgq->lock, key);
+		return -EINVAL;
+	}
+
+	while (true) {
+		if (msgq->get_claimed != 0U) {
+			result = -EBUSY;
+			break;
+		}
+
+		if (msgq->used_msgs > 0U) {
+			count = MIN(max_msgs, msgq->used_msgs);
+			count = MIN(count, slots_to_end(msgq, msgq->read_ptr));
+
+			*slot = msgq->read_ptr;
+			msgq->get_claimed = count;
+			result = (int)count;
+			break;
+		}
+
+		if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+			result = -ENOMSG;
+			break;
+		}
+
+		result = z_sched_wait(&msgq->lock, key, &msgq->claim_wait_q,
+				      sys_timepoint_timeout(end), NULL);
+		if (result != 0) {
+			return result;
+		}
+
+		key = k_spin_lock(&msgq->lock);
+	}
+
+	k_spin_unlock(&msgq->lock, key);
+
+	return result;
+}
+
+int k_msgq_get_finish_batch(struct k_msgq *msgq, uint32_t num_msgs)
+{
+	struct k_thread *pending_thread;
+	k_spinlock_key_t key = k_spin_lock(&msgq->lock);
+
+	CHECKIF(num_msgs > msgq->get_claimed) {
+		k_spin_unlock(&msgq->lock, key);
+		return -EINVAL;
+	}
+
+	msgq->get_claimed = 0;
+
+	if (num_msgs == 0U) {
+		k_spin_unlock(&msgq->lock, key);
+		return 0;
+	}
+
+	advance(msgq, &msgq->read_ptr, num_msgs);
+	msgq->used_msgs -= num_msgs;
+
+	/* Threads waiting to send only wait on a full queue: fill the
+	 * freed slots with their messages, as k_msgq_get() would have.
+	 */
+	while (msgq->used_msgs < msgq->max_msgs) {
+		pending_thread = z_unpend_first_thread(&msgq->wait_q);
+		if (pending_thread == NULL) {
+			break;
+		}
+
+		(void)memcpy(msgq->write_ptr, pending_thread->base.swap_data,
+			     msgq->msg_size);
+		advance(msgq, &msgq->write_ptr, 1);
+		msgq->used_msgs++;
+
+		arch_thread_return_value_set(pending_thread, 0);
+		z_ready_thread(pending_thread);
+	}
+
+	(void)wake_claim_waiters(msgq);
+
+	z_reschedule(&msgq->lock, key);
+
+	return 0;
+}
+#endif /* CONFIG_MSGQ_ZERO_COPY */
+
 int z_impl_k_msgq_peek(struct k_msgq *msgq, void *data)
 {
 	k_spinlock_key_t key;
@@ -392,6 +672,12 @@ void z_impl_k_msgq_purge(struct k_msgq *msgq)
 	msgq->used_msgs = 0;
 	msgq->read_ptr = msgq->write_ptr;
 
+#ifdef CONFIG_MSGQ_ZERO_COPY
+	/* claimed messages are gone, claimed slots are still valid */
+	msgq->get_claimed = 0;
+	(void)z_sched_wake_all(&msgq->claim_wait_q, -ENOMSG, NULL);
+#endif /* CONFIG_MSGQ_ZERO_COPY */
+
 	z_reschedule(&msgq->lock, key);
 }
 
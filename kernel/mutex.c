@@ -39,23 +39,81 @@
 #include <zephyr/sys/check.h>
 #include <zephyr/logging/log.h>
 #include <zephyr/llext/symbol.h>
+#include <zephyr/sys/mutex.h>
 LOG_MODULE_DECLARE(os, CONFIG_KERNEL_LOG_LEVEL);
 
 /* We use a global spinlock here because some of the synchronization
  * is protecting things like owner thread priorities which aren't
- * "part of" a single k_mutex.  Should move those bits of the API
- * under the scheduler lock so we can break this up.
+ * "part of" a single k_mutex.  With CONFIG_KERNEL_SYNC_OBJ_LOCKS each
+ * mutex has its own lock instead, and the priority inheritance steps,
+ * which may touch a thread owning several mutexes, are additionally
+ * serialized by prio_lock.  Lock ordering is mutex lock, then
+ * prio_lock.
  */
-static struct k_spinlock lock;
+#ifndef CONFIG_KERNEL_SYNC_OBJ_LOCKS
+static struct k_spinlock global_lock;
+#endif /* !CONFIG_KERNEL_SYNC_OBJ_LOCKS */
+
+#ifdef CONFIG_KERNEL_SYNC_OBJ_LOCKS
+static struct k_spinlock prio_lock;
+#define PRIO_INHERIT_LOCKED() K_SPINLOCK(&prio_lock)
+#else
+#define PRIO_INHERIT_LOCKED()
+#endif /* CONFIG_KERNEL_SYNC_OBJ_LOCKS */
+
+static inline struct k_spinlock *mutex_lock(struct k_mutex *mutex)
+{
+#ifdef CONFIG_KERNEL_SYNC_OBJ_LOCKS
+	return &mutex->lock;
+#else
+	ARG_UNUSED(mutex);
+	return &global_lock;
+#endif /* CONFIG_KERNEL_SYNC_OBJ_LOCKS */
+}
 
 #ifdef CONFIG_OBJ_CORE_MUTEX
 static struct k_obj_type obj_type_mutex;
 #endif /* CONFIG_OBJ_CORE_MUTEX */
 
+/* Returned when locking the k_mutex backing a sys_mutex that is no longer
+ * held by it
+ */
+#define MUTEX_USER_STALE 1
+
+/*
+ * The k_mutex backing a sys_mutex is locked exactly when the sys_mutex
+ * value is Z_SYS_MUTEX_KERNEL, the value only changing from or to it with
+ * the mutex lock held.
+ */
+static inline bool user_val_stale(atomic_t *user_val)
+{
+#ifdef CONFIG_USERSPACE
+	return (user_val != NULL) && (atomic_get(user_val) != Z_SYS_MUTEX_KERNEL);
+#else
+	ARG_UNUSED(user_val);
+
+	return false;
+#endif /* CONFIG_USERSPACE */
+}
+
+static inline void user_val_unlock(atomic_t *user_val)
+{
+#ifdef CONFIG_USERSPACE
+	if (user_val != NULL) {
+		atomic_set(user_val, Z_SYS_MUTEX_UNLOCKED);
+	}
+#else
+	ARG_UNUSED(user_val);
+#endif /* CONFIG_USERSPACE */
+}
+
 int z_impl_k_mutex_init(struct k_mutex *mutex)
 {
 	mutex->owner = NULL;
 	mutex->lock_count = 0U;
+#ifdef CONFIG_KERNEL_SYNC_OBJ_LOCKS
+	mutex->lock = (struct k_spinlock) {};
+#endif
 
 	z_waitq_init(&mutex->wait_q);
 
@@ -102,9 +160,73 @@ static bool adjust_owner_prio(struct k_mutex *mutex, int32_t new_prio)
 	return false;
 }
 
-int z_impl_k_mutex_lock(struct k_mutex *mutex, k_timeout_t timeout)
+#ifdef CONFIG_MUTEX_ADAPTIVE_SPIN
+/*
+ * Spins while the mutex is owned by a thread running on another CPU,
+ * which is likely to unlock it before we could even switch away.  Must
+ * be called with the mutex lock held, which is dropped while spinning.
+ * Returns true if the mutex got unlocked, with the lock held again.
+ */
+static bool mutex_spin(struct k_mutex *mutex, struct k_spinlock *lock,
+		       k_spinlock_key_t *key, k_timeout_t timeout)
+{
+	uint32_t limit = k_us_to_cyc_ceil32(CONFIG_MUTEX_ADAPTIVE_SPIN_US);
+	uint32_t start = k_cycle_get_32();
+	struct k_thread *owner;
+	bool running;
+
+	if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+		return false;
+	}
+
+	while (mutex->lock_count != 0U) {
+		owner = mutex->owner;
+
+		/* Waiters get the mutex handed over on unlock: no point in
+		 * spinning behind them.  Nor is there for an owner that
+		 * isn't running, which needs the priority inheritance.
+		 */
+		if ((z_waitq_head(&mutex->wait_q) != NULL) ||
+		    (thread_active_elsewhere(owner) == NULL) ||
+		    ((k_cycle_get_32() - start) >= limit)) {
+			return false;
+		}
+
+		k_spin_unlock(lock, *key);
+
+		/* Poll without the lock, so as not to delay the unlock */
+		do {
+			unsigned int k = arch_irq_lock();
+
+			running = (thread_active_elsewhere(owner) != NULL);
+			arch_spin_relax(); /* Requires interrupts be masked */
+			arch_irq_unlock(k);
+		} while (running && (mutex->owner == owner) &&
+			 ((k_cycle_get_32() - start) < limit));
+
+		*key = k_spin_lock(lock);
+	}
+
+	return true;
+}
+#else
+static inline bool mutex_spin(struct k_mutex *mutex, struct k_spinlock *lock,
+			      k_spinlock_key_t *key, k_timeout_t timeout)
+{
+	ARG_UNUSED(mutex);
+	ARG_UNUSED(lock);
+	ARG_UNUSED(key);
+	ARG_UNUSED(timeout);
+
+	return false;
+}
+#endif /* CONFIG_MUTEX_ADAPTIVE_SPIN */
+
+static int mutex_lock_common(struct k_mutex *mutex, atomic_t *user_val,
+			     k_timeout_t timeout)
 {
 	int new_prio;
+	struct k_spinlock *lock = mutex_lock(mutex);
 	k_spinlock_key_t key;
 	bool resched = false;
 
@@ -112,9 +234,14 @@ int z_impl_k_mutex_lock(struct k_mutex *mutex, k_timeout_t timeout)
 
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_mutex, lock, mutex, timeout);
 
-	key = k_spin_lock(&lock);
+	key = k_spin_lock(lock);
 
-	if (likely((mutex->lock_count == 0U) || (mutex->owner == arch_current_thread()))) {
+	if (likely((mutex->lock_count == 0U) || (mutex->owner == arch_current_thread())) ||
+	    mutex_spin(mutex, lock, &key, timeout)) {
+
+		if (user_val_stale(user_val)) {
+			goto stale;
+		}
 
 		mutex->owner_orig_prio = (mutex->lock_count == 0U) ?
 					arch_current_thread()->base.prio :
@@ -127,15 +254,19 @@ int z_impl_k_mutex_lock(struct k_mutex *mutex, k_timeout_t timeout)
 			arch_current_thread(), mutex, mutex->lock_count,
 			mutex->owner_orig_prio);
 
-		k_spin_unlock(&lock, key);
+		k_spin_unlock(lock, key);
 
 		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_mutex, lock, mutex, timeout, 0);
 
 		return 0;
 	}
 
+	if (user_val_stale(user_val)) {
+		goto stale;
+	}
+
 	if (unlikely(K_TIMEOUT_EQ(timeout, K_NO_WAIT))) {
-		k_spin_unlock(&lock, key);
+		k_spin_unlock(lock, key);
 
 		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_mutex, lock, mutex, timeout, -EBUSY);
 
@@ -144,16 +275,18 @@ int z_impl_k_mutex_lock(struct k_mutex *mutex, k_timeout_t timeout)
 
 	SYS_PORT_TRACING_OBJ_FUNC_BLOCKING(k_mutex, lock, mutex, timeout);
 
-	new_prio = new_prio_for_inheritance(arch_current_thread()->base.prio,
-					    mutex->owner->base.prio);
+	PRIO_INHERIT_LOCKED() {
+		new_prio = new_prio_for_inheritance(arch_current_thread()->base.prio,
+						    mutex->owner->base.prio);
 
-	LOG_DBG("adjusting prio up on mutex %p", mutex);
+		LOG_DBG("adjusting prio up on mutex %p", mutex);
 
-	if (z_is_prio_higher(new_prio, mutex->owner->base.prio)) {
-		resched = adjust_owner_prio(mutex, new_prio);
+		if (z_is_prio_higher(new_prio, mutex->owner->base.prio)) {
+			resched = adjust_owner_prio(mutex, new_prio);
+		}
 	}
 
-	int got_mutex = z_pend_curr(&lock, key, &mutex->wait_q, timeout);
+	int got_mutex = z_pend_curr(lock, key, &mutex->wait_q, timeout);
 
 	LOG_DBG("on mutex %p got_mutex value: %d", mutex, got_mutex);
 
@@ -169,7 +302,7 @@ int z_impl_k_mutex_lock(struct k_mutex *mutex, k_timeout_t timeout)
 
 	LOG_DBG("%p timeout on mutex %p", arch_current_thread(), mutex);
 
-	key = k_spin_lock(&lock);
+	key = k_spin_lock(lock);
 
 	/*
 	 * Check if mutex was unlocked after this thread was unpended.
@@ -184,18 +317,32 @@ int z_impl_k_mutex_lock(struct k_mutex *mutex, k_timeout_t timeout)
 
 		LOG_DBG("adjusting prio down on mutex %p", mutex);
 
-		resched = adjust_owner_prio(mutex, new_prio) || resched;
+		PRIO_INHERIT_LOCKED() {
+			resched = adjust_owner_prio(mutex, new_prio) || resched;
+		}
 	}
 
 	if (resched) {
-		z_reschedule(&lock, key);
+		z_reschedule(lock, key);
 	} else {
-		k_spin_unlock(&lock, key);
+		k_spin_unlock(lock, key);
 	}
 
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_mutex, lock, mutex, timeout, -EAGAIN);
 
 	return -EAGAIN;
+
+stale:
+	k_spin_unlock(lock, key);
+
+	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_mutex, lock, mutex, timeout, MUTEX_USER_STALE);
+
+	return MUTEX_USER_STALE;
+}
+
+int z_impl_k_mutex_lock(struct k_mutex *mutex, k_timeout_t timeout)
+{
+	return mutex_lock_common(mutex, NULL, timeout);
 }
 
 #ifdef CONFIG_USERSPACE
@@ -206,9 +353,39 @@ static inline int z_vrfy_k_mutex_lock(struct k_mutex *mutex,
 	return z_impl_k_mutex_lock(mutex, timeout);
 }
 #include <zephyr/syscalls/k_mutex_lock_mrsh.c>
+
+int z_mutex_lock_for(struct k_mutex *mutex, atomic_t *user_val,
+		     struct k_thread *owner)
+{
+	struct k_spinlock *lock = mutex_lock(mutex);
+	k_spinlock_key_t key = k_spin_lock(lock);
+	int ret = -EAGAIN;
+
+	/* The sys_mutex value is writable from user mode, so it may claim a
+	 * user mode owner while the k_mutex is held.
+	 */
+	if (mutex->lock_count != 0U) {
+		ret = -EINVAL;
+	} else if (atomic_cas(user_val, (atomic_val_t)owner, Z_SYS_MUTEX_KERNEL)) {
+		mutex->owner_orig_prio = owner->base.prio;
+		mutex->lock_count = 1U;
+		mutex->owner = owner;
+		ret = 0;
+	}
+
+	k_spin_unlock(lock, key);
+
+	return ret;
+}
+
+int z_mutex_lock_user(struct k_mutex *mutex, atomic_t *user_val,
+		      k_timeout_t timeout)
+{
+	return mutex_lock_common(mutex, user_val, timeout);
+}
 #endif /* CONFIG_USERSPACE */
 
-int z_impl_k_mutex_unlock(struct k_mutex *mutex)
+static int mutex_unlock_common(struct k_mutex *mutex, atomic_t *user_val)
 {
 	struct k_thread *new_owner;
 
@@ -249,9 +426,12 @@ int z_impl_k_mutex_unlock(struct k_mutex *mutex)
 		goto k_mutex_unlock_return;
 	}
 
-	k_spinlock_key_t key = k_spin_lock(&lock);
+	struct k_spinlock *lock = mutex_lock(mutex);
+	k_spinlock_key_t key = k_spin_lock(lock);
 
-	adjust_owner_prio(mutex, mutex->owner_orig_prio);
+	PRIO_INHERIT_LOCKED() {
+		adjust_owner_prio(mutex, mutex->owner_orig_prio);
+	}
 
 	/* Get the new owner, if any */
 	new_owner = z_unpend_first_thread(&mutex->wait_q);
@@ -270,10 +450,11 @@ int z_impl_k_mutex_unlock(struct k_mutex *mutex)
 		mutex->owner_orig_prio = new_owner->base.prio;
 		arch_thread_return_value_set(new_owner, 0);
 		z_ready_thread(new_owner);
-		z_reschedule(&lock, key);
+		z_reschedule(lock, key);
 	} else {
 		mutex->lock_count = 0U;
-		k_spin_unlock(&lock, key);
+		user_val_unlock(user_val);
+		k_spin_unlock(lock, key);
 	}
 
 
@@ -283,7 +464,17 @@ k_mutex_unlock_return:
 	return 0;
 }
 
+int z_impl_k_mutex_unlock(struct k_mutex *mutex)
+{
+	return mutex_unlock_common(mutex, NULL);
+}
+
 #ifdef CONFIG_USERSPACE
+int z_mutex_unlock_user(struct k_mutex *mutex, atomic_t *user_val)
+{
+	return mutex_unlock_common(mutex, user_val);
+}
+
 static inline int z_vrfy_k_mutex_unlock(struct k_mutex *mutex)
 {
 	K_OOPS(K_SYSCALL_OBJ(mutex, K_OBJ_MUTEX));
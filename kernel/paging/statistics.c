@@ -16,6 +16,7 @@ extern struct k_mem_paging_stats_t paging_stats;
 struct k_mem_paging_histogram_t z_paging_histogram_eviction;
 struct k_mem_paging_histogram_t z_paging_histogram_backing_store_page_in;
 struct k_mem_paging_histogram_t z_paging_histogram_backing_store_page_out;
+struct k_mem_paging_histogram_t z_paging_histogram_page_fault;
 
 #ifdef CONFIG_DEMAND_PAGING_STATS_USING_TIMING_FUNCTIONS
 
@@ -88,6 +89,40 @@ unsigned long k_mem_num_pagefaults_get(void)
 	return ret;
 }
 
+void k_mem_paging_eviction_stats_inc(enum k_mem_paging_eviction_event event)
+{
+	switch (event) {
+	case K_MEM_PAGING_EVICTION_HIT:
+		paging_stats.policy.hit++;
+		break;
+	case K_MEM_PAGING_EVICTION_MISS:
+		paging_stats.policy.miss++;
+		break;
+	case K_MEM_PAGING_EVICTION_THRASH:
+		paging_stats.policy.thrash++;
+		break;
+	default:
+		break;
+	}
+}
+
+void k_mem_paging_backing_store_stats_compress(size_t size, uint32_t cycles)
+{
+	if (size < CONFIG_MMU_PAGE_SIZE) {
+		paging_stats.compression.compressed++;
+		paging_stats.compression.compressed_bytes += size;
+	} else {
+		paging_stats.compression.incompressible++;
+	}
+	paging_stats.compression.compress_cycles += cycles;
+}
+
+void k_mem_paging_backing_store_stats_decompress(uint32_t cycles)
+{
+	paging_stats.compression.decompressed++;
+	paging_stats.compression.decompress_cycles += cycles;
+}
+
 void z_impl_k_mem_paging_stats_get(struct k_mem_paging_stats_t *stats)
 {
 	if (stats == NULL) {
@@ -160,6 +195,12 @@ void z_paging_histogram_init(void)
 	memcpy(z_paging_histogram_backing_store_page_out.bounds,
 	       k_mem_paging_backing_store_histogram_bounds,
 	       sizeof(z_paging_histogram_backing_store_page_out.bounds));
+
+	memset(&z_paging_histogram_page_fault, 0,
+	       sizeof(z_paging_histogram_page_fault));
+	memcpy(z_paging_histogram_page_fault.bounds,
+	       k_mem_paging_backing_store_histogram_bounds,
+	       sizeof(z_paging_histogram_page_fault.bounds));
 }
 
 /**
@@ -219,6 +260,18 @@ void z_impl_k_mem_paging_histogram_backing_store_page_out_get(
 	       sizeof(z_paging_histogram_backing_store_page_out));
 }
 
+void z_impl_k_mem_paging_histogram_page_fault_get(
+	struct k_mem_paging_histogram_t *hist)
+{
+	if (hist == NULL) {
+		return;
+	}
+
+	/* Copy histogram */
+	memcpy(hist, &z_paging_histogram_page_fault,
+	       sizeof(z_paging_histogram_page_fault));
+}
+
 #ifdef CONFIG_USERSPACE
 static inline
 void z_vrfy_k_mem_paging_histogram_eviction_get(
@@ -246,6 +299,15 @@ void z_vrfy_k_mem_paging_histogram_backing_store_page_out_get(
 	z_impl_k_mem_paging_histogram_backing_store_page_out_get(hist);
 }
 #include <zephyr/syscalls/k_mem_paging_histogram_backing_store_page_out_get_mrsh.c>
+
+static inline
+void z_vrfy_k_mem_paging_histogram_page_fault_get(
+	struct k_mem_paging_histogram_t *hist)
+{
+	K_OOPS(K_SYSCALL_MEMORY_WRITE(hist, sizeof(*hist)));
+	z_impl_k_mem_paging_histogram_page_fault_get(hist);
+}
+#include <zephyr/syscalls/k_mem_paging_histogram_page_fault_get_mrsh.c>
 #endif /* CONFIG_USERSPACE */
 
 #endif /* CONFIG_DEMAND_PAGING_TIMING_HISTOGRAM */
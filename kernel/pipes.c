@@ -50,6 +50,12 @@ void k_pipe_init(struct k_pipe *pipe, unsigned char *buffer, size_t size)
 
 	pipe->flags = 0;
 
+#ifdef CONFIG_PIPE_SPSC
+	atomic_clear(&pipe->spsc_head);
+	atomic_clear(&pipe->spsc_tail);
+	atomic_clear(&pipe->spsc_waiting);
+#endif /* CONFIG_PIPE_SPSC */
+
 #if defined(CONFIG_POLL)
 	sys_dlist_init(&pipe->poll_events);
 #endif /* CONFIG_POLL */
@@ -60,6 +66,16 @@ void k_pipe_init(struct k_pipe *pipe, unsigned char *buffer, size_t size)
 #endif /* CONFIG_OBJ_CORE_PIPE */
 }
 
+#ifdef CONFIG_PIPE_SPSC
+void k_pipe_spsc_init(struct k_pipe *pipe, unsigned char *buffer, size_t size)
+{
+	__ASSERT((buffer != NULL) && (size != 0U), "SPSC pipes need a buffer");
+
+	k_pipe_init(pipe, buffer, size);
+	pipe->flags = K_PIPE_FLAG_SPSC;
+}
+#endif /* CONFIG_PIPE_SPSC */
+
 int z_impl_k_pipe_alloc_init(struct k_pipe *pipe, size_t size)
 {
 	void *buffer;
@@ -105,12 +121,265 @@ static inline void handle_poll_events(struct k_pipe *pipe)
 #endif /* CONFIG_POLL */
 }
 
+#ifdef CONFIG_PIPE_SPSC
+/*
+ * Single-producer/single-consumer pipes
+ *
+ * The writer alone moves the write position (head) and the reader alone
+ * moves the read position (tail), both with atomic stores that publish the
+ * data copied before them. Positions run over twice the buffer size so a
+ * full pipe can be told apart from an empty one.
+ *
+ * The pipe lock is only taken to block or wake. A thread about to block
+ * flags itself in spsc_waiting and checks the other position once more
+ * with the lock held, while the other side checks spsc_waiting after
+ * moving its position, so one of the two always notices the other.
+ */
+
+#define SPSC_WAIT_READER BIT(0)
+#define SPSC_WAIT_WRITER BIT(1)
+
+static inline bool pipe_is_spsc(struct k_pipe *pipe)
+{
+	return (pipe->flags & K_PIPE_FLAG_SPSC) != 0U;
+}
+
+static inline size_t spsc_used(struct k_pipe *pipe, atomic_val_t head,
+			       atomic_val_t tail)
+{
+	atomic_val_t used = head - tail;
+
+	return (size_t)((used < 0) ? (used + (atomic_val_t)(2 * pipe->size)) : used);
+}
+
+static inline atomic_val_t spsc_advance(struct k_pipe *pipe, atomic_val_t pos,
+					size_t num_bytes)
+{
+	pos += (atomic_val_t)num_bytes;
+
+	return (pos >= (atomic_val_t)(2 * pipe->size)) ?
+	       (pos - (atomic_val_t)(2 * pipe->size)) : pos;
+}
+
+static inline size_t spsc_index(struct k_pipe *pipe, atomic_val_t pos)
+{
+	return ((size_t)pos >= pipe->size) ? ((size_t)pos - pipe->size) : (size_t)pos;
+}
+
+static void spsc_copy_in(struct k_pipe *pipe, atomic_val_t pos,
+			 const unsigned char *src, size_t num_bytes)
+{
+	size_t index = spsc_index(pipe, pos);
+	size_t first = MIN(num_bytes, pipe->size - index);
+
+	(void)memcpy(&pipe->buffer[index], src, first);
+	(void)memcpy(pipe->buffer, &src[first], num_bytes - first);
+}
+
+/**
+ * @brief Copy from the ring buffer, or discard the data if @a dest is NULL
+ */
+static void spsc_copy_out(struct k_pipe *pipe, atomic_val_t pos,
+			  unsigned char *dest, size_t num_bytes)
+{
+	size_t index = spsc_index(pipe, pos);
+	size_t first = MIN(num_bytes, pipe->size - index);
+
+	if (dest == NULL) {
+		return;
+	}
+
+	(void)memcpy(dest, &pipe->buffer[index], first);
+	(void)memcpy(&dest[first], pipe->buffer, num_bytes - first);
+}
+
+/**
+ * @brief Wake the thread on the other side if it is blocked
+ */
+static void spsc_wake(struct k_pipe *pipe, atomic_val_t waiter,
+		      _wait_q_t *wait_q)
+{
+	k_spinlock_key_t key;
+
+	if ((atomic_get(&pipe->spsc_waiting) & waiter) == 0) {
+		return;
+	}
+
+	key = k_spin_lock(&pipe->lock);
+
+	(void)atomic_and(&pipe->spsc_waiting, ~waiter);
+
+	if (z_sched_wake(wait_q, 0, NULL)) {
+		z_reschedule(&pipe->lock, key);
+	} else {
+		k_spin_unlock(&pipe->lock, key);
+	}
+}
+
+/**
+ * @brief Block until the other side moves @a pos away from @a seen
+ *
+ * @return 0 when woken or if @a pos has already moved, -EAGAIN on timeout
+ */
+static int spsc_wait(struct k_pipe *pipe, atomic_val_t waiter,
+		     _wait_q_t *wait_q, atomic_t *pos, atomic_val_t seen,
+		     k_timepoint_t end)
+{
+	k_spinlock_key_t key = k_spin_lock(&pipe->lock);
+
+	(void)atomic_or(&pipe->spsc_waiting, waiter);
+
+	if (atomic_get(pos) != seen) {
+		(void)atomic_and(&pipe->spsc_waiting, ~waiter);
+		k_spin_unlock(&pipe->lock, key);
+
+		return 0;
+	}
+
+	return z_sched_wait(&pipe->lock, key, wait_q,
+			    sys_timepoint_timeout(end), NULL);
+}
+
+static int pipe_spsc_put(struct k_pipe *pipe, const unsigned char *data,
+			 size_t bytes_to_write, size_t *bytes_written,
+			 size_t min_xfer, k_timeout_t timeout)
+{
+	k_timepoint_t end = sys_timepoint_calc(timeout);
+	size_t num_bytes_written = 0U;
+	size_t num_bytes;
+	atomic_val_t head;
+	atomic_val_t tail;
+	int ret = 0;
+
+	while (true) {
+		head = atomic_get(&pipe->spsc_head);
+		tail = atomic_get(&pipe->spsc_tail);
+		num_bytes = MIN(pipe->size - spsc_used(pipe, head, tail),
+				bytes_to_write - num_bytes_written);
+
+		if ((num_bytes < min_xfer) && K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+
+			/* The request can not be fulfilled. */
+
+			*bytes_written = 0U;
+
+			return -EIO;
+		}
+
+		if (num_bytes != 0U) {
+			spsc_copy_in(pipe, head, &data[num_bytes_written],
+				     num_bytes);
+			atomic_set(&pipe->spsc_head,
+				   spsc_advance(pipe, head, num_bytes));
+			num_bytes_written += num_bytes;
+
+			/* Pollers only wait on an empty pipe */
+			if (atomic_get(&pipe->spsc_tail) == head) {
+				handle_poll_events(pipe);
+			}
+
+			spsc_wake(pipe, SPSC_WAIT_READER, &pipe->wait_q.readers);
+		}
+
+		if ((num_bytes_written == bytes_to_write) ||
+		    K_TIMEOUT_EQ(timeout, K_NO_WAIT) ||
+		    ((num_bytes_written >= min_xfer) && (min_xfer > 0U))) {
+			break;
+		}
+
+		/* The pipe is full */
+
+		SYS_PORT_TRACING_OBJ_FUNC_BLOCKING(k_pipe, put, pipe, timeout);
+
+		if (spsc_wait(pipe, SPSC_WAIT_WRITER, &pipe->wait_q.writers,
+			      &pipe->spsc_tail, tail, end) != 0) {
+			ret = (num_bytes_written >= min_xfer) ? 0 : -EAGAIN;
+			break;
+		}
+	}
+
+	*bytes_written = num_bytes_written;
+
+	return ret;
+}
+
+static int pipe_spsc_get(struct k_pipe *pipe, unsigned char *data,
+			 size_t bytes_to_read, size_t *bytes_read,
+			 size_t min_xfer, k_timeout_t timeout)
+{
+	k_timepoint_t end = sys_timepoint_calc(timeout);
+	size_t num_bytes_read = 0U;
+	size_t num_bytes;
+	atomic_val_t head;
+	atomic_val_t tail;
+	int ret = 0;
+
+	while (true) {
+		tail = atomic_get(&pipe->spsc_tail);
+		head = atomic_get(&pipe->spsc_head);
+		num_bytes = MIN(spsc_used(pipe, head, tail),
+				bytes_to_read - num_bytes_read);
+
+		if ((num_bytes < min_xfer) && K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+
+			/* The request can not be fulfilled. */
+
+			*bytes_read = 0U;
+
+			return -EIO;
+		}
+
+		if (num_bytes != 0U) {
+			spsc_copy_out(pipe, tail,
+				      (data != NULL) ? &data[num_bytes_read] : NULL,
+				      num_bytes);
+			atomic_set(&pipe->spsc_tail,
+				   spsc_advance(pipe, tail, num_bytes));
+			num_bytes_read += num_bytes;
+
+			spsc_wake(pipe, SPSC_WAIT_WRITER, &pipe->wait_q.writers);
+		}
+
+		if ((num_bytes_read == bytes_to_read) ||
+		    K_TIMEOUT_EQ(timeout, K_NO_WAIT) ||
+		    ((num_bytes_read >= min_xfer) && (min_xfer > 0U))) {
+			break;
+		}
+
+		/* The pipe is empty */
+
+		SYS_PORT_TRACING_OBJ_FUNC_BLOCKING(k_pipe, get, pipe, timeout);
+
+		if (spsc_wait(pipe, SPSC_WAIT_READER, &pipe->wait_q.readers,
+			      &pipe->spsc_head, head, end) != 0) {
+			ret = (num_bytes_read >= min_xfer) ? 0 : -EAGAIN;
+			break;
+		}
+	}
+
+	*bytes_read = num_bytes_read;
+
+	return ret;
+}
+#endif /* CONFIG_PIPE_SPSC */
+
 void z_impl_k_pipe_flush(struct k_pipe *pipe)
 {
 	size_t  bytes_read;
 
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_pipe, flush, pipe);
 
+#ifdef CONFIG_PIPE_SPSC
+	if (pipe_is_spsc(pipe)) {
+		(void)pipe_spsc_get(pipe, NULL, pipe->size, &bytes_read, 0U,
+				    K_NO_WAIT);
+
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_pipe, flush, pipe);
+
+		return;
+	}
+#endif /* CONFIG_PIPE_SPSC */
+
 	k_spinlock_key_t key = k_spin_lock(&pipe->lock);
 
 	(void) pipe_get_internal(key, pipe, NULL, (size_t) -1, &bytes_read, 0U,
@@ -135,6 +404,17 @@ void z_impl_k_pipe_buffer_flush(struct k_pipe *pipe)
 
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_pipe, buffer_flush, pipe);
 
+#ifdef CONFIG_PIPE_SPSC
+	if (pipe_is_spsc(pipe)) {
+		(void)pipe_spsc_get(pipe, NULL, pipe->size, &bytes_read, 0U,
+				    K_NO_WAIT);
+
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_pipe, buffer_flush, pipe);
+
+		return;
+	}
+#endif /* CONFIG_PIPE_SPSC */
+
 	k_spinlock_key_t key = k_spin_lock(&pipe->lock);
 
 	if (pipe->buffer != NULL) {
@@ -401,6 +681,17 @@ int z_impl_k_pipe_put(struct k_pipe *pipe, const void *data,
 		return -EINVAL;
 	}
 
+#ifdef CONFIG_PIPE_SPSC
+	if (pipe_is_spsc(pipe)) {
+		int ret = pipe_spsc_put(pipe, data, bytes_to_write,
+					bytes_written, min_xfer, timeout);
+
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_pipe, put, pipe, timeout, ret);
+
+		return ret;
+	}
+#endif /* CONFIG_PIPE_SPSC */
+
 	sys_dlist_init(&src_list);
 	sys_dlist_init(&dest_list);
 
@@ -711,6 +1002,17 @@ int z_impl_k_pipe_get(struct k_pipe *pipe, void *data, size_t bytes_to_read,
 		return -EINVAL;
 	}
 
+#ifdef CONFIG_PIPE_SPSC
+	if (pipe_is_spsc(pipe)) {
+		int ret = pipe_spsc_get(pipe, data, bytes_to_read, bytes_read,
+					min_xfer, timeout);
+
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_pipe, get, pipe, timeout, ret);
+
+		return ret;
+	}
+#endif /* CONFIG_PIPE_SPSC */
+
 	k_spinlock_key_t key = k_spin_lock(&pipe->lock);
 
 	int ret = pipe_get_internal(key, pipe, data, bytes_to_read, bytes_read,
@@ -747,6 +1049,14 @@ size_t z_impl_k_pipe_read_avail(struct k_pipe *pipe)
 		goto out;
 	}
 
+#ifdef CONFIG_PIPE_SPSC
+	if (pipe_is_spsc(pipe)) {
+		res = spsc_used(pipe, atomic_get(&pipe->spsc_head),
+				       atomic_get(&pipe->spsc_tail));
+		goto out;
+	}
+#endif /* CONFIG_PIPE_SPSC */
+
 	key = k_spin_lock(&pipe->lock);
 
 	if (pipe->read_index == pipe->write_index) {
@@ -784,6 +1094,14 @@ size_t z_impl_k_pipe_write_avail(struct k_pipe *pipe)
 		goto out;
 	}
 
+#ifdef CONFIG_PIPE_SPSC
+	if (pipe_is_spsc(pipe)) {
+		res = pipe->size - spsc_used(pipe, atomic_get(&pipe->spsc_head),
+						   atomic_get(&pipe->spsc_tail));
+		goto out;
+	}
+#endif /* CONFIG_PIPE_SPSC */
+
 	key = k_spin_lock(&pipe->lock);
 
 	if (pipe->write_index == pipe->read_index) {
@@ -26,14 +26,79 @@
 #include <zephyr/sys/__assert.h>
 #include <stdbool.h>
 
-/* Single subsystem lock.  Locking per-event would be better on highly
- * contended SMP systems, but the original locking scheme here is
- * subtle (it relies on releasing/reacquiring the lock in areas for
- * latency control and it's sometimes hard to see exactly what data is
- * "inside" a given critical section).  Do the synchronization port
- * later as an optimization.
+#ifdef CONFIG_POLL_LOCK_SHARDING
+/* Two levels of locking.  The list of events registered on a kernel
+ * object, and the state of those events, are protected by one of
+ * CONFIG_POLL_LOCK_SHARDS locks picked by the address of the list.  The
+ * state of a poller (thread or triggered work item) is protected by its
+ * own lock, which nests inside the object locks: it is what a poller
+ * holds while deciding to sleep and what a signaller holds while waking
+ * it, whichever objects the two came through.
  */
-static struct k_spinlock lock;
+BUILD_ASSERT(IS_POWER_OF_TWO(CONFIG_POLL_LOCK_SHARDS),
+	     "CONFIG_POLL_LOCK_SHARDS must be a power of two");
+
+static struct k_spinlock obj_locks[CONFIG_POLL_LOCK_SHARDS];
+
+static inline struct k_spinlock *obj_lock(sys_dlist_t *events)
+{
+	/* Objects are at least word aligned and usually far apart */
+	uintptr_t hash = (uintptr_t)events / sizeof(void *);
+
+	hash ^= hash >> 7;
+
+	return &obj_locks[hash & (CONFIG_POLL_LOCK_SHARDS - 1)];
+}
+
+static inline struct k_spinlock *poller_lock(struct z_poller *poller)
+{
+	return &poller->lock;
+}
+
+/* Lock a poller while holding an object lock */
+static inline k_spinlock_key_t poller_lock_nested(struct z_poller *poller)
+{
+	return k_spin_lock(&poller->lock);
+}
+
+static inline void poller_unlock_nested(struct z_poller *poller,
+					k_spinlock_key_t key)
+{
+	k_spin_unlock(&poller->lock, key);
+}
+#else
+/* A single lock protects all objects and pollers */
+static struct k_spinlock poll_lock;
+
+static inline struct k_spinlock *obj_lock(sys_dlist_t *events)
+{
+	ARG_UNUSED(events);
+
+	return &poll_lock;
+}
+
+static inline struct k_spinlock *poller_lock(struct z_poller *poller)
+{
+	ARG_UNUSED(poller);
+
+	return &poll_lock;
+}
+
+/* The object lock already covers the poller */
+static inline k_spinlock_key_t poller_lock_nested(struct z_poller *poller)
+{
+	ARG_UNUSED(poller);
+
+	return (k_spinlock_key_t){};
+}
+
+static inline void poller_unlock_nested(struct z_poller *poller,
+					k_spinlock_key_t key)
+{
+	ARG_UNUSED(poller);
+	ARG_UNUSED(key);
+}
+#endif /* CONFIG_POLL_LOCK_SHARDING */
 
 enum POLL_MODE { MODE_NONE, MODE_POLL, MODE_TRIGGERED };
 
@@ -133,32 +198,26 @@ static inline void add_event(sys_dlist_t *events, struct k_poll_event *event,
 	sys_dlist_append(events, &event->_node);
 }
 
-/* must be called with interrupts locked */
-static inline void register_event(struct k_poll_event *event,
-				 struct z_poller *poller)
+/* The list of events registered on the object of @p event, if any */
+static inline sys_dlist_t *event_list(struct k_poll_event *event)
 {
 	switch (event->type) {
 	case K_POLL_TYPE_SEM_AVAILABLE:
 		__ASSERT(event->sem != NULL, "invalid semaphore\n");
-		add_event(&event->sem->poll_events, event, poller);
-		break;
+		return &event->sem->poll_events;
 	case K_POLL_TYPE_DATA_AVAILABLE:
 		__ASSERT(event->queue != NULL, "invalid queue\n");
-		add_event(&event->queue->poll_events, event, poller);
-		break;
+		return &event->queue->poll_events;
 	case K_POLL_TYPE_SIGNAL:
 		__ASSERT(event->signal != NULL, "invalid poll signal\n");
-		add_event(&event->signal->poll_events, event, poller);
-		break;
+		return &event->signal->poll_events;
 	case K_POLL_TYPE_MSGQ_DATA_AVAILABLE:
 		__ASSERT(event->msgq != NULL, "invalid message queue\n");
-		add_event(&event->msgq->poll_events, event, poller);
-		break;
+		return &event->msgq->poll_events;
 #ifdef CONFIG_PIPES
 	case K_POLL_TYPE_PIPE_DATA_AVAILABLE:
 		__ASSERT(event->pipe != NULL, "invalid pipe\n");
-		add_event(&event->pipe->poll_events, event, poller);
-		break;
+		return &event->pipe->poll_events;
 #endif /* CONFIG_PIPES */
 	case K_POLL_TYPE_IGNORE:
 		/* nothing to do */
@@ -168,60 +227,40 @@ static inline void register_event(struct k_poll_event *event,
 		break;
 	}
 
-	event->poller = poller;
+	return NULL;
 }
 
-/* must be called with interrupts locked */
-static inline void clear_event_registration(struct k_poll_event *event)
+/* must be called with the object lock of @p list held */
+static inline void register_event(struct k_poll_event *event,
+				  sys_dlist_t *list,
+				  struct z_poller *poller)
 {
-	bool remove_event = false;
-
-	event->poller = NULL;
-
-	switch (event->type) {
-	case K_POLL_TYPE_SEM_AVAILABLE:
-		__ASSERT(event->sem != NULL, "invalid semaphore\n");
-		remove_event = true;
-		break;
-	case K_POLL_TYPE_DATA_AVAILABLE:
-		__ASSERT(event->queue != NULL, "invalid queue\n");
-		remove_event = true;
-		break;
-	case K_POLL_TYPE_SIGNAL:
-		__ASSERT(event->signal != NULL, "invalid poll signal\n");
-		remove_event = true;
-		break;
-	case K_POLL_TYPE_MSGQ_DATA_AVAILABLE:
-		__ASSERT(event->msgq != NULL, "invalid message queue\n");
-		remove_event = true;
-		break;
-#ifdef CONFIG_PIPES
-	case K_POLL_TYPE_PIPE_DATA_AVAILABLE:
-		__ASSERT(event->pipe != NULL, "invalid pipe\n");
-		remove_event = true;
-		break;
-#endif /* CONFIG_PIPES */
-	case K_POLL_TYPE_IGNORE:
-		/* nothing to do */
-		break;
-	default:
-		__ASSERT(false, "invalid event type\n");
-		break;
-	}
-	if (remove_event && sys_dnode_is_linked(&event->_node)) {
-		sys_dlist_remove(&event->_node);
+	if (list != NULL) {
+		add_event(list, event, poller);
 	}
+
+	event->poller = poller;
 }
 
-/* must be called with interrupts locked */
 static inline void clear_event_registrations(struct k_poll_event *events,
-					      int num_events,
-					      k_spinlock_key_t key)
+					      int num_events)
 {
 	while (num_events--) {
-		clear_event_registration(&events[num_events]);
-		k_spin_unlock(&lock, key);
-		key = k_spin_lock(&lock);
+		struct k_poll_event *event = &events[num_events];
+		sys_dlist_t *list = event_list(event);
+		k_spinlock_key_t key;
+
+		if (list == NULL) {
+			event->poller = NULL;
+			continue;
+		}
+
+		key = k_spin_lock(obj_lock(list));
+		event->poller = NULL;
+		if (sys_dnode_is_linked(&event->_node)) {
+			sys_dlist_remove(&event->_node);
+		}
+		k_spin_unlock(obj_lock(list), key);
 	}
 }
 
@@ -239,15 +278,22 @@ static inline int register_events(struct k_poll_event *events,
 	int events_registered = 0;
 
 	for (int ii = 0; ii < num_events; ii++) {
+		sys_dlist_t *list = event_list(&events[ii]);
+		struct k_spinlock *lock = obj_lock(list);
 		k_spinlock_key_t key;
+		k_spinlock_key_t poller_key;
 		uint32_t state;
 
-		key = k_spin_lock(&lock);
+		/* Events without an object go through a shard as well, to
+		 * keep the lock ordering simple.
+		 */
+		key = k_spin_lock(lock);
+		poller_key = poller_lock_nested(poller);
 		if (is_condition_met(&events[ii], &state)) {
 			set_event_ready(&events[ii], state);
 			poller->is_polling = false;
 		} else if (!just_check && poller->is_polling) {
-			register_event(&events[ii], poller);
+			register_event(&events[ii], list, poller);
 			events_registered += 1;
 		} else {
 			/* Event is not one of those identified in is_condition_met()
@@ -256,7 +302,8 @@ static inline int register_events(struct k_poll_event *events,
 			 */
 			;
 		}
-		k_spin_unlock(&lock, key);
+		poller_unlock_nested(poller, poller_key);
+		k_spin_unlock(lock, key);
 	}
 
 	return events_registered;
@@ -304,7 +351,7 @@ int z_impl_k_poll(struct k_poll_event *events, int num_events,
 	events_registered = register_events(events, num_events, poller,
 					    K_TIMEOUT_EQ(timeout, K_NO_WAIT));
 
-	key = k_spin_lock(&lock);
+	key = k_spin_lock(poller_lock(poller));
 
 	/*
 	 * If we're not polling anymore, it means that at least one event
@@ -312,8 +359,8 @@ int z_impl_k_poll(struct k_poll_event *events, int num_events,
 	 * because one of the events registered has had its state changed.
 	 */
 	if (!poller->is_polling) {
-		clear_event_registrations(events, events_registered, key);
-		k_spin_unlock(&lock, key);
+		k_spin_unlock(poller_lock(poller), key);
+		clear_event_registrations(events, events_registered);
 
 		SYS_PORT_TRACING_FUNC_EXIT(k_poll_api, poll, events, 0);
 
@@ -323,7 +370,7 @@ int z_impl_k_poll(struct k_poll_event *events, int num_events,
 	poller->is_polling = false;
 
 	if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
-		k_spin_unlock(&lock, key);
+		k_spin_unlock(poller_lock(poller), key);
 
 		SYS_PORT_TRACING_FUNC_EXIT(k_poll_api, poll, events, -EAGAIN);
 
@@ -332,7 +379,7 @@ int z_impl_k_poll(struct k_poll_event *events, int num_events,
 
 	static _wait_q_t wait_q = Z_WAIT_Q_INIT(&wait_q);
 
-	int swap_rc = z_pend_curr(&lock, key, &wait_q, timeout);
+	int swap_rc = z_pend_curr(poller_lock(poller), key, &wait_q, timeout);
 
 	/*
 	 * Clear all event registrations. If events happen while we're in this
@@ -343,9 +390,7 @@ int z_impl_k_poll(struct k_poll_event *events, int num_events,
 	 * added to the list of events that occurred, the user has to check the
 	 * return code first, which invalidates the whole list of event states.
 	 */
-	key = k_spin_lock(&lock);
-	clear_event_registrations(events, events_registered, key);
-	k_spin_unlock(&lock, key);
+	clear_event_registrations(events, events_registered);
 
 	SYS_PORT_TRACING_FUNC_EXIT(k_poll_api, poll, events, swap_rc);
 
@@ -381,13 +426,13 @@ static inline int z_vrfy_k_poll(struct k_poll_event *events,
 		goto out;
 	}
 
-	key = k_spin_lock(&lock);
+	key = k_spin_lock(poller_lock(&arch_current_thread()->poller));
 	if (K_SYSCALL_MEMORY_WRITE(events, bounds)) {
-		k_spin_unlock(&lock, key);
+		k_spin_unlock(poller_lock(&arch_current_thread()->poller), key);
 		goto oops_free;
 	}
 	(void)memcpy(events_copy, events, bounds);
-	k_spin_unlock(&lock, key);
+	k_spin_unlock(poller_lock(&arch_current_thread()->poller), key);
 
 	/* Validate what's inside events_copy */
 	for (int i = 0; i < num_events; i++) {
@@ -437,13 +482,15 @@ oops_free:
 #include <zephyr/syscalls/k_poll_mrsh.c>
 #endif /* CONFIG_USERSPACE */
 
-/* must be called with interrupts locked */
+/* must be called with the object lock of the event's list held */
 static int signal_poll_event(struct k_poll_event *event, uint32_t state)
 {
 	struct z_poller *poller = event->poller;
 	int retcode = 0;
 
 	if (poller != NULL) {
+		k_spinlock_key_t key = poller_lock_nested(poller);
+
 		if (poller->mode == MODE_POLL) {
 			retcode = signal_poller(event, state);
 		} else if (poller->mode == MODE_TRIGGERED) {
@@ -455,6 +502,8 @@ static int signal_poll_event(struct k_poll_event *event, uint32_t state)
 
 		poller->is_polling = false;
 
+		poller_unlock_nested(poller, key);
+
 		if (retcode < 0) {
 			return retcode;
 		}
@@ -467,14 +516,14 @@ static int signal_poll_event(struct k_poll_event *event, uint32_t state)
 void z_handle_obj_poll_events(sys_dlist_t *events, uint32_t state)
 {
 	struct k_poll_event *poll_event;
-	k_spinlock_key_t key = k_spin_lock(&lock);
+	k_spinlock_key_t key = k_spin_lock(obj_lock(events));
 
 	poll_event = (struct k_poll_event *)sys_dlist_get(events);
 	if (poll_event != NULL) {
 		(void) signal_poll_event(poll_event, state);
 	}
 
-	k_spin_unlock(&lock, key);
+	k_spin_unlock(obj_lock(events), key);
 }
 
 void z_impl_k_poll_signal_init(struct k_poll_signal *sig)
@@ -526,7 +575,8 @@ void z_vrfy_k_poll_signal_check(struct k_poll_signal *sig,
 
 int z_impl_k_poll_signal_raise(struct k_poll_signal *sig, int result)
 {
-	k_spinlock_key_t key = k_spin_lock(&lock);
+	struct k_spinlock *lock = obj_lock(&sig->poll_events);
+	k_spinlock_key_t key = k_spin_lock(lock);
 	struct k_poll_event *poll_event;
 
 	sig->result = result;
@@ -534,7 +584,7 @@ int z_impl_k_poll_signal_raise(struct k_poll_signal *sig, int result)
 
 	poll_event = (struct k_poll_event *)sys_dlist_get(&sig->poll_events);
 	if (poll_event == NULL) {
-		k_spin_unlock(&lock, key);
+		k_spin_unlock(lock, key);
 
 		SYS_PORT_TRACING_FUNC(k_poll_api, signal_raise, sig, 0);
 
@@ -545,10 +595,50 @@ int z_impl_k_poll_signal_raise(struct k_poll_signal *sig, int result)
 
 	SYS_PORT_TRACING_FUNC(k_poll_api, signal_raise, sig, rc);
 
-	z_reschedule(&lock, key);
+	z_reschedule(lock, key);
 	return rc;
 }
 
+int k_poll_signal_raise_batch(struct k_poll_signal *const *signals,
+			      int num_signals, int result)
+{
+	int ret = 0;
+
+	__ASSERT(signals != NULL, "NULL signals\n");
+
+	/* Pollers woken by more than one of the signals are made ready
+	 * by the first one only, and nobody is switched to before all of
+	 * the signals have been raised.
+	 */
+	for (int i = 0; i < num_signals; i++) {
+		struct k_poll_signal *sig = signals[i];
+		struct k_spinlock *lock = obj_lock(&sig->poll_events);
+		k_spinlock_key_t key = k_spin_lock(lock);
+		struct k_poll_event *poll_event;
+		int rc = 0;
+
+		sig->result = result;
+		sig->signaled = 1U;
+
+		poll_event = (struct k_poll_event *)sys_dlist_get(&sig->poll_events);
+		if (poll_event != NULL) {
+			rc = signal_poll_event(poll_event, K_POLL_STATE_SIGNALED);
+		}
+
+		k_spin_unlock(lock, key);
+
+		SYS_PORT_TRACING_FUNC(k_poll_api, signal_raise, sig, rc);
+
+		if ((rc < 0) && (ret == 0)) {
+			ret = rc;
+		}
+	}
+
+	z_reschedule_unlocked();
+
+	return ret;
+}
+
 #ifdef CONFIG_USERSPACE
 static inline int z_vrfy_k_poll_signal_raise(struct k_poll_signal *sig,
 					     int result)
@@ -577,12 +667,7 @@ static void triggered_work_handler(struct k_work *work)
 	 * already cleared event registrations.
 	 */
 	if (twork->poller.mode != MODE_NONE) {
-		k_spinlock_key_t key;
-
-		key = k_spin_lock(&lock);
-		clear_event_registrations(twork->events,
-					  twork->num_events, key);
-		k_spin_unlock(&lock, key);
+		clear_event_registrations(twork->events, twork->num_events);
 	}
 
 	/* Drop work ownership and execute real handler. */
@@ -620,6 +705,7 @@ static int signal_triggered_work(struct k_poll_event *event, uint32_t status)
 	return 0;
 }
 
+/* Must be called with the poller lock of @p work held, releases it */
 static int triggered_work_cancel(struct k_work_poll *work,
 				 k_spinlock_key_t key)
 {
@@ -633,13 +719,19 @@ static int triggered_work_cancel(struct k_work_poll *work,
 		 * clearing registrations.
 		 */
 		work->poller.mode = MODE_NONE;
+		k_spin_unlock(poller_lock(&work->poller), key);
 
 		/* Clear registrations and work ownership. */
-		clear_event_registrations(work->events, work->num_events, key);
+		clear_event_registrations(work->events, work->num_events);
+
+		key = k_spin_lock(poller_lock(&work->poller));
 		work->workq = NULL;
+		k_spin_unlock(poller_lock(&work->poller), key);
 		return 0;
 	}
 
+	k_spin_unlock(poller_lock(&work->poller), key);
+
 	/*
 	 * If we reached here, the work is either being registered in
 	 * the k_work_poll_submit_to_queue(), executed or is pending.
@@ -680,22 +772,22 @@ int k_work_poll_submit_to_queue(struct k_work_q *work_q,
 	SYS_PORT_TRACING_FUNC_ENTER(k_work_poll, submit_to_queue, work_q, work, timeout);
 
 	/* Take ownership of the work if it is possible. */
-	key = k_spin_lock(&lock);
+	key = k_spin_lock(poller_lock(&work->poller));
 	if (work->workq != NULL) {
 		if (work->workq == work_q) {
 			int retval;
 
 			retval = triggered_work_cancel(work, key);
 			if (retval < 0) {
-				k_spin_unlock(&lock, key);
-
 				SYS_PORT_TRACING_FUNC_EXIT(k_work_poll, submit_to_queue, work_q,
 					work, timeout, retval);
 
 				return retval;
 			}
+
+			key = k_spin_lock(poller_lock(&work->poller));
 		} else {
-			k_spin_unlock(&lock, key);
+			k_spin_unlock(poller_lock(&work->poller), key);
 
 			SYS_PORT_TRACING_FUNC_EXIT(k_work_poll, submit_to_queue, work_q,
 				work, timeout, -EADDRINUSE);
@@ -708,7 +800,7 @@ int k_work_poll_submit_to_queue(struct k_work_q *work_q,
 	work->poller.is_polling = true;
 	work->workq = work_q;
 	work->poller.mode = MODE_NONE;
-	k_spin_unlock(&lock, key);
+	k_spin_unlock(poller_lock(&work->poller), key);
 
 	/* Save list of events. */
 	work->events = events;
@@ -721,7 +813,7 @@ int k_work_poll_submit_to_queue(struct k_work_q *work_q,
 	events_registered = register_events(events, num_events,
 					    &work->poller, false);
 
-	key = k_spin_lock(&lock);
+	key = k_spin_lock(poller_lock(&work->poller));
 	if (work->poller.is_polling && !K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
 		/*
 		 * Poller is still polling.
@@ -739,7 +831,7 @@ int k_work_poll_submit_to_queue(struct k_work_q *work_q,
 
 		/* From now, any event will result in submitted work. */
 		work->poller.mode = MODE_TRIGGERED;
-		k_spin_unlock(&lock, key);
+		k_spin_unlock(poller_lock(&work->poller), key);
 
 		SYS_PORT_TRACING_FUNC_EXIT(k_work_poll, submit_to_queue, work_q, work, timeout, 0);
 
@@ -764,9 +856,10 @@ int k_work_poll_submit_to_queue(struct k_work_q *work_q,
 		work->poll_result = 0;
 	}
 
+	k_spin_unlock(poller_lock(&work->poller), key);
+
 	/* Clear registrations. */
-	clear_event_registrations(events, events_registered, key);
-	k_spin_unlock(&lock, key);
+	clear_event_registrations(events, events_registered);
 
 	/* Submit work. */
 	k_work_submit_to_queue(work_q, &work->work);
@@ -805,9 +898,8 @@ int k_work_poll_cancel(struct k_work_poll *work)
 		return -EINVAL;
 	}
 
-	key = k_spin_lock(&lock);
+	key = k_spin_lock(poller_lock(&work->poller));
 	retval = triggered_work_cancel(work, key);
-	k_spin_unlock(&lock, key);
 
 	SYS_PORT_TRACING_FUNC_EXIT(k_work_poll, cancel, work, retval);
 
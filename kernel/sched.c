@@ -89,7 +89,9 @@ int32_t z_sched_prio_cmp(struct k_thread *thread_1,
 
 static ALWAYS_INLINE void *thread_runq(struct k_thread *thread)
 {
-#ifdef CONFIG_SCHED_CPU_MASK_PIN_ONLY
+#if defined(CONFIG_SCHED_WORK_STEALING)
+	return &_kernel.cpus[thread->base.runq_cpu].ready_q.runq;
+#elif defined(CONFIG_SCHED_CPU_MASK_PIN_ONLY)
 	int cpu, m = thread->base.cpu_mask;
 
 	/* Edge case: it's legal per the API to "make runnable" a
@@ -104,35 +106,182 @@ static ALWAYS_INLINE void *thread_runq(struct k_thread *thread)
 #else
 	ARG_UNUSED(thread);
 	return &_kernel.ready_q.runq;
-#endif /* CONFIG_SCHED_CPU_MASK_PIN_ONLY */
+#endif /* CONFIG_SCHED_WORK_STEALING */
 }
 
 static ALWAYS_INLINE void *curr_cpu_runq(void)
 {
-#ifdef CONFIG_SCHED_CPU_MASK_PIN_ONLY
+#ifdef CONFIG_SCHED_CPU_READY_Q
 	return &arch_curr_cpu()->ready_q.runq;
 #else
 	return &_kernel.ready_q.runq;
-#endif /* CONFIG_SCHED_CPU_MASK_PIN_ONLY */
+#endif /* CONFIG_SCHED_CPU_READY_Q */
 }
 
+#ifdef CONFIG_SCHED_WORK_STEALING
+/* Each CPU's ready queue is modified under its own lock, nested
+ * inside _sched_spinlock, and publishes its head thread.  Choosing a
+ * queue or a thread to steal then only compares the published heads
+ * and never walks or locks another CPU's queue.
+ */
+static struct k_spinlock runq_locks[CONFIG_MP_MAX_NUM_CPUS];
+static struct k_thread *runq_heads[CONFIG_MP_MAX_NUM_CPUS];
+#endif /* CONFIG_SCHED_WORK_STEALING */
+
 static ALWAYS_INLINE void runq_add(struct k_thread *thread)
 {
 	__ASSERT_NO_MSG(!z_is_idle_thread_object(thread));
 
+#ifdef CONFIG_SCHED_WORK_STEALING
+	uint8_t cpu = thread->base.runq_cpu;
+
+	K_SPINLOCK(&runq_locks[cpu]) {
+		struct k_thread *head = runq_heads[cpu];
+
+		_priq_run_add(thread_runq(thread), thread);
+		if ((head == NULL) || (z_sched_prio_cmp(thread, head) > 0)) {
+			runq_heads[cpu] = thread;
+		}
+	}
+#else
 	_priq_run_add(thread_runq(thread), thread);
+#endif /* CONFIG_SCHED_WORK_STEALING */
 }
 
 static ALWAYS_INLINE void runq_remove(struct k_thread *thread)
 {
 	__ASSERT_NO_MSG(!z_is_idle_thread_object(thread));
 
+#ifdef CONFIG_SCHED_WORK_STEALING
+	uint8_t cpu = thread->base.runq_cpu;
+
+	K_SPINLOCK(&runq_locks[cpu]) {
+		_priq_run_remove(thread_runq(thread), thread);
+		if (runq_heads[cpu] == thread) {
+			runq_heads[cpu] = _priq_run_best(thread_runq(thread));
+		}
+	}
+#else
 	_priq_run_remove(thread_runq(thread), thread);
+#endif /* CONFIG_SCHED_WORK_STEALING */
 }
 
+#ifdef CONFIG_SCHED_WORK_STEALING
+/* The priority a CPU is effectively committed to: the higher of its
+ * running thread and the best thread already waiting in its queue.
+ */
+static struct k_thread *cpu_committed_thread(struct _cpu *cpu)
+{
+	struct k_thread *queued = runq_heads[cpu->id];
+	struct k_thread *running = cpu->current;
+
+	if ((queued != NULL) &&
+	    ((running == NULL) || (z_sched_prio_cmp(queued, running) > 0))) {
+		return queued;
+	}
+	return running;
+}
+
+static bool cpu_preemptible_by(struct _cpu *cpu, struct k_thread *thread)
+{
+	struct k_thread *running = cpu->current;
+	struct k_thread *committed;
+
+	if (running == NULL) {
+		/* CPU not started yet */
+		return false;
+	}
+
+	committed = cpu_committed_thread(cpu);
+
+	return z_is_idle_thread_object(committed) || thread_is_metairq(thread) ||
+	       ((z_sched_prio_cmp(thread, committed) > 0) &&
+		thread_is_preemptible(running));
+}
+
+/* Pick the ready queue for a thread being made runnable.  The CPU it
+ * last ran on is preferred (cache affinity) if the thread would run
+ * there right away.  Otherwise an idle CPU, or the one committed to
+ * the lowest priority work that the thread can preempt, is used.
+ * Failing that the thread waits on its last CPU until that CPU, or
+ * another one that runs out of better work, picks it up.
+ */
+static uint8_t runq_select_cpu(struct k_thread *thread)
+{
+	unsigned int num_cpus = arch_num_cpus();
+	uint8_t target = thread->base.cpu;
+	struct k_thread *lowest = NULL;
+
+	if (cpu_preemptible_by(&_kernel.cpus[target], thread)) {
+		return target;
+	}
+
+	for (unsigned int i = 0; i < num_cpus; i++) {
+		struct _cpu *cpu = &_kernel.cpus[i];
+		struct k_thread *committed;
+
+		if (!cpu_preemptible_by(cpu, thread)) {
+			continue;
+		}
+
+		committed = cpu_committed_thread(cpu);
+		if (z_is_idle_thread_object(committed)) {
+			return i;
+		}
+
+		if ((lowest == NULL) || (z_sched_prio_cmp(lowest, committed) > 0)) {
+			lowest = committed;
+			target = i;
+		}
+	}
+
+	return target;
+}
+
+/* Best candidate for this CPU: the head of its own queue, unless some
+ * other CPU's queue holds a strictly higher priority thread (or our
+ * own queue is empty), in which case that thread is stolen.  The
+ * caller dequeues whatever is returned from the queue it lives in.
+ */
+static struct k_thread *runq_best_or_steal(void)
+{
+	unsigned int num_cpus = arch_num_cpus();
+	struct k_thread *best = runq_heads[_current_cpu->id];
+
+	for (unsigned int i = 0; i < num_cpus; i++) {
+		struct k_thread *thread;
+
+		if (i == _current_cpu->id) {
+			continue;
+		}
+
+		thread = runq_heads[i];
+		if ((thread != NULL) &&
+		    ((best == NULL) || (z_sched_prio_cmp(thread, best) > 0))) {
+			best = thread;
+		}
+	}
+
+	return best;
+}
+#endif /* CONFIG_SCHED_WORK_STEALING */
+
 static ALWAYS_INLINE struct k_thread *runq_best(void)
 {
+#ifdef CONFIG_SCHED_WORK_STEALING
+	return runq_best_or_steal();
+#else
 	return _priq_run_best(curr_cpu_runq());
+#endif /* CONFIG_SCHED_WORK_STEALING */
+}
+
+/* Puts a thread that was running on this CPU back into the run queue */
+static ALWAYS_INLINE void runq_requeue_local(struct k_thread *thread)
+{
+#ifdef CONFIG_SCHED_WORK_STEALING
+	thread->base.runq_cpu = _current_cpu->id;
+#endif /* CONFIG_SCHED_WORK_STEALING */
+	runq_add(thread);
 }
 
 /* arch_current_thread() is never in the run queue until context switch on
@@ -147,6 +296,9 @@ static ALWAYS_INLINE void queue_thread(struct k_thread *thread)
 {
 	thread->base.thread_state |= _THREAD_QUEUED;
 	if (should_queue_thread(thread)) {
+#ifdef CONFIG_SCHED_WORK_STEALING
+		thread->base.runq_cpu = runq_select_cpu(thread);
+#endif /* CONFIG_SCHED_WORK_STEALING */
 		runq_add(thread);
 	}
 #ifdef CONFIG_SMP
@@ -174,7 +326,7 @@ static ALWAYS_INLINE void dequeue_thread(struct k_thread *thread)
 void z_requeue_current(struct k_thread *thread)
 {
 	if (z_is_thread_queued(thread)) {
-		runq_add(thread);
+		runq_requeue_local(thread);
 	}
 	signal_pending_ipi();
 }
@@ -348,7 +500,7 @@ static ALWAYS_INLINE void update_cache(int preempt_ok)
 #endif /* CONFIG_SMP */
 }
 
-static struct _cpu *thread_active_elsewhere(struct k_thread *thread)
+struct _cpu *thread_active_elsewhere(struct k_thread *thread)
 {
 	/* Returns pointer to _cpu if the thread is currently running on
 	 * another CPU. There are more scalable designs to answer this
@@ -382,6 +534,7 @@ static void ready_thread(struct k_thread *thread)
 	if (!z_is_thread_queued(thread) && z_is_thread_ready(thread)) {
 		SYS_PORT_TRACING_OBJ_FUNC(k_thread, sched_ready, thread);
 
+		z_sched_usage_ready(thread);
 		queue_thread(thread);
 		update_cache(0);
 
@@ -919,13 +1072,16 @@ void *z_get_next_switch_handle(void *interrupted)
 			 * will not return into it.
 			 */
 			if (z_is_thread_queued(old_thread)) {
+				/* Requeue first: the IPI target depends on
+				 * the queue the thread is placed in.
+				 */
+				runq_requeue_local(old_thread);
 #ifdef CONFIG_SCHED_IPI_CASCADE
 				if ((new_thread->base.cpu_mask != -1) &&
 				    (old_thread->base.cpu_mask != BIT(cpu_id))) {
 					flag_ipi(ipi_mask_create(old_thread));
 				}
 #endif
-				runq_add(old_thread);
 			}
 		}
 		old_thread->switch_handle = interrupted;
@@ -960,6 +1116,29 @@ int z_unpend_all(_wait_q_t *wait_q)
 	return need_sched;
 }
 
+unsigned int z_waitq_requeue(_wait_q_t *from, _wait_q_t *to, unsigned int count)
+{
+	unsigned int moved = 0U;
+	struct k_thread *thread;
+
+	K_SPINLOCK(&_sched_spinlock) {
+		while (moved < count) {
+			thread = _priq_wait_best(&from->waitq);
+			if (thread == NULL) {
+				break;
+			}
+
+			/* Still pending, with the same timeout */
+			_priq_wait_remove(&from->waitq, thread);
+			thread->base.pended_on = to;
+			_priq_wait_add(&to->waitq, thread);
+			moved++;
+		}
+	}
+
+	return moved;
+}
+
 void init_ready_q(struct _ready_q *ready_q)
 {
 	_priq_run_init(&ready_q->runq);
@@ -967,13 +1146,13 @@ void init_ready_q(struct _ready_q *ready_q)
 
 void z_sched_init(void)
 {
-#ifdef CONFIG_SCHED_CPU_MASK_PIN_ONLY
+#ifdef CONFIG_SCHED_CPU_READY_Q
 	for (int i = 0; i < CONFIG_MP_MAX_NUM_CPUS; i++) {
 		init_ready_q(&_kernel.cpus[i].ready_q);
 	}
 #else
 	init_ready_q(&_kernel.ready_q);
-#endif /* CONFIG_SCHED_CPU_MASK_PIN_ONLY */
+#endif /* CONFIG_SCHED_CPU_READY_Q */
 }
 
 void z_impl_k_thread_priority_set(k_tid_t thread, int prio)
@@ -32,11 +32,25 @@
 /* We use a system-wide lock to synchronize semaphores, which has
  * unfortunate performance impact vs. using a per-object lock
  * (semaphores are *very* widely used).  But per-object locks require
- * significant extra RAM.  A properly spin-aware semaphore
- * implementation would spin on atomic access to the count variable,
- * and not a spinlock per se.  Useful optimization for the future...
+ * significant extra RAM, so they are only used when
+ * CONFIG_KERNEL_SYNC_OBJ_LOCKS is enabled.  A properly spin-aware
+ * semaphore implementation would spin on atomic access to the count
+ * variable, and not a spinlock per se.  Useful optimization for the
+ * future...
  */
-static struct k_spinlock lock;
+#ifndef CONFIG_KERNEL_SYNC_OBJ_LOCKS
+static struct k_spinlock global_lock;
+#endif /* !CONFIG_KERNEL_SYNC_OBJ_LOCKS */
+
+static inline struct k_spinlock *sem_lock(struct k_sem *sem)
+{
+#ifdef CONFIG_KERNEL_SYNC_OBJ_LOCKS
+	return &sem->lock;
+#else
+	ARG_UNUSED(sem);
+	return &global_lock;
+#endif /* CONFIG_KERNEL_SYNC_OBJ_LOCKS */
+}
 
 #ifdef CONFIG_OBJ_CORE_SEM
 static struct k_obj_type obj_type_sem;
@@ -56,6 +70,9 @@ int z_impl_k_sem_init(struct k_sem *sem, unsigned int initial_count,
 
 	sem->count = initial_count;
 	sem->limit = limit;
+#ifdef CONFIG_KERNEL_SYNC_OBJ_LOCKS
+	sem->lock = (struct k_spinlock) {};
+#endif
 
 	SYS_PORT_TRACING_OBJ_FUNC(k_sem, init, sem, 0);
 
@@ -95,7 +112,8 @@ static inline bool handle_poll_events(struct k_sem *sem)
 
 void z_impl_k_sem_give(struct k_sem *sem)
 {
-	k_spinlock_key_t key = k_spin_lock(&lock);
+	struct k_spinlock *lock = sem_lock(sem);
+	k_spinlock_key_t key = k_spin_lock(lock);
 	struct k_thread *thread;
 	bool resched = true;
 
@@ -112,9 +130,9 @@ void z_impl_k_sem_give(struct k_sem *sem)
 	}
 
 	if (unlikely(resched)) {
-		z_reschedule(&lock, key);
+		z_reschedule(lock, key);
 	} else {
-		k_spin_unlock(&lock, key);
+		k_spin_unlock(lock, key);
 	}
 
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_sem, give, sem);
@@ -131,31 +149,32 @@ static inline void z_vrfy_k_sem_give(struct k_sem *sem)
 
 int z_impl_k_sem_take(struct k_sem *sem, k_timeout_t timeout)
 {
+	struct k_spinlock *lock = sem_lock(sem);
 	int ret;
 
 	__ASSERT(((arch_is_in_isr() == false) ||
 		  K_TIMEOUT_EQ(timeout, K_NO_WAIT)), "");
 
-	k_spinlock_key_t key = k_spin_lock(&lock);
+	k_spinlock_key_t key = k_spin_lock(lock);
 
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_sem, take, sem, timeout);
 
 	if (likely(sem->count > 0U)) {
 		sem->count--;
-		k_spin_unlock(&lock, key);
+		k_spin_unlock(lock, key);
 		ret = 0;
 		goto out;
 	}
 
 	if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
-		k_spin_unlock(&lock, key);
+		k_spin_unlock(lock, key);
 		ret = -EBUSY;
 		goto out;
 	}
 
 	SYS_PORT_TRACING_OBJ_FUNC_BLOCKING(k_sem, take, sem, timeout);
 
-	ret = z_pend_curr(&lock, key, &sem->wait_q, timeout);
+	ret = z_pend_curr(lock, key, &sem->wait_q, timeout);
 
 out:
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_sem, take, sem, timeout, ret);
@@ -166,7 +185,8 @@ out:
 void z_impl_k_sem_reset(struct k_sem *sem)
 {
 	struct k_thread *thread;
-	k_spinlock_key_t key = k_spin_lock(&lock);
+	struct k_spinlock *lock = sem_lock(sem);
+	k_spinlock_key_t key = k_spin_lock(lock);
 
 	while (true) {
 		thread = z_unpend_first_thread(&sem->wait_q);
@@ -182,7 +202,7 @@ void z_impl_k_sem_reset(struct k_sem *sem)
 
 	handle_poll_events(sem);
 
-	z_reschedule(&lock, key);
+	z_reschedule(lock, key);
 }
 
 #ifdef CONFIG_USERSPACE
@@ -581,6 +581,9 @@ char *z_setup_new_thread(struct k_thread *new_thread,
 #ifdef CONFIG_EVENTS
 	new_thread->no_wake_on_timeout = false;
 #endif /* CONFIG_EVENTS */
+#ifdef CONFIG_POLL
+	new_thread->poller = (struct z_poller) {};
+#endif /* CONFIG_POLL */
 #ifdef CONFIG_THREAD_MONITOR
 	new_thread->entry.pEntry = entry;
 	new_thread->entry.parameter1 = p1;
@@ -641,6 +644,9 @@ char *z_setup_new_thread(struct k_thread *new_thread,
 	new_thread->base.usage.track_usage =
 		CONFIG_SCHED_THREAD_USAGE_AUTO_ENABLE;
 #endif /* CONFIG_SCHED_THREAD_USAGE */
+#ifdef CONFIG_SCHED_THREAD_USAGE_HISTOGRAM
+	new_thread->base.usage_ready0 = 0U;
+#endif /* CONFIG_SCHED_THREAD_USAGE_HISTOGRAM */
 
 	SYS_PORT_TRACING_OBJ_FUNC(k_thread, create, new_thread);
 
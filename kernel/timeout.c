@@ -8,13 +8,16 @@
 #include <zephyr/spinlock.h>
 #include <ksched.h>
 #include <timeout_q.h>
+#include <timeout_wheel.h>
 #include <zephyr/internal/syscall_handler.h>
 #include <zephyr/drivers/timer/system_timer.h>
 #include <zephyr/sys_clock.h>
 
 static uint64_t curr_tick;
 
+#ifndef CONFIG_TIMEOUT_QUEUE_WHEEL
 static sys_dlist_t timeout_list = SYS_DLIST_STATIC_INIT(&timeout_list);
+#endif /* !CONFIG_TIMEOUT_QUEUE_WHEEL */
 
 static struct k_spinlock timeout_lock;
 
@@ -36,6 +39,7 @@ static inline int z_vrfy_sys_clock_hw_cycles_per_sec_runtime_get(void)
 #endif /* CONFIG_USERSPACE */
 #endif /* CONFIG_TIMER_READS_ITS_FREQUENCY_AT_RUNTIME */
 
+#ifndef CONFIG_TIMEOUT_QUEUE_WHEEL
 static struct _timeout *first(void)
 {
 	sys_dnode_t *t = sys_dlist_peek_head(&timeout_list);
@@ -58,6 +62,12 @@ static void remove_timeout(struct _timeout *t)
 
 	sys_dlist_remove(&t->node);
 }
+#else
+static void remove_timeout(struct _timeout *t)
+{
+	z_timeout_wheel_remove(t);
+}
+#endif /* !CONFIG_TIMEOUT_QUEUE_WHEEL */
 
 static int32_t elapsed(void)
 {
@@ -80,22 +90,69 @@ static int32_t elapsed(void)
 	return announce_remaining == 0 ? sys_clock_elapsed() : 0U;
 }
 
-static int32_t next_timeout(void)
+/* Ticks from curr_tick to the first pending timeout, or
+ * K_TICKS_FOREVER if there is none
+ */
+static int64_t first_dticks(void)
 {
+#ifdef CONFIG_TIMEOUT_QUEUE_WHEEL
+	uint64_t next = z_timeout_wheel_next(curr_tick);
+
+	return (next == UINT64_MAX) ? K_TICKS_FOREVER : (int64_t)(next - curr_tick);
+#else
 	struct _timeout *to = first();
+
+	return (to == NULL) ? K_TICKS_FOREVER : to->dticks;
+#endif /* CONFIG_TIMEOUT_QUEUE_WHEEL */
+}
+
+static int32_t next_timeout(void)
+{
+	int64_t dticks = first_dticks();
 	int32_t ticks_elapsed = elapsed();
 	int32_t ret;
 
-	if ((to == NULL) ||
-	    ((int64_t)(to->dticks - ticks_elapsed) > (int64_t)INT_MAX)) {
+	if ((dticks == K_TICKS_FOREVER) ||
+	    ((int64_t)(dticks - ticks_elapsed) > (int64_t)INT_MAX)) {
 		ret = MAX_WAIT;
 	} else {
-		ret = MAX(0, to->dticks - ticks_elapsed);
+		ret = MAX(0, dticks - ticks_elapsed);
 	}
 
 	return ret;
 }
 
+/* Inserts a timeout with a relative dticks, returns true if it is
+ * now the first thing the queue has to act upon
+ */
+static bool insert_timeout(struct _timeout *to)
+{
+#ifdef CONFIG_TIMEOUT_QUEUE_WHEEL
+	uint64_t prev = z_timeout_wheel_next(curr_tick);
+
+	to->dticks += curr_tick;
+
+	return z_timeout_wheel_add(to, curr_tick) < prev;
+#else
+	struct _timeout *t;
+
+	for (t = first(); t != NULL; t = next(t)) {
+		if (t->dticks > to->dticks) {
+			t->dticks -= to->dticks;
+			sys_dlist_insert(&t->node, &to->node);
+			break;
+		}
+		to->dticks -= t->dticks;
+	}
+
+	if (t == NULL) {
+		sys_dlist_append(&timeout_list, &to->node);
+	}
+
+	return to == first();
+#endif /* CONFIG_TIMEOUT_QUEUE_WHEEL */
+}
+
 void z_add_timeout(struct _timeout *to, _timeout_func_t fn,
 		   k_timeout_t timeout)
 {
@@ -111,8 +168,6 @@ void z_add_timeout(struct _timeout *to, _timeout_func_t fn,
 	to->fn = fn;
 
 	K_SPINLOCK(&timeout_lock) {
-		struct _timeout *t;
-
 		if (IS_ENABLED(CONFIG_TIMEOUT_64BIT) &&
 		    (Z_TICK_ABS(timeout.ticks) >= 0)) {
 			k_ticks_t ticks = Z_TICK_ABS(timeout.ticks) - curr_tick;
@@ -122,20 +177,7 @@ void z_add_timeout(struct _timeout *to, _timeout_func_t fn,
 			to->dticks = timeout.ticks + 1 + elapsed();
 		}
 
-		for (t = first(); t != NULL; t = next(t)) {
-			if (t->dticks > to->dticks) {
-				t->dticks -= to->dticks;
-				sys_dlist_insert(&t->node, &to->node);
-				break;
-			}
-			to->dticks -= t->dticks;
-		}
-
-		if (t == NULL) {
-			sys_dlist_append(&timeout_list, &to->node);
-		}
-
-		if (to == first() && announce_remaining == 0) {
+		if (insert_timeout(to) && announce_remaining == 0) {
 			sys_clock_set_timeout(next_timeout(), false);
 		}
 	}
@@ -158,6 +200,9 @@ int z_abort_timeout(struct _timeout *to)
 /* must be locked */
 static k_ticks_t timeout_rem(const struct _timeout *timeout)
 {
+#ifdef CONFIG_TIMEOUT_QUEUE_WHEEL
+	return timeout->dticks - curr_tick;
+#else
 	k_ticks_t ticks = 0;
 
 	for (struct _timeout *t = first(); t != NULL; t = next(t)) {
@@ -168,6 +213,7 @@ static k_ticks_t timeout_rem(const struct _timeout *timeout)
 	}
 
 	return ticks;
+#endif /* CONFIG_TIMEOUT_QUEUE_WHEEL */
 }
 
 k_ticks_t z_timeout_remaining(const struct _timeout *timeout)
@@ -225,6 +271,28 @@ void sys_clock_announce(int32_t ticks)
 
 	announce_remaining = ticks;
 
+#ifdef CONFIG_TIMEOUT_QUEUE_WHEEL
+	uint64_t next;
+
+	/* Step through every tick at which the wheel needs servicing:
+	 * expire the timeouts that are due there one at a time (the
+	 * callbacks may add or abort others), or just let it cascade.
+	 */
+	while ((next = z_timeout_wheel_next(curr_tick)) - curr_tick <=
+	       (uint64_t)announce_remaining) {
+		int dt = (int)(next - curr_tick);
+		struct _timeout *t;
+
+		curr_tick = next;
+
+		while ((t = z_timeout_wheel_expire(curr_tick)) != NULL) {
+			k_spin_unlock(&timeout_lock, key);
+			t->fn(t);
+			key = k_spin_lock(&timeout_lock);
+		}
+		announce_remaining -= dt;
+	}
+#else
 	struct _timeout *t;
 
 	for (t = first();
@@ -245,6 +313,7 @@ void sys_clock_announce(int32_t ticks)
 	if (t != NULL) {
 		t->dticks -= announce_remaining;
 	}
+#endif /* CONFIG_TIMEOUT_QUEUE_WHEEL */
 
 	curr_tick += announce_remaining;
 	announce_remaining = 0;
@@ -330,7 +399,14 @@ k_timeout_t sys_timepoint_timeout(k_timepoint_t timepoint)
 #ifdef CONFIG_ZTEST
 void z_impl_sys_clock_tick_set(uint64_t tick)
 {
+#ifdef CONFIG_TIMEOUT_QUEUE_WHEEL
+	K_SPINLOCK(&timeout_lock) {
+		z_timeout_wheel_rebase(curr_tick, tick);
+		curr_tick = tick;
+	}
+#else
 	curr_tick = tick;
+#endif /* CONFIG_TIMEOUT_QUEUE_WHEEL */
 }
 
 void z_vrfy_sys_clock_tick_set(uint64_t tick)
@@ -0,0 +1,252 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/dlist.h>
+#include <zephyr/sys/math_extras.h>
+#include <zephyr/sys/util.h>
+#include <timeout_wheel.h>
+
+/* Hierarchical timing wheel.
+ *
+ * Level L has 64 slots, each covering 64^L ticks, so a whole level
+ * covers 64^(L+1) ticks.  A timeout is placed on the lowest level on
+ * which its expiry and the current tick only differ in that level's
+ * slot index (or below), i.e. the level is given by the highest bit in
+ * which they differ.  The slot is the expiry's index on that level.
+ *
+ * On level 0 a slot therefore holds timeouts expiring at exactly one
+ * tick.  On the upper levels a slot holds timeouts expiring somewhere
+ * within its span; when the current tick reaches the start of that
+ * span the slot is "cascaded": its entries are re-added, which moves
+ * them to lower levels.  Timeouts beyond the span of the top level are
+ * kept on an overflow list that is cascaded the same way whenever the
+ * top level wraps into the rotation containing the earliest of them.
+ *
+ * A bitmap of non-empty slots per level makes finding the next event
+ * a couple of count-trailing-zero operations.  Removing a timeout does
+ * not know which slot it was in, so its bit is left set and cleared
+ * lazily when the slot is next looked at and found empty.
+ */
+
+#define WHEEL_BITS      6
+#define WHEEL_SLOTS     BIT(WHEEL_BITS)
+#define WHEEL_MASK      (WHEEL_SLOTS - 1)
+#define WHEEL_LEVELS    CONFIG_TIMEOUT_QUEUE_WHEEL_LEVELS
+#define WHEEL_SPAN_BITS (WHEEL_BITS * WHEEL_LEVELS)
+
+BUILD_ASSERT(WHEEL_SPAN_BITS < 64);
+
+struct wheel_level {
+	uint64_t occupied;
+	sys_dlist_t slots[WHEEL_SLOTS];
+};
+
+static struct wheel_level levels[WHEEL_LEVELS];
+
+static sys_dlist_t overflow;
+
+/* Tick at which the overflow list must next be cascaded */
+static uint64_t overflow_next = UINT64_MAX;
+
+/* The slot lists can't be statically initialized, and timeouts may
+ * already be added during early boot.
+ */
+static bool initialized;
+
+static void wheel_init(void)
+{
+	for (int l = 0; l < WHEEL_LEVELS; l++) {
+		for (int s = 0; s < WHEEL_SLOTS; s++) {
+			sys_dlist_init(&levels[l].slots[s]);
+		}
+	}
+	sys_dlist_init(&overflow);
+	initialized = true;
+}
+
+static inline unsigned int slot_index(uint64_t tick, int level)
+{
+	return (tick >> (level * WHEEL_BITS)) & WHEEL_MASK;
+}
+
+/* First tick covered by slot @slot of level @level in the current
+ * rotation of that level.
+ */
+static inline uint64_t slot_start(uint64_t now, int level, unsigned int slot)
+{
+	unsigned int shift = level * WHEEL_BITS;
+	uint64_t base = now & ~(BIT64(shift + WHEEL_BITS) - 1U);
+
+	return base | ((uint64_t)slot << shift);
+}
+
+uint64_t z_timeout_wheel_add(struct _timeout *to, uint64_t now)
+{
+	uint64_t expiry = (uint64_t)to->dticks;
+	uint64_t event;
+	unsigned int slot;
+	int level;
+
+	if (unlikely(!initialized)) {
+		wheel_init();
+	}
+
+	if (expiry <= now) {
+		/* Already due: fire at the next opportunity */
+		level = 0;
+		slot = slot_index(now, 0);
+		event = now;
+	} else {
+		level = (63 - u64_count_leading_zeros(expiry ^ now)) / WHEEL_BITS;
+
+		if (level >= WHEEL_LEVELS) {
+			uint64_t start = expiry & ~(BIT64(WHEEL_SPAN_BITS) - 1U);
+
+			sys_dlist_append(&overflow, &to->node);
+			overflow_next = MIN(overflow_next, start);
+			return start;
+		}
+
+		slot = slot_index(expiry, level);
+		event = slot_start(expiry, level, slot);
+	}
+
+	sys_dlist_append(&levels[level].slots[slot], &to->node);
+	levels[level].occupied |= BIT64(slot);
+
+	return event;
+}
+
+void z_timeout_wheel_remove(struct _timeout *to)
+{
+	sys_dlist_remove(&to->node);
+}
+
+uint64_t z_timeout_wheel_next(uint64_t now)
+{
+	for (int l = 0; l < WHEEL_LEVELS; l++) {
+		struct wheel_level *lvl = &levels[l];
+
+		while (lvl->occupied != 0U) {
+			unsigned int slot = u64_count_trailing_zeros(lvl->occupied);
+
+			if (sys_dlist_is_empty(&lvl->slots[slot])) {
+				lvl->occupied &= ~BIT64(slot);
+				continue;
+			}
+
+			/* Every timeout on a lower level expires before
+			 * anything on a higher one, so the first non-empty
+			 * level decides.  Slots before the current index
+			 * can only exist after the tick was moved without
+			 * servicing the wheel; they are due right away.
+			 */
+			if (slot < slot_index(now, l)) {
+				return now;
+			}
+
+			return MAX(now, slot_start(now, l, slot));
+		}
+	}
+
+	return (overflow_next == UINT64_MAX) ? UINT64_MAX : MAX(now, overflow_next);
+}
+
+static void cascade(sys_dlist_t *list, uint64_t now)
+{
+	sys_dnode_t *node;
+
+	while ((node = sys_dlist_get(list)) != NULL) {
+		(void)z_timeout_wheel_add(CONTAINER_OF(node, struct _timeout, node),
+					  now);
+	}
+}
+
+struct _timeout *z_timeout_wheel_expire(uint64_t now)
+{
+	sys_dnode_t *node;
+
+	if (overflow_next <= now) {
+		sys_dlist_t pending;
+
+		/* Entries not due yet land on the overflow list again */
+		sys_dlist_init(&pending);
+		while ((node = sys_dlist_get(&overflow)) != NULL) {
+			sys_dlist_append(&pending, node);
+		}
+		overflow_next = UINT64_MAX;
+		cascade(&pending, now);
+	}
+
+	/* Top down, so that entries cascaded into a slot of a lower
+	 * level that is also due are moved further down right away.
+	 */
+	for (int l = WHEEL_LEVELS - 1; l > 0; l--) {
+		struct wheel_level *lvl = &levels[l];
+		uint64_t due = lvl->occupied & GENMASK64(slot_index(now, l), 0);
+
+		while (due != 0U) {
+			unsigned int slot = u64_count_trailing_zeros(due);
+
+			due &= ~BIT64(slot);
+			lvl->occupied &= ~BIT64(slot);
+			cascade(&lvl->slots[slot], now);
+		}
+	}
+
+	uint64_t due = levels[0].occupied & GENMASK64(slot_index(now, 0), 0);
+
+	while (due != 0U) {
+		unsigned int slot = u64_count_trailing_zeros(due);
+		sys_dlist_t *list = &levels[0].slots[slot];
+
+		node = sys_dlist_get(list);
+		if (sys_dlist_is_empty(list)) {
+			due &= ~BIT64(slot);
+			levels[0].occupied &= ~BIT64(slot);
+		}
+
+		if (node != NULL) {
+			return CONTAINER_OF(node, struct _timeout, node);
+		}
+	}
+
+	return NULL;
+}
+
+void z_timeout_wheel_rebase(uint64_t old_now, uint64_t new_now)
+{
+	sys_dlist_t pending;
+	sys_dnode_t *node;
+
+	if (!initialized) {
+		return;
+	}
+
+	sys_dlist_init(&pending);
+
+	for (int l = 0; l < WHEEL_LEVELS; l++) {
+		for (int s = 0; s < WHEEL_SLOTS; s++) {
+			while ((node = sys_dlist_get(&levels[l].slots[s])) != NULL) {
+				sys_dlist_append(&pending, node);
+			}
+		}
+		levels[l].occupied = 0U;
+	}
+
+	while ((node = sys_dlist_get(&overflow)) != NULL) {
+		sys_dlist_append(&pending, node);
+	}
+	overflow_next = UINT64_MAX;
+
+	while ((node = sys_dlist_get(&pending)) != NULL) {
+		struct _timeout *to = CONTAINER_OF(node, struct _timeout, node);
+
+		to->dticks += (int64_t)(new_now - old_now);
+		(void)z_timeout_wheel_add(to, new_now);
+	}
+}
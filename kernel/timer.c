@@ -12,13 +12,71 @@
 #include <zephyr/spinlock.h>
 #include <ksched.h>
 #include <wait_q.h>
+#include <ipi.h>
 
 static struct k_spinlock lock;
 
+#ifdef CONFIG_TIMER_CPU_EXPIRY
+/* Timers that expired while the tick was announced on another CPU than
+ * the one they run on, waiting for their CPU to take the IPI.  Protected
+ * by the timer lock.
+ */
+static sys_slist_t cpu_expired[CONFIG_MP_MAX_NUM_CPUS];
+
+/* Must be called with the timer lock held */
+static bool cpu_expired_remove(struct k_timer *timer)
+{
+	if (!timer->cpu_queued) {
+		return false;
+	}
+
+	timer->cpu_queued = false;
+
+	return sys_slist_find_and_remove(&cpu_expired[timer->cpu],
+					 &timer->cpu_node);
+}
+#endif /* CONFIG_TIMER_CPU_EXPIRY */
+
 #ifdef CONFIG_OBJ_CORE_TIMER
 static struct k_obj_type obj_type_timer;
 #endif /* CONFIG_OBJ_CORE_TIMER */
 
+/* Runs the expiry function of @p timer and wakes up the thread waiting on
+ * it.  Must be called with the timer lock held, which is released.
+ */
+static void timer_expire(struct k_timer *timer, k_spinlock_key_t key)
+{
+	struct k_thread *thread;
+
+	/* invoke timer expiry function */
+	if (timer->expiry_fn != NULL) {
+		/* Unlock for user handler. */
+		k_spin_unlock(&lock, key);
+		timer->expiry_fn(timer);
+		key = k_spin_lock(&lock);
+	}
+
+	if (!IS_ENABLED(CONFIG_MULTITHREADING)) {
+		k_spin_unlock(&lock, key);
+		return;
+	}
+
+	thread = z_waitq_head(&timer->wait_q);
+
+	if (thread == NULL) {
+		k_spin_unlock(&lock, key);
+		return;
+	}
+
+	z_unpend_thread_no_timeout(thread);
+
+	arch_thread_return_value_set(thread, 0);
+
+	k_spin_unlock(&lock, key);
+
+	z_ready_thread(thread);
+}
+
 /**
  * @brief Handle expiration of a kernel timer object.
  *
@@ -27,7 +85,6 @@ static struct k_obj_type obj_type_timer;
 void z_timer_expiration_handler(struct _timeout *t)
 {
 	struct k_timer *timer = CONTAINER_OF(t, struct k_timer, timeout);
-	struct k_thread *thread;
 	k_spinlock_key_t key = k_spin_lock(&lock);
 
 	/* In sys_clock_announce(), when a timeout expires, it is first removed
@@ -80,34 +137,46 @@ void z_timer_expiration_handler(struct _timeout *t)
 	/* update timer's status */
 	timer->status += 1U;
 
-	/* invoke timer expiry function */
-	if (timer->expiry_fn != NULL) {
-		/* Unlock for user handler. */
+#ifdef CONFIG_TIMER_CPU_EXPIRY
+	if (timer->cpu != _current_cpu->id) {
+		/* A periodic timer still queued from its previous expiry
+		 * runs its expiry function once for both.
+		 */
+		if (!timer->cpu_queued) {
+			timer->cpu_queued = true;
+			sys_slist_append(&cpu_expired[timer->cpu],
+					 &timer->cpu_node);
+			flag_ipi(IPI_CPU_MASK(timer->cpu));
+		}
 		k_spin_unlock(&lock, key);
-		timer->expiry_fn(timer);
-		key = k_spin_lock(&lock);
-	}
 
-	if (!IS_ENABLED(CONFIG_MULTITHREADING)) {
-		k_spin_unlock(&lock, key);
+		signal_pending_ipi();
 		return;
 	}
+#endif /* CONFIG_TIMER_CPU_EXPIRY */
 
-	thread = z_waitq_head(&timer->wait_q);
+	timer_expire(timer, key);
+}
 
-	if (thread == NULL) {
-		k_spin_unlock(&lock, key);
-		return;
-	}
+#ifdef CONFIG_TIMER_CPU_EXPIRY
+void z_timer_cpu_expiry(void)
+{
+	sys_slist_t *expired = &cpu_expired[_current_cpu->id];
+	k_spinlock_key_t key = k_spin_lock(&lock);
+	sys_snode_t *node;
 
-	z_unpend_thread_no_timeout(thread);
+	while ((node = sys_slist_get(expired)) != NULL) {
+		struct k_timer *timer = CONTAINER_OF(node, struct k_timer, cpu_node);
 
-	arch_thread_return_value_set(thread, 0);
+		timer->cpu_queued = false;
+		timer_expire(timer, key);
 
-	k_spin_unlock(&lock, key);
+		key = k_spin_lock(&lock);
+	}
 
-	z_ready_thread(thread);
+	k_spin_unlock(&lock, key);
 }
+#endif /* CONFIG_TIMER_CPU_EXPIRY */
 
 
 void k_timer_init(struct k_timer *timer,
@@ -128,6 +197,12 @@ void k_timer_init(struct k_timer *timer,
 
 	timer->user_data = NULL;
 
+#ifdef CONFIG_TIMER_CPU_EXPIRY
+	timer->cpu = 0U;
+	timer->cpu_pin = 0U;
+	timer->cpu_queued = false;
+#endif /* CONFIG_TIMER_CPU_EXPIRY */
+
 	k_object_init(timer);
 
 #ifdef CONFIG_OBJ_CORE_TIMER
@@ -174,6 +249,12 @@ void z_impl_k_timer_start(struct k_timer *timer, k_timeout_t duration,
 	timer->period = period;
 	timer->status = 0U;
 
+#ifdef CONFIG_TIMER_CPU_EXPIRY
+	/* A pending expiry of the previous run is dropped */
+	(void)cpu_expired_remove(timer);
+	timer->cpu = (timer->cpu_pin != 0U) ? (timer->cpu_pin - 1U) : _current_cpu->id;
+#endif /* CONFIG_TIMER_CPU_EXPIRY */
+
 	z_add_timeout(&timer->timeout, z_timer_expiration_handler,
 		     duration);
 
@@ -197,6 +278,15 @@ void z_impl_k_timer_stop(struct k_timer *timer)
 
 	bool inactive = (z_abort_timeout(&timer->timeout) != 0);
 
+#ifdef CONFIG_TIMER_CPU_EXPIRY
+	/* Stopped before its expiry function got to run on its CPU */
+	K_SPINLOCK(&lock) {
+		if (cpu_expired_remove(timer)) {
+			inactive = false;
+		}
+	}
+#endif /* CONFIG_TIMER_CPU_EXPIRY */
+
 	if (inactive) {
 		return;
 	}
@@ -215,6 +305,21 @@ void z_impl_k_timer_stop(struct k_timer *timer)
 	}
 }
 
+#ifdef CONFIG_TIMER_CPU_EXPIRY
+int k_timer_cpu_set(struct k_timer *timer, int cpu)
+{
+	if ((cpu < -1) || (cpu >= (int)arch_num_cpus())) {
+		return -EINVAL;
+	}
+
+	K_SPINLOCK(&lock) {
+		timer->cpu_pin = (uint8_t)(cpu + 1);
+	}
+
+	return 0;
+}
+#endif /* CONFIG_TIMER_CPU_EXPIRY */
+
 #ifdef CONFIG_USERSPACE
 static inline void z_vrfy_k_timer_stop(struct k_timer *timer)
 {
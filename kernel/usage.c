@@ -10,6 +10,7 @@
 #include <ksched.h>
 #include <zephyr/spinlock.h>
 #include <zephyr/sys/check.h>
+#include <zephyr/sys/math_extras.h>
 
 /* Need one of these for this to work */
 #if !defined(CONFIG_USE_SWITCH) && !defined(CONFIG_INSTRUMENT_THREAD_SWITCHING)
@@ -58,6 +59,111 @@ static void sched_cpu_update_usage(struct _cpu *cpu, uint32_t cycles)
 #define sched_cpu_update_usage(cpu, cycles)   do { } while (0)
 #endif /* CONFIG_SCHED_THREAD_USAGE_ALL */
 
+#ifdef CONFIG_SCHED_THREAD_USAGE_HISTOGRAM
+/*
+ * The histograms are only updated on context switch, by the CPU switching,
+ * and are read without locking: a reader racing with a context switch may
+ * miss the last update, which does not matter for distributions.
+ */
+
+static inline unsigned int usage_hist_bin(uint32_t cycles)
+{
+	uint32_t val = cycles >> CONFIG_SCHED_THREAD_USAGE_HISTOGRAM_SHIFT;
+	unsigned int bin = (val == 0U) ? 0U : (32U - u32_count_leading_zeros(val));
+
+	return MIN(bin, CONFIG_SCHED_THREAD_USAGE_HISTOGRAM_BINS - 1U);
+}
+
+static void usage_hist_latency(struct k_sched_histogram *hist, uint32_t cycles)
+{
+	hist->latency[usage_hist_bin(cycles)]++;
+
+	if (hist->latency_max < cycles) {
+		hist->latency_max = cycles;
+	}
+}
+
+static void usage_hist_start(struct _cpu *cpu, struct k_thread *thread, uint32_t now)
+{
+	uint32_t ready0 = thread->base.usage_ready0;
+
+	cpu->usage_run0 = now;
+
+	if (ready0 == 0U) {
+		return;
+	}
+
+	thread->base.usage_ready0 = 0U;
+
+	if (thread->base.usage.track_usage) {
+		usage_hist_latency(&thread->base.usage.histogram, now - ready0);
+	}
+
+#ifdef CONFIG_SCHED_THREAD_USAGE_ALL
+	if (cpu->usage->track_usage) {
+		usage_hist_latency(&cpu->usage->histogram, now - ready0);
+	}
+#endif /* CONFIG_SCHED_THREAD_USAGE_ALL */
+}
+
+static void usage_hist_stop(struct _cpu *cpu, uint32_t now)
+{
+	struct k_thread *thread = cpu->current;
+	unsigned int bin;
+
+	if (cpu->usage_run0 == 0U) {
+		return;
+	}
+
+	bin = usage_hist_bin(now - cpu->usage_run0);
+	cpu->usage_run0 = 0U;
+
+	if (thread->base.usage.track_usage) {
+		thread->base.usage.histogram.run[bin]++;
+	}
+
+#ifdef CONFIG_SCHED_THREAD_USAGE_ALL
+	if (cpu->usage->track_usage && (thread != cpu->idle_thread)) {
+		cpu->usage->histogram.run[bin]++;
+	}
+#endif /* CONFIG_SCHED_THREAD_USAGE_ALL */
+}
+
+void z_sched_usage_ready(struct k_thread *thread)
+{
+	thread->base.usage_ready0 = usage_now();
+}
+
+int k_thread_runtime_histogram_get(k_tid_t thread, struct k_sched_histogram *hist)
+{
+	CHECKIF((thread == NULL) || (hist == NULL)) {
+		return -EINVAL;
+	}
+
+	*hist = thread->base.usage.histogram;
+
+	return 0;
+}
+
+int k_thread_runtime_histogram_cpu_get(int cpu, struct k_sched_histogram *hist)
+{
+	CHECKIF((cpu < 0) || (cpu >= arch_num_cpus()) || (hist == NULL)) {
+		return -EINVAL;
+	}
+
+#ifdef CONFIG_SCHED_THREAD_USAGE_ALL
+	*hist = _kernel.usage[cpu].histogram;
+#else
+	*hist = (struct k_sched_histogram) {};
+#endif /* CONFIG_SCHED_THREAD_USAGE_ALL */
+
+	return 0;
+}
+#else
+#define usage_hist_start(cpu, thread, now)   do { } while (0)
+#define usage_hist_stop(cpu, now)            do { } while (0)
+#endif /* CONFIG_SCHED_THREAD_USAGE_HISTOGRAM */
+
 static void sched_thread_update_usage(struct k_thread *thread, uint32_t cycles)
 {
 	thread->base.usage.total += cycles;
@@ -79,6 +185,7 @@ void z_sched_usage_start(struct k_thread *thread)
 	key = k_spin_lock(&usage_lock);
 
 	_current_cpu->usage0 = usage_now();   /* Always update */
+	usage_hist_start(_current_cpu, thread, _current_cpu->usage0);
 
 	if (thread->base.usage.track_usage) {
 		thread->base.usage.num_windows++;
@@ -93,6 +200,7 @@ void z_sched_usage_start(struct k_thread *thread)
 	 */
 
 	_current_cpu->usage0 = usage_now();
+	usage_hist_start(_current_cpu, thread, _current_cpu->usage0);
 #endif /* CONFIG_SCHED_THREAD_USAGE_ANALYSIS */
 }
 
@@ -105,13 +213,15 @@ void z_sched_usage_stop(void)
 	uint32_t u0 = cpu->usage0;
 
 	if (u0 != 0) {
-		uint32_t cycles = usage_now() - u0;
+		uint32_t now = usage_now();
+		uint32_t cycles = now - u0;
 
 		if (cpu->current->base.usage.track_usage) {
 			sched_thread_update_usage(cpu->current, cycles);
 		}
 
 		sched_cpu_update_usage(cpu, cycles);
+		usage_hist_stop(cpu, now);
 	}
 
 	cpu->usage0 = 0;
@@ -382,6 +492,9 @@ int z_thread_stats_reset(struct k_obj_core *obj_core)
 	stats->longest = 0ULL;
 	stats->num_windows = (thread->base.usage.track_usage) ?  1U : 0U;
 #endif /* CONFIG_SCHED_THREAD_USAGE_ANALYSIS */
+#ifdef CONFIG_SCHED_THREAD_USAGE_HISTOGRAM
+	stats->histogram = (struct k_sched_histogram) {};
+#endif /* CONFIG_SCHED_THREAD_USAGE_HISTOGRAM */
 
 	if (thread != _current_cpu->current) {
 
@@ -169,6 +169,7 @@ uint8_t *z_priv_stack_find(k_thread_stack_t *stack)
 struct dyn_obj {
 	struct k_object kobj;
 	sys_dnode_t dobj_list;
+	sys_snode_t hash_node;
 
 	/* The object itself */
 	void *data;
@@ -185,8 +186,45 @@ extern void z_object_gperf_wordlist_foreach(_wordlist_cb_func_t func,
 static sys_dlist_t obj_list = SYS_DLIST_STATIC_INIT(&obj_list);
 
 /*
- * TODO: Write some hash table code that will replace obj_list.
+ * Hash table of allocated kernel objects, keyed on the object address,
+ * for looking them up when validating system call arguments.  Each
+ * bucket has its own lock, so lookups of unrelated objects don't
+ * contend.
  */
+struct obj_bucket {
+	sys_slist_t list;
+	struct k_spinlock lock;
+};
+
+static struct obj_bucket obj_hash[CONFIG_DYNAMIC_OBJECTS_HASH_BUCKETS];
+
+static struct obj_bucket *obj_bucket_get(const void *obj)
+{
+	/* Fibonacci hashing: the low bits of the address are mostly
+	 * alignment, the top bits of the product mix in all of them.
+	 */
+	uint32_t hash = (uint32_t)(uintptr_t)obj * 0x9E3779B1U;
+
+	return &obj_hash[(hash >> 16) % CONFIG_DYNAMIC_OBJECTS_HASH_BUCKETS];
+}
+
+static void dyn_object_hash(struct dyn_obj *dyn)
+{
+	struct obj_bucket *bucket = obj_bucket_get(dyn->kobj.name);
+
+	K_SPINLOCK(&bucket->lock) {
+		sys_slist_prepend(&bucket->list, &dyn->hash_node);
+	}
+}
+
+static void dyn_object_unhash(struct dyn_obj *dyn)
+{
+	struct obj_bucket *bucket = obj_bucket_get(dyn->kobj.name);
+
+	K_SPINLOCK(&bucket->lock) {
+		(void)sys_slist_find_and_remove(&bucket->list, &dyn->hash_node);
+	}
+}
 
 static size_t obj_size_get(enum k_objects otype)
 {
@@ -224,17 +262,13 @@ static size_t obj_align_get(enum k_objects otype)
 
 static struct dyn_obj *dyn_object_find(const void *obj)
 {
+	struct obj_bucket *bucket = obj_bucket_get(obj);
 	struct dyn_obj *node;
 	k_spinlock_key_t key;
 
-	/* For any dynamically allocated kernel object, the object
-	 * pointer is just a member of the containing struct dyn_obj,
-	 * so just a little arithmetic is necessary to locate the
-	 * corresponding struct rbnode
-	 */
-	key = k_spin_lock(&lists_lock);
+	key = k_spin_lock(&bucket->lock);
 
-	SYS_DLIST_FOR_EACH_CONTAINER(&obj_list, node, dobj_list) {
+	SYS_SLIST_FOR_EACH_CONTAINER(&bucket->list, node, hash_node) {
 		if (node->kobj.name == obj) {
 			goto end;
 		}
@@ -244,7 +278,7 @@ static struct dyn_obj *dyn_object_find(const void *obj)
 	node = NULL;
 
  end:
-	k_spin_unlock(&lists_lock, key);
+	k_spin_unlock(&bucket->lock, key);
 
 	return node;
 }
@@ -379,6 +413,8 @@ static struct k_object *dynamic_object_create(enum k_objects otype, size_t align
 	sys_dlist_append(&obj_list, &dyn->dobj_list);
 	k_spin_unlock(&lists_lock, key);
 
+	dyn_object_hash(dyn);
+
 	return &dyn->kobj;
 }
 
@@ -470,6 +506,7 @@ void k_object_free(void *obj)
 
 	dyn = dyn_object_find(obj);
 	if (dyn != NULL) {
+		dyn_object_unhash(dyn);
 		sys_dlist_remove(&dyn->dobj_list);
 
 		if (dyn->kobj.type == K_OBJ_THREAD) {
@@ -580,6 +617,7 @@ static void unref_check(struct k_object *ko, uintptr_t index)
 		break;
 	}
 
+	dyn_object_unhash(dyn);
 	sys_dlist_remove(&dyn->dobj_list);
 	k_free(dyn->data);
 	k_free(dyn);
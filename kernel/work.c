@@ -17,6 +17,7 @@
 #include <errno.h>
 #include <ksched.h>
 #include <zephyr/sys/printk.h>
+#include <zephyr/sys/math_extras.h>
 
 static inline void flag_clear(uint32_t *flagp,
 			      uint32_t bit)
@@ -59,9 +60,97 @@ static inline uint32_t flags_get(const uint32_t *flagp)
 
 /* Lock to protect the internal state of all work items, work queues,
  * and pending_cancels.
+ *
+ * With CONFIG_KERNEL_WORK_QUEUE_LOCKS each work queue has its own lock
+ * instead, which also protects the work items associated with the
+ * queue (work->queue).  This lock then only protects items that have
+ * never been submitted, and pending_cancels has a lock of its own.
  */
 static struct k_spinlock lock;
 
+#ifdef CONFIG_KERNEL_WORK_QUEUE_LOCKS
+static struct k_spinlock cancel_lock;
+#define CANCELS_LOCKED() K_SPINLOCK(&cancel_lock)
+#else
+#define CANCELS_LOCKED()
+#endif /* CONFIG_KERNEL_WORK_QUEUE_LOCKS */
+
+/* Get the lock protecting a queue and the items associated with it. */
+static inline struct k_spinlock *queue_lock(struct k_work_q *queue)
+{
+#ifdef CONFIG_KERNEL_WORK_QUEUE_LOCKS
+	if (queue != NULL) {
+		return &queue->lock;
+	}
+#else
+	ARG_UNUSED(queue);
+#endif /* CONFIG_KERNEL_WORK_QUEUE_LOCKS */
+
+	return &lock;
+}
+
+/* The locks held while operating on a work item: the lock of the queue
+ * the item is associated with and, if different, the lock of a queue
+ * it may be moved to.  They are taken in address order.
+ */
+struct work_lock {
+	struct k_spinlock *lock[2];
+	k_spinlock_key_t key[2];
+};
+
+/* Take two locks, or one if they are the same, in address order. */
+static void work_lock_pair(struct k_spinlock *a, struct k_spinlock *b,
+			   struct work_lock *wl)
+{
+	if ((uintptr_t)a <= (uintptr_t)b) {
+		wl->lock[0] = a;
+		wl->lock[1] = b;
+	} else {
+		wl->lock[0] = b;
+		wl->lock[1] = a;
+	}
+
+	wl->key[0] = k_spin_lock(wl->lock[0]);
+	if (wl->lock[1] != wl->lock[0]) {
+		wl->key[1] = k_spin_lock(wl->lock[1]);
+	}
+}
+
+static void work_unlock(struct work_lock *wl)
+{
+	if (wl->lock[1] != wl->lock[0]) {
+		k_spin_unlock(wl->lock[1], wl->key[1]);
+	}
+	k_spin_unlock(wl->lock[0], wl->key[0]);
+}
+
+/* Lock a work item, and optionally a queue it may be submitted to.
+ *
+ * The item's queue association can only change while its current
+ * queue's lock is held, so it is re-checked once the locks are taken.
+ *
+ * @param work the work item
+ * @param queue a queue the item may be moved to, or NULL
+ * @param wl storage for the held locks, to be passed to work_unlock()
+ */
+static void work_lock(const struct k_work *work, struct k_work_q *queue,
+		      struct work_lock *wl)
+{
+	while (true) {
+		struct k_spinlock *home = queue_lock(work->queue);
+		struct k_spinlock *other = (queue != NULL) ? queue_lock(queue) : home;
+
+		work_lock_pair(home, other, wl);
+
+		if (queue_lock(work->queue) == home) {
+			return;
+		}
+
+		/* Moved to another queue while we were spinning */
+		work_unlock(wl);
+	}
+}
+
 /* Invoked by work thread */
 static void handle_flush(struct k_work *work) { }
 
@@ -89,7 +178,9 @@ static inline void init_work_cancel(struct z_work_canceller *canceler,
 {
 	k_sem_init(&canceler->sem, 0, 1);
 	canceler->work = work;
-	sys_slist_append(&pending_cancels, &canceler->node);
+	CANCELS_LOCKED() {
+		sys_slist_append(&pending_cancels, &canceler->node);
+	}
 }
 
 /* Complete flushing of a work item.
@@ -137,13 +228,15 @@ static void finalize_cancel_locked(struct k_work *work)
 	 * appear multiple times in the list if multiple threads
 	 * attempt to cancel it.
 	 */
-	SYS_SLIST_FOR_EACH_CONTAINER_SAFE(&pending_cancels, wc, tmp, node) {
-		if (wc->work == work) {
-			sys_slist_remove(&pending_cancels, prev, &wc->node);
-			k_sem_give(&wc->sem);
-			break;
+	CANCELS_LOCKED() {
+		SYS_SLIST_FOR_EACH_CONTAINER_SAFE(&pending_cancels, wc, tmp, node) {
+			if (wc->work == work) {
+				sys_slist_remove(&pending_cancels, prev, &wc->node);
+				k_sem_give(&wc->sem);
+				break;
+			}
+			prev = &wc->node;
 		}
-		prev = &wc->node;
 	}
 }
 
@@ -165,10 +258,13 @@ static inline int work_busy_get_locked(const struct k_work *work)
 
 int k_work_busy_get(const struct k_work *work)
 {
-	k_spinlock_key_t key = k_spin_lock(&lock);
+	struct work_lock wl;
+
+	work_lock(work, NULL, &wl);
+
 	int ret = work_busy_get_locked(work);
 
-	k_spin_unlock(&lock, key);
+	work_unlock(&wl);
 
 	return ret;
 }
@@ -235,27 +331,23 @@ static inline bool notify_queue_locked(struct k_work_q *queue)
 	return rv;
 }
 
-/* Submit an work item to a queue if queue state allows new work.
+/* Check whether queue state allows new work.
  *
  * Submission is rejected if no queue is provided, or if the queue is
  * draining and the work isn't being submitted from the queue's
  * thread (chained submission).
  *
  * Invoked with work lock held.
- * Conditionally notifies queue.
  *
  * @param queue the queue to which work should be submitted.  This may
  * be null, in which case the submission will fail.
  *
- * @param work to be submitted
- *
- * @retval 1 if successfully queued
+ * @retval 0 if the queue accepts new work
  * @retval -EINVAL if no queue is provided
  * @retval -ENODEV if the queue is not started
  * @retval -EBUSY if the submission was rejected (draining, plugged)
  */
-static inline int queue_submit_locked(struct k_work_q *queue,
-				      struct k_work *work)
+static inline int queue_accepts_locked(struct k_work_q *queue)
 {
 	if (queue == NULL) {
 		return -EINVAL;
@@ -280,9 +372,35 @@ static inline int queue_submit_locked(struct k_work_q *queue,
 	} else if (plugged && !draining) {
 		ret = -EBUSY;
 	} else {
+		ret = 0;
+	}
+
+	return ret;
+}
+
+/* Submit an work item to a queue if queue state allows new work.
+ *
+ * Invoked with work lock held.
+ * Does not notify the queue.
+ *
+ * @param queue the queue to which work should be submitted.  This may
+ * be null, in which case the submission will fail.
+ *
+ * @param work to be submitted
+ *
+ * @retval 1 if successfully queued
+ * @retval -EINVAL if no queue is provided
+ * @retval -ENODEV if the queue is not started
+ * @retval -EBUSY if the submission was rejected (draining, plugged)
+ */
+static inline int queue_submit_locked(struct k_work_q *queue,
+				      struct k_work *work)
+{
+	int ret = queue_accepts_locked(queue);
+
+	if (ret == 0) {
 		sys_slist_append(&queue->pending, &work->node);
 		ret = 1;
-		(void)notify_queue_locked(queue);
 	}
 
 	return ret;
@@ -295,8 +413,9 @@ static inline int queue_submit_locked(struct k_work_q *queue,
  * * no candidate queue can be identified;
  * * the candidate queue rejects the submission.
  *
- * Invoked with work lock held.
- * Conditionally notifies queue.
+ * Invoked with work lock held, which must include the lock of the
+ * proposed queue (see work_lock()).
+ * Does not notify the queue, see submit_to_queue_locked().
  *
  * @param work the work structure to be submitted
 
@@ -314,8 +433,8 @@ static inline int queue_submit_locked(struct k_work_q *queue,
  * @retval -EINVAL if no queue is provided
  * @retval -ENODEV if the queue is not started
  */
-static int submit_to_queue_locked(struct k_work *work,
-				  struct k_work_q **queuep)
+static int enqueue_locked(struct k_work *work,
+			  struct k_work_q **queuep)
 {
 	int ret = 0;
 
@@ -361,6 +480,26 @@ static int submit_to_queue_locked(struct k_work *work,
 	return ret;
 }
 
+/* Attempt to submit work to a queue, and notify the queue on success.
+ *
+ * Invoked with work lock held, which must include the lock of the
+ * proposed queue (see work_lock()).
+ * Conditionally notifies queue.
+ *
+ * @retval see enqueue_locked()
+ */
+static int submit_to_queue_locked(struct k_work *work,
+				  struct k_work_q **queuep)
+{
+	int ret = enqueue_locked(work, queuep);
+
+	if (ret > 0) {
+		(void)notify_queue_locked(*queuep);
+	}
+
+	return ret;
+}
+
 /* Submit work to a queue but do not yield the current thread.
  *
  * Intended for internal use.
@@ -378,11 +517,13 @@ int z_work_submit_to_queue(struct k_work_q *queue,
 	__ASSERT_NO_MSG(work != NULL);
 	__ASSERT_NO_MSG(work->handler != NULL);
 
-	k_spinlock_key_t key = k_spin_lock(&lock);
+	struct work_lock wl;
+
+	work_lock(work, queue, &wl);
 
 	int ret = submit_to_queue_locked(work, &queue);
 
-	k_spin_unlock(&lock, key);
+	work_unlock(&wl);
 
 	return ret;
 }
@@ -419,6 +560,80 @@ int k_work_submit(struct k_work *work)
 	return ret;
 }
 
+int k_work_submit_batch_to_queue(struct k_work_q *queue,
+				 struct k_work *const *work, size_t count)
+{
+	__ASSERT_NO_MSG(queue != NULL);
+	__ASSERT_NO_MSG((work != NULL) || (count == 0U));
+
+	struct k_spinlock *qlock = queue_lock(queue);
+	struct k_spinlock *fresh = qlock;
+	struct work_lock wl;
+	int queued = 0;
+	int ret;
+
+	/* Items that were never submitted are protected by the global
+	 * lock: hold it as well if there are any.  An item can only be
+	 * associated with a queue in the meantime, which the loop below
+	 * detects.
+	 */
+	for (size_t i = 0; i < count; i++) {
+		__ASSERT_NO_MSG(work[i] != NULL);
+		__ASSERT_NO_MSG(work[i]->handler != NULL);
+
+		if (queue_lock(work[i]->queue) == &lock) {
+			fresh = &lock;
+		}
+	}
+
+	work_lock_pair(fresh, qlock, &wl);
+
+	ret = queue_accepts_locked(queue);
+	if (ret < 0) {
+		work_unlock(&wl);
+		return ret;
+	}
+
+	for (size_t i = 0; i < count; i++) {
+		struct k_work_q *target = queue;
+		struct k_spinlock *home = queue_lock(work[i]->queue);
+
+		if ((home != qlock) && (home != fresh)) {
+			/* Associated with another queue, which needs its
+			 * lock too: submit it on its own.
+			 */
+			work_unlock(&wl);
+			ret = z_work_submit_to_queue(queue, work[i]);
+			work_lock_pair(fresh, qlock, &wl);
+		} else {
+			ret = enqueue_locked(work[i], &target);
+
+			/* Without per-queue locks a running item may have
+			 * been redirected to another queue it's running on.
+			 */
+			if ((ret > 0) && (target != queue)) {
+				(void)notify_queue_locked(target);
+			}
+		}
+
+		if (ret > 0) {
+			queued++;
+		}
+	}
+
+	if (queued > 0) {
+		(void)notify_queue_locked(queue);
+	}
+
+	work_unlock(&wl);
+
+	if (queued > 0) {
+		z_reschedule_unlocked();
+	}
+
+	return queued;
+}
+
 /* Flush the work item if necessary.
  *
  * Flushing is necessary only if the work is either queued or running.
@@ -466,11 +681,13 @@ bool k_work_flush(struct k_work *work,
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_work, flush, work);
 
 	struct z_work_flusher *flusher = &sync->flusher;
-	k_spinlock_key_t key = k_spin_lock(&lock);
+	struct work_lock wl;
+
+	work_lock(work, NULL, &wl);
 
 	bool need_flush = work_flush_locked(work, flusher);
 
-	k_spin_unlock(&lock, key);
+	work_unlock(&wl);
 
 	/* If necessary wait until the flusher item completes */
 	if (need_flush) {
@@ -554,10 +771,13 @@ int k_work_cancel(struct k_work *work)
 
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_work, cancel, work);
 
-	k_spinlock_key_t key = k_spin_lock(&lock);
+	struct work_lock wl;
+
+	work_lock(work, NULL, &wl);
+
 	int ret = cancel_async_locked(work);
 
-	k_spin_unlock(&lock, key);
+	work_unlock(&wl);
 
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_work, cancel, work, ret);
 
@@ -578,7 +798,10 @@ bool k_work_cancel_sync(struct k_work *work,
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_work, cancel_sync, work, sync);
 
 	struct z_work_canceller *canceller = &sync->canceller;
-	k_spinlock_key_t key = k_spin_lock(&lock);
+	struct work_lock wl;
+
+	work_lock(work, NULL, &wl);
+
 	bool pending = (work_busy_get_locked(work) != 0U);
 	bool need_wait = false;
 
@@ -587,7 +810,7 @@ bool k_work_cancel_sync(struct k_work *work,
 		need_wait = cancel_sync_locked(work, canceller);
 	}
 
-	k_spin_unlock(&lock, key);
+	work_unlock(&wl);
 
 	if (need_wait) {
 		SYS_PORT_TRACING_OBJ_FUNC_BLOCKING(k_work, cancel_sync, work, sync);
@@ -599,6 +822,154 @@ bool k_work_cancel_sync(struct k_work *work,
 	return pending;
 }
 
+#ifdef CONFIG_WORK_POOL
+
+static inline unsigned int pool_worker_index(const struct k_work_q *queue)
+{
+	return queue - queue->pool->workers;
+}
+
+/* Check whether a pool worker may take over work from other workers.
+ *
+ * Invoked with the queue's lock held.
+ */
+static inline bool pool_may_steal_locked(struct k_work_q *queue)
+{
+	return (queue->pool != NULL) &&
+	       ((flags_get(&queue->flags) & (K_WORK_QUEUE_DRAIN |
+					     K_WORK_QUEUE_PLUGGED |
+					     K_WORK_QUEUE_STOP)) == 0U);
+}
+
+/* Check whether the first pending item of a queue can be moved to
+ * another queue.
+ *
+ * Items that are also running must stay on the queue running them, and
+ * flushers must stay behind the item they flush, which is either
+ * running or the item queued just before them.
+ *
+ * Invoked with the queue's lock held.
+ */
+static struct k_work *pool_stealable_locked(struct k_work_q *queue)
+{
+	sys_snode_t *node = sys_slist_peek_head(&queue->pending);
+	sys_snode_t *next;
+	struct k_work *work;
+
+	if (node == NULL) {
+		return NULL;
+	}
+
+	work = CONTAINER_OF(node, struct k_work, node);
+	if ((flags_get(&work->flags) &
+	     (K_WORK_RUNNING | K_WORK_FLUSHING)) != 0U) {
+		return NULL;
+	}
+
+	next = sys_slist_peek_next(node);
+	if ((next != NULL) &&
+	    flag_test(&CONTAINER_OF(next, struct k_work, node)->flags,
+		      K_WORK_FLUSHING_BIT)) {
+		return NULL;
+	}
+
+	return work;
+}
+
+/* Move the oldest pending item of another worker of the pool to a
+ * worker that has run out of work.
+ *
+ * Invoked without locks held.
+ *
+ * @param queue the idle worker
+ *
+ * @return true if an item was moved to @p queue
+ */
+static bool pool_steal(struct k_work_q *queue)
+{
+	struct k_work_pool *pool = queue->pool;
+	unsigned int self = pool_worker_index(queue);
+
+	for (unsigned int i = 1U; i < pool->num_workers; i++) {
+		struct k_work_q *victim = &pool->workers[(self + i) % pool->num_workers];
+		struct work_lock wl;
+		struct k_work *work;
+
+		/* Unlocked peek, to not bother busy workers with nothing
+		 * to spare.
+		 */
+		if (sys_slist_is_empty(&victim->pending)) {
+			continue;
+		}
+
+		work_lock_pair(queue_lock(queue), queue_lock(victim), &wl);
+
+		work = pool_may_steal_locked(queue) ?
+		       pool_stealable_locked(victim) : NULL;
+		if (work != NULL) {
+			(void)sys_slist_get(&victim->pending);
+			sys_slist_append(&queue->pending, &work->node);
+			work->queue = queue;
+		}
+
+		work_unlock(&wl);
+
+		if (work != NULL) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+/* Wake an idle worker of the pool after work was queued to a worker
+ * that already has work, so that it takes the work over.
+ *
+ * This is best effort: the state of the worker is sampled without its
+ * lock, and a worker going idle concurrently may be missed.  In either
+ * case the work is still processed by the worker it was queued to.
+ *
+ * Invoked without locks held.
+ *
+ * @param queue the worker the work was queued to
+ */
+static void pool_kick(struct k_work_q *queue)
+{
+	struct k_work_pool *pool = queue->pool;
+	unsigned int self = pool_worker_index(queue);
+	atomic_val_t idle = atomic_get(&pool->idle);
+
+	/* An idle worker was woken by the submission itself, and only
+	 * needs help if more than that one item is waiting for it.
+	 */
+	if (((idle & BIT(self)) != 0) &&
+	    (sys_slist_peek_head(&queue->pending) ==
+	     sys_slist_peek_tail(&queue->pending))) {
+		return;
+	}
+
+	idle &= ~BIT(self);
+	while (idle != 0) {
+		unsigned int i = u64_count_trailing_zeros((uint64_t)idle);
+
+		/* Claim it, so concurrent submissions wake different
+		 * workers.
+		 */
+		if (atomic_test_and_clear_bit(&pool->idle, i)) {
+			struct k_work_q *worker = &pool->workers[i];
+
+			K_SPINLOCK(queue_lock(worker)) {
+				(void)notify_queue_locked(worker);
+			}
+			return;
+		}
+
+		idle &= ~BIT(i);
+	}
+}
+
+#endif /* CONFIG_WORK_POOL */
+
 /* Loop executed by a work queue thread.
  *
  * @param workq_ptr pointer to the work queue structure
@@ -609,12 +980,16 @@ static void work_queue_main(void *workq_ptr, void *p2, void *p3)
 	ARG_UNUSED(p3);
 
 	struct k_work_q *queue = (struct k_work_q *)workq_ptr;
+	struct k_spinlock *qlock = queue_lock(queue);
+	k_spinlock_key_t key = k_spin_lock(qlock);
+
+	/* Number of items run since the last yield */
+	unsigned int batch = 0U;
 
 	while (true) {
 		sys_snode_t *node;
 		struct k_work *work = NULL;
 		k_work_handler_t handler = NULL;
-		k_spinlock_key_t key = k_spin_lock(&lock);
 		bool yield;
 
 		/* Check for and prepare any new work. */
@@ -657,7 +1032,7 @@ static void work_queue_main(void *workq_ptr, void *p2, void *p3)
 			/* User has requested that the queue stop. Clear the status flags and exit.
 			 */
 			flags_set(&queue->flags, 0);
-			k_spin_unlock(&lock, key);
+			k_spin_unlock(qlock, key);
 			return;
 		} else {
 			/* No work is available and no queue state requires
@@ -667,18 +1042,44 @@ static void work_queue_main(void *workq_ptr, void *p2, void *p3)
 		}
 
 		if (work == NULL) {
+#ifdef CONFIG_WORK_POOL
+			if (pool_may_steal_locked(queue)) {
+				bool stolen;
+
+				k_spin_unlock(qlock, key);
+				stolen = pool_steal(queue);
+				key = k_spin_lock(qlock);
+
+				if (stolen) {
+					continue;
+				}
+
+				atomic_set_bit(&queue->pool->idle,
+					       pool_worker_index(queue));
+			}
+#endif /* CONFIG_WORK_POOL */
+
 			/* Nothing's had a chance to add work since we took
 			 * the lock, and we didn't find work nor got asked to
 			 * stop.  Just go to sleep: when something happens the
 			 * work thread will be woken and we can check again.
 			 */
 
-			(void)z_sched_wait(&lock, key, &queue->notifyq,
+			(void)z_sched_wait(qlock, key, &queue->notifyq,
 					   K_FOREVER, NULL);
+			batch = 0U;
+			key = k_spin_lock(qlock);
+
+#ifdef CONFIG_WORK_POOL
+			if (queue->pool != NULL) {
+				atomic_clear_bit(&queue->pool->idle,
+						 pool_worker_index(queue));
+			}
+#endif /* CONFIG_WORK_POOL */
 			continue;
 		}
 
-		k_spin_unlock(&lock, key);
+		k_spin_unlock(qlock, key);
 
 		__ASSERT_NO_MSG(handler != NULL);
 		handler(work);
@@ -688,7 +1089,7 @@ static void work_queue_main(void *workq_ptr, void *p2, void *p3)
 		 * was running.  Clear the BUSY flag and optionally
 		 * yield to prevent starving other threads.
 		 */
-		key = k_spin_lock(&lock);
+		key = k_spin_lock(qlock);
 
 		flag_clear(&work->flags, K_WORK_RUNNING_BIT);
 		if (flag_test(&work->flags, K_WORK_FLUSHING_BIT)) {
@@ -700,13 +1101,22 @@ static void work_queue_main(void *workq_ptr, void *p2, void *p3)
 
 		flag_clear(&queue->flags, K_WORK_QUEUE_BUSY_BIT);
 		yield = !flag_test(&queue->flags, K_WORK_QUEUE_NO_YIELD_BIT);
-		k_spin_unlock(&lock, key);
 
-		/* Optionally yield to prevent the work queue from
-		 * starving other threads.
+		/* When batching, keep the lock and go straight on to the
+		 * next pending item until the batch is complete.
 		 */
-		if (yield) {
+		batch++;
+		if (yield && ((batch >= queue->batch_size) ||
+			      sys_slist_is_empty(&queue->pending))) {
+			k_spin_unlock(qlock, key);
+
+			/* Yield to prevent the work queue from starving
+			 * other threads.
+			 */
 			k_yield();
+
+			batch = 0U;
+			key = k_spin_lock(qlock);
 		}
 	}
 }
@@ -743,6 +1153,8 @@ void k_work_queue_start(struct k_work_q *queue,
 		flags |= K_WORK_QUEUE_NO_YIELD;
 	}
 
+	queue->batch_size = (cfg != NULL) ? cfg->batch_size : 0U;
+
 	/* It hasn't actually been started yet, but all the state is in place
 	 * so we can submit things and once the thread gets control it's ready
 	 * to roll.
@@ -761,6 +1173,13 @@ void k_work_queue_start(struct k_work_q *queue,
 		queue->thread.base.user_options |= K_ESSENTIAL;
 	}
 
+#ifdef CONFIG_WORK_POOL_PIN_CPUS
+	if (queue->pool != NULL) {
+		(void)k_thread_cpu_pin(&queue->thread,
+				       pool_worker_index(queue) % arch_num_cpus());
+	}
+#endif /* CONFIG_WORK_POOL_PIN_CPUS */
+
 	k_thread_start(&queue->thread);
 
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_work_queue, start, queue);
@@ -775,7 +1194,8 @@ int k_work_queue_drain(struct k_work_q *queue,
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_work_queue, drain, queue);
 
 	int ret = 0;
-	k_spinlock_key_t key = k_spin_lock(&lock);
+	struct k_spinlock *qlock = queue_lock(queue);
+	k_spinlock_key_t key = k_spin_lock(qlock);
 
 	if (((flags_get(&queue->flags)
 	      & (K_WORK_QUEUE_BUSY | K_WORK_QUEUE_DRAIN)) != 0U)
@@ -787,10 +1207,10 @@ int k_work_queue_drain(struct k_work_q *queue,
 		}
 
 		notify_queue_locked(queue);
-		ret = z_sched_wait(&lock, key, &queue->drainq,
+		ret = z_sched_wait(qlock, key, &queue->drainq,
 				   K_FOREVER, NULL);
 	} else {
-		k_spin_unlock(&lock, key);
+		k_spin_unlock(qlock, key);
 	}
 
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_work_queue, drain, queue, ret);
@@ -805,13 +1225,23 @@ int k_work_queue_unplug(struct k_work_q *queue)
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_work_queue, unplug, queue);
 
 	int ret = -EALREADY;
-	k_spinlock_key_t key = k_spin_lock(&lock);
+	struct k_spinlock *qlock = queue_lock(queue);
+	k_spinlock_key_t key = k_spin_lock(qlock);
 
 	if (flag_test_and_clear(&queue->flags, K_WORK_QUEUE_PLUGGED_BIT)) {
 		ret = 0;
+
+#ifdef CONFIG_WORK_POOL
+		/* Pool workers don't look for work of others while
+		 * plugged, so get an idle one to do so now.
+		 */
+		if (queue->pool != NULL) {
+			(void)notify_queue_locked(queue);
+		}
+#endif /* CONFIG_WORK_POOL */
 	}
 
-	k_spin_unlock(&lock, key);
+	k_spin_unlock(qlock, key);
 
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_work_queue, unplug, queue, ret);
 
@@ -823,28 +1253,29 @@ int k_work_queue_stop(struct k_work_q *queue, k_timeout_t timeout)
 	__ASSERT_NO_MSG(queue);
 
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_work_queue, stop, queue, timeout);
-	k_spinlock_key_t key = k_spin_lock(&lock);
+	struct k_spinlock *qlock = queue_lock(queue);
+	k_spinlock_key_t key = k_spin_lock(qlock);
 
 	if (!flag_test(&queue->flags, K_WORK_QUEUE_STARTED_BIT)) {
-		k_spin_unlock(&lock, key);
+		k_spin_unlock(qlock, key);
 		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_work_queue, stop, queue, timeout, -EALREADY);
 		return -EALREADY;
 	}
 
 	if (!flag_test(&queue->flags, K_WORK_QUEUE_PLUGGED_BIT)) {
-		k_spin_unlock(&lock, key);
+		k_spin_unlock(qlock, key);
 		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_work_queue, stop, queue, timeout, -EBUSY);
 		return -EBUSY;
 	}
 
 	flag_set(&queue->flags, K_WORK_QUEUE_STOP_BIT);
 	notify_queue_locked(queue);
-	k_spin_unlock(&lock, key);
+	k_spin_unlock(qlock, key);
 	SYS_PORT_TRACING_OBJ_FUNC_BLOCKING(k_work_queue, stop, queue, timeout);
 	if (k_thread_join(&queue->thread, timeout)) {
-		key = k_spin_lock(&lock);
+		key = k_spin_lock(qlock);
 		flag_clear(&queue->flags, K_WORK_QUEUE_STOP_BIT);
-		k_spin_unlock(&lock, key);
+		k_spin_unlock(qlock, key);
 		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_work_queue, stop, queue, timeout, -ETIMEDOUT);
 		return -ETIMEDOUT;
 	}
@@ -853,8 +1284,134 @@ int k_work_queue_stop(struct k_work_q *queue, k_timeout_t timeout)
 	return 0;
 }
 
+#ifdef CONFIG_WORK_POOL
+
+void k_work_pool_init(struct k_work_pool *pool, struct k_work_q *workers,
+		      k_thread_stack_t *stacks, size_t num_workers,
+		      size_t stack_size)
+{
+	__ASSERT_NO_MSG(pool != NULL);
+	__ASSERT_NO_MSG(workers != NULL);
+	__ASSERT_NO_MSG(stacks != NULL);
+	__ASSERT_NO_MSG((num_workers > 0U) && (num_workers <= ATOMIC_BITS));
+
+	*pool = (struct k_work_pool) {
+		.workers = workers,
+		.stacks = stacks,
+		.stack_size = stack_size,
+		.num_workers = num_workers,
+	};
+}
+
+void k_work_pool_start(struct k_work_pool *pool, int prio,
+		       const struct k_work_queue_config *cfg)
+{
+	__ASSERT_NO_MSG(pool != NULL);
+	__ASSERT_NO_MSG((pool->num_workers > 0U) &&
+			(pool->num_workers <= ATOMIC_BITS));
+
+	atomic_clear(&pool->idle);
+
+	for (unsigned int i = 0U; i < pool->num_workers; i++) {
+		struct k_work_q *worker = &pool->workers[i];
+		k_thread_stack_t *stack = (k_thread_stack_t *)
+			((uint8_t *)pool->stacks +
+			 i * K_THREAD_STACK_LEN(pool->stack_size));
+
+		k_work_queue_init(worker);
+		worker->pool = pool;
+		k_work_queue_start(worker, stack, pool->stack_size, prio, cfg);
+	}
+}
+
+/* Select the worker to queue work submitted to a pool to. */
+static struct k_work_q *pool_select(struct k_work_pool *pool)
+{
+	if (!k_is_in_isr()) {
+		struct k_thread *curr = arch_current_thread();
+
+		/* Chained submission, which is also allowed while the
+		 * worker is draining.
+		 */
+		for (unsigned int i = 0U; i < pool->num_workers; i++) {
+			if (curr == &pool->workers[i].thread) {
+				return &pool->workers[i];
+			}
+		}
+	}
+
+	/* Only a hint, so racing with migration to another CPU is fine */
+	unsigned int key = arch_irq_lock();
+	unsigned int cpu = _current_cpu->id;
+
+	arch_irq_unlock(key);
+
+	return &pool->workers[cpu % pool->num_workers];
+}
+
+int k_work_pool_submit(struct k_work_pool *pool, struct k_work *work)
+{
+	__ASSERT_NO_MSG(pool != NULL);
+
+	struct k_work_q *queue = pool_select(pool);
+	int ret = z_work_submit_to_queue(queue, work);
+
+	/* Items that were running went to the worker running them,
+	 * which nobody can take them from.
+	 */
+	if (ret == 1) {
+		pool_kick(queue);
+	}
+
+	if (ret > 0) {
+		z_reschedule_unlocked();
+	}
+
+	return ret;
+}
+
+int k_work_pool_drain(struct k_work_pool *pool, bool plug)
+{
+	__ASSERT_NO_MSG(pool != NULL);
+
+	int ret = 0;
+
+	/* Keep drained workers plugged until all are, so that they don't
+	 * pick up new work meanwhile.
+	 */
+	for (unsigned int i = 0U; (i < pool->num_workers) && (ret >= 0); i++) {
+		ret = k_work_queue_drain(&pool->workers[i], true);
+	}
+
+	if (!plug) {
+		for (unsigned int i = 0U; i < pool->num_workers; i++) {
+			(void)k_work_queue_unplug(&pool->workers[i]);
+		}
+	}
+
+	return MIN(ret, 0);
+}
+
+#endif /* CONFIG_WORK_POOL */
+
 #ifdef CONFIG_SYS_CLOCK_EXISTS
 
+/* Lock a delayable work item together with the queue it is to be
+ * submitted to when its delay expires (dwork->queue).
+ */
+static void dwork_lock(struct k_work_delayable *dwork, struct work_lock *wl)
+{
+	while (true) {
+		struct k_work_q *queue = dwork->queue;
+
+		work_lock(&dwork->work, queue, wl);
+		if (dwork->queue == queue) {
+			return;
+		}
+		work_unlock(wl);
+	}
+}
+
 /* Timeout handler for delayable work.
  *
  * Invoked by timeout infrastructure.
@@ -866,8 +1423,10 @@ static void work_timeout(struct _timeout *to)
 	struct k_work_delayable *dw
 		= CONTAINER_OF(to, struct k_work_delayable, timeout);
 	struct k_work *wp = &dw->work;
-	k_spinlock_key_t key = k_spin_lock(&lock);
 	struct k_work_q *queue = NULL;
+	struct work_lock wl;
+
+	dwork_lock(dw, &wl);
 
 	/* If the work is still marked delayed (should be) then clear that
 	 * state and submit it to the queue.  If successful the queue will be
@@ -881,7 +1440,13 @@ static void work_timeout(struct _timeout *to)
 		(void)submit_to_queue_locked(wp, &queue);
 	}
 
-	k_spin_unlock(&lock, key);
+	work_unlock(&wl);
+
+#ifdef CONFIG_WORK_POOL
+	if ((queue != NULL) && (queue->pool != NULL)) {
+		pool_kick(queue);
+	}
+#endif /* CONFIG_WORK_POOL */
 }
 
 void k_work_init_delayable(struct k_work_delayable *dwork,
@@ -910,10 +1475,13 @@ int k_work_delayable_busy_get(const struct k_work_delayable *dwork)
 {
 	__ASSERT_NO_MSG(dwork != NULL);
 
-	k_spinlock_key_t key = k_spin_lock(&lock);
+	struct work_lock wl;
+
+	work_lock(&dwork->work, NULL, &wl);
+
 	int ret = work_delayable_busy_get_locked(dwork);
 
-	k_spin_unlock(&lock, key);
+	work_unlock(&wl);
 	return ret;
 }
 
@@ -1017,14 +1585,16 @@ int k_work_schedule_for_queue(struct k_work_q *queue, struct k_work_delayable *d
 
 	struct k_work *work = &dwork->work;
 	int ret = 0;
-	k_spinlock_key_t key = k_spin_lock(&lock);
+	struct work_lock wl;
+
+	work_lock(work, queue, &wl);
 
 	/* Schedule the work item if it's idle or running. */
 	if ((work_busy_get_locked(work) & ~K_WORK_RUNNING) == 0U) {
 		ret = schedule_for_queue_locked(&queue, dwork, delay);
 	}
 
-	k_spin_unlock(&lock, key);
+	work_unlock(&wl);
 
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_work, schedule_for_queue, queue, dwork, delay, ret);
 
@@ -1051,7 +1621,9 @@ int k_work_reschedule_for_queue(struct k_work_q *queue, struct k_work_delayable
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_work, reschedule_for_queue, queue, dwork, delay);
 
 	int ret;
-	k_spinlock_key_t key = k_spin_lock(&lock);
+	struct work_lock wl;
+
+	work_lock(&dwork->work, queue, &wl);
 
 	/* Remove any active scheduling. */
 	(void)unschedule_locked(dwork);
@@ -1059,7 +1631,7 @@ int k_work_reschedule_for_queue(struct k_work_q *queue, struct k_work_delayable
 	/* Schedule the work item with the new parameters. */
 	ret = schedule_for_queue_locked(&queue, dwork, delay);
 
-	k_spin_unlock(&lock, key);
+	work_unlock(&wl);
 
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_work, reschedule_for_queue, queue, dwork, delay, ret);
 
@@ -1083,10 +1655,13 @@ int k_work_cancel_delayable(struct k_work_delayable *dwork)
 
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_work, cancel_delayable, dwork);
 
-	k_spinlock_key_t key = k_spin_lock(&lock);
+	struct work_lock wl;
+
+	work_lock(&dwork->work, NULL, &wl);
+
 	int ret = cancel_delayable_async_locked(dwork);
 
-	k_spin_unlock(&lock, key);
+	work_unlock(&wl);
 
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_work, cancel_delayable, dwork, ret);
 
@@ -1106,7 +1681,10 @@ bool k_work_cancel_delayable_sync(struct k_work_delayable *dwork,
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_work, cancel_delayable_sync, dwork, sync);
 
 	struct z_work_canceller *canceller = &sync->canceller;
-	k_spinlock_key_t key = k_spin_lock(&lock);
+	struct work_lock wl;
+
+	work_lock(&dwork->work, NULL, &wl);
+
 	bool pending = (work_delayable_busy_get_locked(dwork) != 0U);
 	bool need_wait = false;
 
@@ -1115,7 +1693,7 @@ bool k_work_cancel_delayable_sync(struct k_work_delayable *dwork,
 		need_wait = cancel_sync_locked(&dwork->work, canceller);
 	}
 
-	k_spin_unlock(&lock, key);
+	work_unlock(&wl);
 
 	if (need_wait) {
 		k_sem_take(&canceller->sem, K_FOREVER);
@@ -1139,11 +1717,13 @@ bool k_work_flush_delayable(struct k_work_delayable *dwork,
 
 	struct k_work *work = &dwork->work;
 	struct z_work_flusher *flusher = &sync->flusher;
-	k_spinlock_key_t key = k_spin_lock(&lock);
+	struct work_lock wl;
+
+	dwork_lock(dwork, &wl);
 
 	/* If it's idle release the lock and return immediately. */
 	if (work_busy_get_locked(work) == 0U) {
-		k_spin_unlock(&lock, key);
+		work_unlock(&wl);
 
 		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_work, flush_delayable, dwork, sync, false);
 
@@ -1162,7 +1742,7 @@ bool k_work_flush_delayable(struct k_work_delayable *dwork,
 	/* Wait for it to finish */
 	bool need_flush = work_flush_locked(work, flusher);
 
-	k_spin_unlock(&lock, key);
+	work_unlock(&wl);
 
 	/* If necessary wait until the flusher item completes */
 	if (need_flush) {
@@ -1174,4 +1754,38 @@ bool k_work_flush_delayable(struct k_work_delayable *dwork,
 	return need_flush;
 }
 
+#ifdef CONFIG_WORK_POOL
+
+int k_work_pool_schedule(struct k_work_pool *pool,
+			 struct k_work_delayable *dwork, k_timeout_t delay)
+{
+	__ASSERT_NO_MSG(pool != NULL);
+
+	struct k_work_q *queue = pool_select(pool);
+	int ret = k_work_schedule_for_queue(queue, dwork, delay);
+
+	if ((ret == 1) && K_TIMEOUT_EQ(delay, K_NO_WAIT)) {
+		pool_kick(queue);
+	}
+
+	return ret;
+}
+
+int k_work_pool_reschedule(struct k_work_pool *pool,
+			   struct k_work_delayable *dwork, k_timeout_t delay)
+{
+	__ASSERT_NO_MSG(pool != NULL);
+
+	struct k_work_q *queue = pool_select(pool);
+	int ret = k_work_reschedule_for_queue(queue, dwork, delay);
+
+	if ((ret == 1) && K_TIMEOUT_EQ(delay, K_NO_WAIT)) {
+		pool_kick(queue);
+	}
+
+	return ret;
+}
+
+#endif /* CONFIG_WORK_POOL */
+
 #endif /* CONFIG_SYS_CLOCK_EXISTS */
@@ -8,6 +8,7 @@
 #include <zephyr/sys/mutex.h>
 #include <zephyr/internal/syscall_handler.h>
 #include <zephyr/kernel_structs.h>
+#include <kernel_internal.h>
 
 static struct k_mutex *get_k_mutex(struct sys_mutex *mutex)
 {
@@ -23,22 +24,85 @@ static struct k_mutex *get_k_mutex(struct sys_mutex *mutex)
 
 static bool check_sys_mutex_addr(struct sys_mutex *addr)
 {
-	/* sys_mutex memory is never touched, just used to lookup the
-	 * underlying k_mutex, but we don't want threads using mutexes
+	/* sys_mutex memory holds the state of mutexes not held by the
+	 * underlying k_mutex, and we don't want threads using mutexes
 	 * that are outside their memory domain
 	 */
 	return K_SYSCALL_MEMORY_WRITE(addr, sizeof(struct sys_mutex));
 }
 
+/* Thread a sys_mutex value refers to, NULL if it is not a live thread.
+ * This comes from user memory, so it can't be trusted. Threads contending
+ * on a mutex need no access to each other, so only check the value names
+ * a thread which could own the mutex.
+ */
+static struct k_thread *get_owner(atomic_val_t val)
+{
+	struct k_thread *thread = (struct k_thread *)val;
+	struct k_object *obj;
+
+	obj = k_object_find((const void *)val);
+	if ((obj == NULL) || (obj->type != K_OBJ_THREAD) ||
+	    ((obj->flags & K_OBJ_FLAG_INITIALIZED) == 0U)) {
+		return NULL;
+	}
+
+	if ((thread->base.thread_state &
+	     (_THREAD_DUMMY | _THREAD_DEAD | _THREAD_ABORTING)) != 0U) {
+		return NULL;
+	}
+
+	return thread;
+}
+
 int z_impl_z_sys_mutex_kernel_lock(struct sys_mutex *mutex, k_timeout_t timeout)
 {
 	struct k_mutex *kernel_mutex = get_k_mutex(mutex);
+	atomic_val_t self = (atomic_val_t)arch_current_thread();
+	k_timepoint_t end = sys_timepoint_calc(timeout);
+	struct k_thread *owner;
+	atomic_val_t val;
+	int ret;
 
 	if (kernel_mutex == NULL) {
 		return -EINVAL;
 	}
 
-	return k_mutex_lock(kernel_mutex, timeout);
+	/* Retried whenever the value gets changed by user mode atomic
+	 * operations, or by an unlock giving the mutex back to them.
+	 */
+	for (;;) {
+		val = atomic_get(&mutex->val);
+		if (val == Z_SYS_MUTEX_UNLOCKED) {
+			if (atomic_cas(&mutex->val, val, self)) {
+				return 0;
+			}
+			continue;
+		}
+
+		/* Locked from user mode: the owner gets the k_mutex, so
+		 * that it gets its priority raised and unlocks through the
+		 * kernel.
+		 */
+		if (val != Z_SYS_MUTEX_KERNEL) {
+			owner = get_owner(val);
+			if (owner == NULL) {
+				return -EINVAL;
+			}
+
+			ret = z_mutex_lock_for(kernel_mutex, &mutex->val, owner);
+			if (ret == -EAGAIN) {
+				continue;
+			} else if (ret != 0) {
+				return ret;
+			}
+		}
+
+		ret = z_mutex_lock_user(kernel_mutex, &mutex->val, sys_timepoint_timeout(end));
+		if (ret <= 0) {
+			return ret;
+		}
+	}
 }
 
 static inline int z_vrfy_z_sys_mutex_kernel_lock(struct sys_mutex *mutex,
@@ -55,12 +119,29 @@ static inline int z_vrfy_z_sys_mutex_kernel_lock(struct sys_mutex *mutex,
 int z_impl_z_sys_mutex_kernel_unlock(struct sys_mutex *mutex)
 {
 	struct k_mutex *kernel_mutex = get_k_mutex(mutex);
+	atomic_val_t self = (atomic_val_t)arch_current_thread();
+	atomic_val_t val;
 
-	if ((kernel_mutex == NULL) || (kernel_mutex->lock_count == 0)) {
+	if (kernel_mutex == NULL) {
 		return -EINVAL;
 	}
 
-	return k_mutex_unlock(kernel_mutex);
+	do {
+		val = atomic_get(&mutex->val);
+		if (val == Z_SYS_MUTEX_UNLOCKED) {
+			return -EINVAL;
+		} else if (val == Z_SYS_MUTEX_KERNEL) {
+			return z_mutex_unlock_user(kernel_mutex, &mutex->val);
+		} else if (val != self) {
+			return -EPERM;
+		}
+
+		/* Fails if another thread just handed the mutex to the
+		 * k_mutex
+		 */
+	} while (!atomic_cas(&mutex->val, self, Z_SYS_MUTEX_UNLOCKED));
+
+	return 0;
 }
 
 static inline int z_vrfy_z_sys_mutex_kernel_unlock(struct sys_mutex *mutex)
@@ -11,7 +11,13 @@
 #define SYS_SEM_MINIMUM      0
 #define SYS_SEM_CONTENDED    (SYS_SEM_MINIMUM - 1)
 
-static inline atomic_t bounded_dec(atomic_t *val, atomic_t minimum)
+/* A thread having pended takes the last unit leaving the semaphore marked
+ * contended, as other threads may still pend on it: this way sys_sem_give()
+ * only needs to wake up one of them. Gives made before that thread runs
+ * don't wake anyone, so it wakes up the next one if units are left.
+ */
+static inline atomic_t bounded_dec(atomic_t *val, atomic_t minimum,
+				   bool contended)
 {
 	atomic_t old_value, new_value;
 
@@ -22,6 +28,9 @@ static inline atomic_t bounded_dec(atomic_t *val, atomic_t minimum)
 		}
 
 		new_value = old_value - 1;
+		if (contended && (new_value == SYS_SEM_MINIMUM)) {
+			new_value = SYS_SEM_CONTENDED;
+		}
 	} while (atomic_cas(val, old_value, new_value) == 0);
 
 	return old_value;
@@ -66,7 +75,7 @@ int sys_sem_give(struct sys_sem *sem)
 	old_value = bounded_inc(&sem->futex.val,
 				SYS_SEM_MINIMUM, sem->limit);
 	if (old_value < 0) {
-		ret = k_futex_wake(&sem->futex, true);
+		ret = k_futex_wake(&sem->futex, false);
 
 		if (ret > 0) {
 			return 0;
@@ -83,16 +92,22 @@ int sys_sem_take(struct sys_sem *sem, k_timeout_t timeout)
 {
 	int ret = 0;
 	atomic_t old_value;
+	bool contended = false;
 
 	do {
 		old_value = bounded_dec(&sem->futex.val,
-					SYS_SEM_MINIMUM);
+					SYS_SEM_MINIMUM, contended);
 		if (old_value > 0) {
+			if (contended && (old_value > 1)) {
+				(void)k_futex_wake(&sem->futex, false);
+			}
+
 			return 0;
 		}
 
 		ret = k_futex_wait(&sem->futex,
 				   SYS_SEM_CONTENDED, timeout);
+		contended = true;
 	} while (ret == 0 || ret == -EAGAIN);
 
 	return ret;
@@ -0,0 +1,97 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2024 The Zephyr Project Contributors
+#
+# SPDX-License-Identifier: Apache-2.0
+
+"""
+Init entry duration comparator
+
+Compares the init entry durations printed with CONFIG_INIT_PROFILING_EXPORT,
+or by the "kernel init_profile --csv" shell command, in two console logs and
+reports the init entries that got slower. Other console output, and init
+entries which were not measured, are ignored.
+
+Exits with status 1 when an init entry, or the sum of all init entries, got
+slower by more than both the given relative and absolute thresholds, so it
+can be used to detect boot time regressions in CI.
+
+Usage:
+    ./scripts/profiling/init_profile_compare.py <baseline log> <new log>
+"""
+
+import argparse
+import re
+import sys
+
+LINE_RE = re.compile(r"init_profile,(?P<level>\w+),(?P<name>[^,]*),"
+                     r"(?P<ns>\d*),(?P<result>-?\d+)")
+
+
+def parse(path):
+    """Return the init entry durations in ns, keyed by (level, name)."""
+    entries = {}
+
+    with open(path, encoding="utf-8", errors="replace") as f:
+        for line in f:
+            match = LINE_RE.search(line)
+            if match and match["ns"]:
+                key = (match["level"], match["name"])
+                entries[key] = int(match["ns"])
+
+    return entries
+
+
+def regressed(old_ns, new_ns, args):
+    delta = new_ns - old_ns
+
+    return (delta > args.min_us * 1000 and
+            delta * 100 > old_ns * args.threshold)
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description=__doc__,
+        formatter_class=argparse.RawDescriptionHelpFormatter,
+        allow_abbrev=False)
+    parser.add_argument("baseline", help="console log of the baseline build")
+    parser.add_argument("new", help="console log of the new build")
+    parser.add_argument("-t", "--threshold", type=float, default=10.0,
+                        help="relative slowdown to report, in percent "
+                             "(default: %(default)s)")
+    parser.add_argument("-m", "--min-us", type=float, default=100.0,
+                        help="absolute slowdown to report, in microseconds "
+                             "(default: %(default)s)")
+    args = parser.parse_args()
+
+    old = parse(args.baseline)
+    new = parse(args.new)
+
+    if not old or not new:
+        sys.exit("No init_profile lines found, was CONFIG_INIT_PROFILING_EXPORT "
+                 "enabled?")
+
+    failed = False
+
+    for key in sorted(new, key=lambda k: new[k] - old.get(k, 0), reverse=True):
+        level, name = key
+
+        if key not in old:
+            print(f"new:     {level:12} {name:32} {new[key] / 1000:10.1f} us")
+        elif regressed(old[key], new[key], args):
+            print(f"slower:  {level:12} {name:32} {old[key] / 1000:10.1f} us -> "
+                  f"{new[key] / 1000:.1f} us")
+            failed = True
+
+    old_sum = sum(old.values())
+    new_sum = sum(new.values())
+    print(f"sum:     {old_sum / 1000:.1f} us -> {new_sum / 1000:.1f} us")
+
+    if regressed(old_sum, new_sum, args):
+        failed = True
+
+    sys.exit(1 if failed else 0)
+
+
+if __name__ == "__main__":
+    main()
@@ -48,6 +48,29 @@ void k_mem_paging_backing_store_page_in(uintptr_t location)
 	}
 }
 
+void k_mem_paging_backing_store_page_in_batch(const uintptr_t *locations, size_t count)
+{
+	uint8_t *dst = K_MEM_SCRATCH_BATCH;
+	size_t run;
+
+	/* Read runs of data pages contiguous in the file at once */
+	for (size_t i = 0; i < count; i += run) {
+		long size;
+
+		run = 1;
+		while ((i + run < count) &&
+		       (locations[i + run] == locations[i] + run * CONFIG_MMU_PAGE_SIZE)) {
+			run++;
+		}
+
+		size = run * CONFIG_MMU_PAGE_SIZE;
+		if (semihost_seek(semih_fd, (long)locations[i]) != 0 ||
+		    semihost_read(semih_fd, dst + i * CONFIG_MMU_PAGE_SIZE, size) != size) {
+			k_panic();
+		}
+	}
+}
+
 void k_mem_paging_backing_store_page_finalize(struct k_mem_page_frame *pf,
 					      uintptr_t location)
 {
@@ -67,6 +67,25 @@ void k_mem_paging_backing_store_page_in(uintptr_t location)
 		     CONFIG_MMU_PAGE_SIZE);
 }
 
+void k_mem_paging_backing_store_page_in_batch(const uintptr_t *locations, size_t count)
+{
+	uint8_t *dst = K_MEM_SCRATCH_BATCH;
+	size_t run;
+
+	/* Copy runs of data pages contiguous in flash at once */
+	for (size_t i = 0; i < count; i += run) {
+		run = 1;
+		while ((i + run < count) &&
+		       (locations[i + run] == locations[i] + run * CONFIG_MMU_PAGE_SIZE)) {
+			run++;
+		}
+
+		(void)memcpy(dst + i * CONFIG_MMU_PAGE_SIZE,
+			     location_to_flash(locations[i]),
+			     run * CONFIG_MMU_PAGE_SIZE);
+	}
+}
+
 void k_mem_paging_backing_store_page_finalize(struct k_mem_page_frame *pf,
 					      uintptr_t location)
 {
@@ -124,6 +124,16 @@ void k_mem_paging_backing_store_page_in(uintptr_t location)
 		     CONFIG_MMU_PAGE_SIZE);
 }
 
+void k_mem_paging_backing_store_page_in_batch(const uintptr_t *locations, size_t count)
+{
+	uint8_t *dst = K_MEM_SCRATCH_BATCH;
+
+	for (size_t i = 0; i < count; i++) {
+		(void)memcpy(dst + i * CONFIG_MMU_PAGE_SIZE,
+			     location_to_slab(locations[i]), CONFIG_MMU_PAGE_SIZE);
+	}
+}
+
 void k_mem_paging_backing_store_page_finalize(struct k_mem_page_frame *pf,
 					      uintptr_t location)
 {
@@ -0,0 +1,444 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Compressed RAM-based backing store
+ *
+ * Like the RAM-based backing store, this keeps evicted data pages in RAM the
+ * kernel is otherwise unaware of, but compresses them into a memory pool
+ * first, similarly to zram. Data pages which do not compress well are
+ * stored as is.
+ *
+ * The codec is an LZ77 scheme close to the LZ4 block format, fast enough to
+ * run on every page-in and page-out. Compressed data is a series of
+ * sequences made of:
+ *
+ * - a token byte, holding the number of literals in its upper 4 bits and
+ *   the match length minus LZ_MIN_MATCH in its lower 4 bits. A value of 15
+ *   is followed by extension bytes added to it, until one is not 255;
+ * - the literals;
+ * - the match offset, on 2 bytes in little endian order.
+ *
+ * The last sequence only has literals.
+ *
+ * As in the RAM-based backing store, locations are freed as soon as data
+ * pages are paged in, so K_MEM_PAGE_FRAME_BACKED is never set.
+ */
+
+#include <mmu.h>
+#include <string.h>
+#include <kernel_arch_interface.h>
+#include <zephyr/kernel.h>
+#include <zephyr/kernel/mm/demand_paging.h>
+#include <zephyr/sys/byteorder.h>
+#include <zephyr/sys/sys_heap.h>
+#include <zephyr/sys/util.h>
+
+#define SLOT_COUNT	CONFIG_BACKING_STORE_RAM_PAGES
+
+/* Data pages are only kept compressed if this saves at least 1/8 of them */
+#define COMPRESSED_MAX	(CONFIG_MMU_PAGE_SIZE - CONFIG_MMU_PAGE_SIZE / 8)
+
+#if CONFIG_BACKING_STORE_RAM_COMPRESSED_POOL_SIZE != 0
+#define POOL_SIZE	CONFIG_BACKING_STORE_RAM_COMPRESSED_POOL_SIZE
+#else
+/* Expect data pages to compress to half their size, and keep room for the
+ * page reserved for page faults, another one and the pool overhead.
+ */
+#define POOL_SIZE	MAX(SLOT_COUNT * CONFIG_MMU_PAGE_SIZE / 2, 3 * CONFIG_MMU_PAGE_SIZE)
+#endif
+
+#define LZ_MIN_MATCH	4
+#define LZ_HASH_BITS	10
+
+/* Match offsets are stored on 2 bytes */
+BUILD_ASSERT(CONFIG_MMU_PAGE_SIZE <= (UINT16_MAX + 1));
+
+struct slot {
+	void *data;
+	/* Size of the stored data, CONFIG_MMU_PAGE_SIZE if not compressed */
+	size_t size;
+};
+
+static struct slot slots[SLOT_COUNT];
+static uint32_t free_slots[SLOT_COUNT];
+static size_t free_count;
+
+static char pool_mem[POOL_SIZE] __aligned(sizeof(void *));
+static struct sys_heap pool;
+static struct k_spinlock pool_lock;
+
+/* Page used when the pool is full, for page faults only, and its user */
+static char reserve_page[CONFIG_MMU_PAGE_SIZE] __aligned(sizeof(void *));
+static struct slot *reserve_slot;
+
+/* Only used by page-outs, which are serialized */
+static uint8_t compress_buf[COMPRESSED_MAX];
+static uint16_t lz_table[1 << LZ_HASH_BITS];
+
+static inline uint32_t lz_read32(const uint8_t *ptr)
+{
+	uint32_t val;
+
+	(void)memcpy(&val, ptr, sizeof(val));
+
+	return val;
+}
+
+static inline uint32_t lz_hash(uint32_t val)
+{
+	return (val * 2654435761U) >> (32 - LZ_HASH_BITS);
+}
+
+static uint8_t *lz_put_len(uint8_t *op, size_t len)
+{
+	for (; len >= 255U; len -= 255U) {
+		*op++ = 255U;
+	}
+	*op++ = (uint8_t)len;
+
+	return op;
+}
+
+static size_t lz_get_len(const uint8_t **ip, const uint8_t *end)
+{
+	size_t len = 0;
+
+	while (*ip < end) {
+		uint8_t val = *(*ip)++;
+
+		len += val;
+		if (val != 255U) {
+			break;
+		}
+	}
+
+	return len;
+}
+
+/* Worst case size of a sequence */
+static inline size_t lz_seq_size(size_t lit, size_t match)
+{
+	return 1 + (lit / 255U + 1) + lit + 2 + (match / 255U + 1);
+}
+
+/*
+ * Returns the compressed size, or 0 if it would be larger than cap.
+ */
+static size_t lz_compress(const uint8_t *src, size_t len, uint8_t *dst, size_t cap)
+{
+	const uint8_t *ip = src;
+	const uint8_t *anchor = src;
+	const uint8_t *end = src + len;
+	uint8_t *op = dst;
+	size_t lit;
+
+	(void)memset(lz_table, 0, sizeof(lz_table));
+
+	while (ip + LZ_MIN_MATCH <= end) {
+		uint32_t seq = lz_read32(ip);
+		uint32_t hash = lz_hash(seq);
+		const uint8_t *ref = src + lz_table[hash];
+		size_t match = LZ_MIN_MATCH;
+		uint8_t *token;
+
+		lz_table[hash] = ip - src;
+		if ((ref >= ip) || (lz_read32(ref) != seq)) {
+			/* Skip faster through data not compressing */
+			ip += 1 + ((ip - anchor) >> 6);
+			continue;
+		}
+
+		while ((ip + match < end) && (ref[match] == ip[match])) {
+			match++;
+		}
+
+		lit = ip - anchor;
+		if (lz_seq_size(lit, match) > cap - (op - dst)) {
+			return 0;
+		}
+
+		token = op++;
+		*token = (MIN(lit, 15U) << 4) | MIN(match - LZ_MIN_MATCH, 15U);
+		if (lit >= 15U) {
+			op = lz_put_len(op, lit - 15U);
+		}
+		(void)memcpy(op, anchor, lit);
+		op += lit;
+		sys_put_le16(ip - ref, op);
+		op += 2;
+		if (match - LZ_MIN_MATCH >= 15U) {
+			op = lz_put_len(op, match - LZ_MIN_MATCH - 15U);
+		}
+
+		ip += match;
+		anchor = ip;
+	}
+
+	lit = end - anchor;
+	if (lz_seq_size(lit, 0) > cap - (op - dst)) {
+		return 0;
+	}
+
+	*op++ = MIN(lit, 15U) << 4;
+	if (lit >= 15U) {
+		op = lz_put_len(op, lit - 15U);
+	}
+	(void)memcpy(op, anchor, lit);
+	op += lit;
+
+	return op - dst;
+}
+
+static int lz_decompress(const uint8_t *src, size_t len, uint8_t *dst, size_t size)
+{
+	const uint8_t *ip = src;
+	const uint8_t *end = src + len;
+	uint8_t *op = dst;
+	uint8_t *op_end = dst + size;
+
+	while (ip < end) {
+		uint8_t token = *ip++;
+		size_t lit = token >> 4;
+		size_t match = (token & 0xFU) + LZ_MIN_MATCH;
+		size_t offset;
+		const uint8_t *ref;
+
+		if (lit == 15U) {
+			lit += lz_get_len(&ip, end);
+		}
+		if ((lit > (size_t)(end - ip)) || (lit > (size_t)(op_end - op))) {
+			return -EINVAL;
+		}
+		(void)memcpy(op, ip, lit);
+		op += lit;
+		ip += lit;
+
+		if (ip == end) {
+			break;
+		}
+
+		if (end - ip < 2) {
+			return -EINVAL;
+		}
+		offset = sys_get_le16(ip);
+		ip += 2;
+		if (match == 15U + LZ_MIN_MATCH) {
+			match += lz_get_len(&ip, end);
+		}
+		if ((offset == 0U) || (offset > (size_t)(op - dst)) ||
+		    (match > (size_t)(op_end - op))) {
+			return -EINVAL;
+		}
+
+		/* Byte by byte, as the match may overlap the output */
+		for (ref = op - offset; match > 0U; match--) {
+			*op++ = *ref++;
+		}
+	}
+
+	return (op == op_end) ? 0 : -EINVAL;
+}
+
+static inline uint32_t stats_cycles(void)
+{
+	return IS_ENABLED(CONFIG_DEMAND_PAGING_STATS) ? k_cycle_get_32() : 0U;
+}
+
+static struct slot *location_to_slot(uintptr_t location)
+{
+	__ASSERT(location % CONFIG_MMU_PAGE_SIZE == 0,
+		 "unaligned location 0x%lx", location);
+	__ASSERT(location / CONFIG_MMU_PAGE_SIZE < SLOT_COUNT,
+		 "bad location 0x%lx, past bounds of backing store", location);
+
+	return &slots[location / CONFIG_MMU_PAGE_SIZE];
+}
+
+/* Whether a data page which does not compress could still be stored */
+static bool pool_page_available(void)
+{
+	void *data = sys_heap_alloc(&pool, CONFIG_MMU_PAGE_SIZE);
+
+	if (data == NULL) {
+		return false;
+	}
+	sys_heap_free(&pool, data);
+
+	return true;
+}
+
+/*
+ * Move the data page stored in the reserve page to the pool if there is
+ * room, so that the reserve page is available for the next page fault.
+ * Called with pool_lock held.
+ */
+static void reserve_release(size_t size, bool copy)
+{
+	void *data = sys_heap_alloc(&pool, size);
+
+	if (data == NULL) {
+		return;
+	}
+	if (copy) {
+		(void)memcpy(data, reserve_page, size);
+	}
+	reserve_slot->data = data;
+	reserve_slot = NULL;
+}
+
+int k_mem_paging_backing_store_location_get(struct k_mem_page_frame *pf,
+					    uintptr_t *location,
+					    bool page_fault)
+{
+	k_spinlock_key_t key = k_spin_lock(&pool_lock);
+	uint32_t idx;
+	void *data;
+	int ret = 0;
+
+	/* A slot is kept for page faults */
+	if ((!page_fault && free_count == 1) || free_count == 0) {
+		ret = -ENOMEM;
+		goto out;
+	}
+
+	/* Room for the data page in case it does not compress, shrunk
+	 * when paged out otherwise. Like the slot, room for another data
+	 * page is kept for page faults.
+	 */
+	data = sys_heap_alloc(&pool, CONFIG_MMU_PAGE_SIZE);
+	if ((data != NULL) && !page_fault && !pool_page_available()) {
+		sys_heap_free(&pool, data);
+		data = NULL;
+	}
+	if (data == NULL) {
+		if (!page_fault || (reserve_slot != NULL)) {
+			ret = -ENOMEM;
+			goto out;
+		}
+		data = reserve_page;
+	}
+
+	idx = free_slots[--free_count];
+	if (data == reserve_page) {
+		reserve_slot = &slots[idx];
+	}
+	slots[idx].data = data;
+	slots[idx].size = CONFIG_MMU_PAGE_SIZE;
+	*location = idx * CONFIG_MMU_PAGE_SIZE;
+
+out:
+	k_spin_unlock(&pool_lock, key);
+
+	return ret;
+}
+
+void k_mem_paging_backing_store_location_free(uintptr_t location)
+{
+	k_spinlock_key_t key = k_spin_lock(&pool_lock);
+	struct slot *slot = location_to_slot(location);
+
+	if (slot == reserve_slot) {
+		reserve_slot = NULL;
+	} else {
+		sys_heap_free(&pool, slot->data);
+		if (reserve_slot != NULL) {
+			reserve_release(reserve_slot->size, true);
+		}
+	}
+	slot->data = NULL;
+	free_slots[free_count++] = slot - slots;
+
+	k_spin_unlock(&pool_lock, key);
+}
+
+void k_mem_paging_backing_store_page_out(uintptr_t location)
+{
+	struct slot *slot = location_to_slot(location);
+	uint32_t start = stats_cycles();
+	const void *src = compress_buf;
+	k_spinlock_key_t key;
+	size_t size;
+
+	size = lz_compress(K_MEM_SCRATCH_PAGE, CONFIG_MMU_PAGE_SIZE, compress_buf,
+			   sizeof(compress_buf));
+	if (size == 0U) {
+		src = K_MEM_SCRATCH_PAGE;
+		size = CONFIG_MMU_PAGE_SIZE;
+	}
+
+	key = k_spin_lock(&pool_lock);
+	if (slot == reserve_slot) {
+		/* Free the reserve page for the next page fault, whether the
+		 * data page compressed or not.
+		 */
+		reserve_release(size, false);
+	} else if (size < CONFIG_MMU_PAGE_SIZE) {
+		/* Shrinking, so this stays in place */
+		void *data = sys_heap_realloc(&pool, slot->data, size);
+
+		if (data != NULL) {
+			slot->data = data;
+		}
+	}
+	k_spin_unlock(&pool_lock, key);
+
+	(void)memcpy(slot->data, src, size);
+	slot->size = size;
+	k_mem_paging_backing_store_stats_compress(size, stats_cycles() - start);
+}
+
+static void slot_read(uintptr_t location, void *dst)
+{
+	struct slot *slot = location_to_slot(location);
+	uint32_t start;
+
+	if (slot->size == CONFIG_MMU_PAGE_SIZE) {
+		(void)memcpy(dst, slot->data, CONFIG_MMU_PAGE_SIZE);
+		return;
+	}
+
+	start = stats_cycles();
+	if (lz_decompress(slot->data, slot->size, dst, CONFIG_MMU_PAGE_SIZE) != 0) {
+		__ASSERT(false, "corrupted data page at location 0x%lx", location);
+		k_panic();
+	}
+	k_mem_paging_backing_store_stats_decompress(stats_cycles() - start);
+}
+
+void k_mem_paging_backing_store_page_in(uintptr_t location)
+{
+	slot_read(location, K_MEM_SCRATCH_PAGE);
+}
+
+void k_mem_paging_backing_store_page_in_batch(const uintptr_t *locations, size_t count)
+{
+	uint8_t *dst = K_MEM_SCRATCH_BATCH;
+
+	for (size_t i = 0; i < count; i++) {
+		slot_read(locations[i], dst + i * CONFIG_MMU_PAGE_SIZE);
+	}
+}
+
+void k_mem_paging_backing_store_page_finalize(struct k_mem_page_frame *pf,
+					      uintptr_t location)
+{
+#ifdef CONFIG_DEMAND_MAPPING
+	/* ignore those */
+	if (location == ARCH_UNPAGED_ANON_ZERO || location == ARCH_UNPAGED_ANON_UNINIT) {
+		return;
+	}
+#endif
+	k_mem_paging_backing_store_location_free(location);
+}
+
+void k_mem_paging_backing_store_init(void)
+{
+	sys_heap_init(&pool, pool_mem, sizeof(pool_mem));
+
+	for (uint32_t i = 0; i < SLOT_COUNT; i++) {
+		free_slots[i] = SLOT_COUNT - 1 - i;
+	}
+	free_count = SLOT_COUNT;
+}
@@ -0,0 +1,290 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Adaptive Replacement Cache (ARC) eviction algorithm for demand paging.
+ *
+ * Page accesses are only known through the accessed flag of the MMU, so
+ * this implements CAR (Clock with Adaptive Replacement), the variant of ARC
+ * using reference bits instead of moving pages on every access.
+ *
+ * Theory of Operation:
+ *
+ * - Resident pages are kept in two queues: T1 holds pages accessed once
+ *   since being paged in, and T2 pages accessed more than once. Pages are
+ *   appended to T1 when paged in.
+ *
+ * - On eviction, the head of T1 is considered if T1 holds at least its
+ *   target number of pages, else the head of T2. A head page accessed since
+ *   it was last considered moves to the end of T2, otherwise it is evicted.
+ *   A scan touching many pages once only replaces pages of T1.
+ *
+ * - Evicted pages are remembered in two histories: B1 for pages evicted
+ *   from T1 and B2 for those evicted from T2. A page paged in again while in
+ *   B1 shows that T1 is too small and grows its target, and one in B2 shows
+ *   that T2 is too small and shrinks it. Such pages are appended to T2.
+ *
+ * - T1 and B1 together hold at most as many pages as there are resident
+ *   pages, and the four queues at most twice as many.
+ *
+ * Page-ins are not reported to the eviction algorithm without
+ * CONFIG_EVICTION_TRACKING, so the content of every page frame is compared
+ * to what was seen there before whenever a page has to be selected for
+ * eviction. Like the NRU algorithm, this is O(n) in the number of page
+ * frames.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/kernel/mm/demand_paging.h>
+#include <zephyr/sys/util.h>
+#include <mmu.h>
+#include <kernel_arch_interface.h>
+
+/*
+ * Queue entries [0, K_MEM_NUM_PAGE_FRAMES) are page frames, with matching
+ * indexes, the next K_MEM_NUM_PAGE_FRAMES ones hold evicted pages, and the
+ * last ones are the queue heads. Every entry is in exactly one queue, and
+ * unused history entries are in the ARC_FREE queue.
+ */
+enum arc_queue {
+	ARC_NONE,
+	ARC_T1,
+	ARC_T2,
+	ARC_B1,
+	ARC_B2,
+	ARC_FREE,
+	ARC_NUM_QUEUES,
+};
+
+#define ARC_NUM_PF	K_MEM_NUM_PAGE_FRAMES
+#define ARC_NUM_ENTRIES	(2 * ARC_NUM_PF)
+#define ARC_HEAD(q)	(ARC_NUM_ENTRIES + (q))
+
+struct arc_link {
+	uint32_t next;
+	uint32_t prev;
+};
+
+static struct arc_link arc_links[ARC_NUM_ENTRIES + ARC_NUM_QUEUES];
+/* Virtual address of the page in each entry */
+static uintptr_t arc_virt[ARC_NUM_ENTRIES];
+static uint8_t arc_queue_of[ARC_NUM_ENTRIES];
+static size_t arc_size[ARC_NUM_QUEUES];
+
+/* Target size of T1 */
+static size_t arc_p;
+
+static void arc_append(uint32_t idx, enum arc_queue q)
+{
+	uint32_t head = ARC_HEAD(q);
+	uint32_t tail = arc_links[head].prev;
+
+	arc_links[idx].next = head;
+	arc_links[idx].prev = tail;
+	arc_links[tail].next = idx;
+	arc_links[head].prev = idx;
+	arc_queue_of[idx] = q;
+	arc_size[q]++;
+}
+
+static void arc_unlink(uint32_t idx)
+{
+	uint32_t next = arc_links[idx].next;
+	uint32_t prev = arc_links[idx].prev;
+
+	arc_links[prev].next = next;
+	arc_links[next].prev = prev;
+	arc_size[arc_queue_of[idx]]--;
+	arc_queue_of[idx] = ARC_NONE;
+}
+
+static inline uint32_t arc_first(enum arc_queue q)
+{
+	return arc_links[ARC_HEAD(q)].next;
+}
+
+static void arc_move(uint32_t idx, enum arc_queue q)
+{
+	arc_unlink(idx);
+	arc_append(idx, q);
+}
+
+static uint32_t arc_history_find(uintptr_t virt)
+{
+	for (uint32_t idx = ARC_NUM_PF; idx < ARC_NUM_ENTRIES; idx++) {
+		if (((arc_queue_of[idx] == ARC_B1) || (arc_queue_of[idx] == ARC_B2)) &&
+		    (arc_virt[idx] == virt)) {
+			return idx;
+		}
+	}
+
+	return ARC_NUM_ENTRIES;
+}
+
+static void arc_history_drop_oldest(enum arc_queue q)
+{
+	if (arc_size[q] > 0U) {
+		arc_move(arc_first(q), ARC_FREE);
+	}
+}
+
+static void arc_history_add(uintptr_t virt, enum arc_queue q)
+{
+	uint32_t idx;
+
+	if (arc_size[ARC_FREE] == 0U) {
+		arc_history_drop_oldest((arc_size[ARC_B1] > 0U) ? ARC_B1 : ARC_B2);
+	}
+
+	idx = arc_first(ARC_FREE);
+	arc_virt[idx] = virt;
+	arc_move(idx, q);
+}
+
+static void arc_page_in(uint32_t idx, uintptr_t virt, size_t resident)
+{
+	uint32_t hist = arc_history_find(virt);
+	size_t b1 = arc_size[ARC_B1];
+	size_t b2 = arc_size[ARC_B2];
+
+	arc_virt[idx] = virt;
+
+	if (hist == ARC_NUM_ENTRIES) {
+		/* Keep the history within bounds */
+		if (arc_size[ARC_T1] + b1 >= resident) {
+			arc_history_drop_oldest(ARC_B1);
+		} else if (arc_size[ARC_T1] + arc_size[ARC_T2] + b1 + b2 >= 2 * resident) {
+			arc_history_drop_oldest(ARC_B2);
+		}
+		arc_append(idx, ARC_T1);
+		k_mem_paging_eviction_stats_inc(K_MEM_PAGING_EVICTION_MISS);
+	} else {
+		if (arc_queue_of[hist] == ARC_B1) {
+			arc_p = MIN(arc_p + MAX(1, b2 / b1), resident);
+		} else {
+			arc_p -= MIN(arc_p, MAX(1, b1 / b2));
+		}
+		arc_move(hist, ARC_FREE);
+		arc_append(idx, ARC_T2);
+		k_mem_paging_eviction_stats_inc(K_MEM_PAGING_EVICTION_THRASH);
+	}
+
+	/* The access that paged it in does not count */
+	(void)arch_page_info_get((void *)virt, NULL, true);
+}
+
+/* Account for pages paged in, evicted or pinned since the last call */
+static void arc_update(void)
+{
+	size_t resident = 0;
+
+	for (uint32_t idx = 0; idx < ARC_NUM_PF; idx++) {
+		struct k_mem_page_frame *pf = &k_mem_page_frames[idx];
+
+		if (!k_mem_page_frame_is_evictable(pf)) {
+			if (arc_queue_of[idx] != ARC_NONE) {
+				arc_unlink(idx);
+			}
+			continue;
+		}
+
+		if ((arc_queue_of[idx] != ARC_NONE) &&
+		    (arc_virt[idx] != (uintptr_t)k_mem_page_frame_to_virt(pf))) {
+			arc_unlink(idx);
+		}
+		resident++;
+	}
+
+	for (uint32_t idx = 0; idx < ARC_NUM_PF; idx++) {
+		struct k_mem_page_frame *pf = &k_mem_page_frames[idx];
+
+		if ((arc_queue_of[idx] == ARC_NONE) && k_mem_page_frame_is_evictable(pf)) {
+			arc_page_in(idx, (uintptr_t)k_mem_page_frame_to_virt(pf), resident);
+		}
+	}
+
+	arc_p = MIN(arc_p, resident);
+}
+
+struct k_mem_page_frame *k_mem_paging_eviction_select(bool *dirty_ptr)
+{
+	enum arc_queue q;
+	uintptr_t flags;
+	uint32_t idx;
+
+	arc_update();
+	if (arc_size[ARC_T1] + arc_size[ARC_T2] == 0U) {
+		/* Shouldn't ever happen unless every page is pinned */
+		__ASSERT(false, "no page to evict");
+		return NULL;
+	}
+
+	/* Accessed flags are cleared as pages move to T2, so this ends
+	 * within one round of each queue.
+	 */
+	for (;;) {
+		if ((arc_size[ARC_T1] > 0U) &&
+		    ((arc_size[ARC_T1] >= MAX(1, arc_p)) || (arc_size[ARC_T2] == 0U))) {
+			q = ARC_T1;
+		} else {
+			q = ARC_T2;
+		}
+
+		idx = arc_first(q);
+		flags = arch_page_info_get((void *)arc_virt[idx], NULL, true);
+
+		/* Implies a mismatch with page frame ontology and page tables */
+		__ASSERT((flags & ARCH_DATA_PAGE_LOADED) != 0U, "non-present page %p",
+			 (void *)arc_virt[idx]);
+
+		if ((flags & ARCH_DATA_PAGE_ACCESSED) == 0U) {
+			break;
+		}
+
+		k_mem_paging_eviction_stats_inc(K_MEM_PAGING_EVICTION_HIT);
+		arc_move(idx, ARC_T2);
+	}
+
+	arc_unlink(idx);
+	arc_history_add(arc_virt[idx], (q == ARC_T1) ? ARC_B1 : ARC_B2);
+
+	*dirty_ptr = (flags & ARCH_DATA_PAGE_DIRTY) != 0U;
+
+	return &k_mem_page_frames[idx];
+}
+
+void k_mem_paging_eviction_init(void)
+{
+	for (uint32_t q = 0; q < ARC_NUM_QUEUES; q++) {
+		arc_links[ARC_HEAD(q)].next = ARC_HEAD(q);
+		arc_links[ARC_HEAD(q)].prev = ARC_HEAD(q);
+	}
+
+	for (uint32_t idx = ARC_NUM_PF; idx < ARC_NUM_ENTRIES; idx++) {
+		arc_append(idx, ARC_FREE);
+	}
+}
+
+#ifdef CONFIG_EVICTION_TRACKING
+/*
+ * Empty functions defined here so that architectures unconditionally
+ * implement eviction tracking can still use this algorithm.
+ */
+
+void k_mem_paging_eviction_add(struct k_mem_page_frame *pf)
+{
+	ARG_UNUSED(pf);
+}
+
+void k_mem_paging_eviction_remove(struct k_mem_page_frame *pf)
+{
+	ARG_UNUSED(pf);
+}
+
+void k_mem_paging_eviction_accessed(uintptr_t phys)
+{
+	ARG_UNUSED(phys);
+}
+
+#endif /* CONFIG_EVICTION_TRACKING */
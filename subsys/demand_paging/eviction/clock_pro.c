@@ -0,0 +1,299 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * CLOCK-Pro eviction algorithm for demand paging.
+ *
+ * Theory of Operation:
+ *
+ * - Resident pages are either hot or cold. Pages are cold when paged in,
+ *   and get a test period during which being accessed again makes them hot.
+ *   Only cold pages are evicted, so a scan touching many pages once only
+ *   replaces cold pages and leaves the hot working set resident.
+ *
+ * - Page frames are visited in a circular order by two clock hands, using
+ *   the accessed flag of the MMU as reference bit:
+ *
+ *   - The cold hand looks for a victim among cold pages. An accessed cold
+ *     page in its test period becomes hot, and any other accessed cold page
+ *     starts a new test period. The first cold page not accessed is evicted.
+ *
+ *   - The hot hand turns hot pages not accessed since its last pass cold
+ *     whenever there are more hot pages than allowed, and ends the test
+ *     period of the cold pages it passes.
+ *
+ * - A cold page evicted during its test period is remembered in a history
+ *   of non-resident pages. Being paged in again while still in the history
+ *   makes it hot directly, and grows the share of cold pages, as it shows
+ *   that cold pages do not stay resident long enough. Each page falling out
+ *   of the history shrinks it again.
+ *
+ * Page-ins are not reported to the eviction algorithm without
+ * CONFIG_EVICTION_TRACKING, so the content of every page frame is compared
+ * to what was seen there before whenever a page has to be selected for
+ * eviction. Like the NRU algorithm, this is O(n) in the number of page
+ * frames.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/kernel/mm/demand_paging.h>
+#include <zephyr/sys/util.h>
+#include <mmu.h>
+#include <kernel_arch_interface.h>
+
+/* Page frame state flags */
+#define CP_RESIDENT	BIT(0)
+#define CP_HOT		BIT(1)
+#define CP_TEST		BIT(2)
+
+/* Marks an unused history entry, never a page aligned address */
+#define CP_NO_PAGE	UINTPTR_MAX
+
+struct clock_pro_pf {
+	/* Virtual address of the page last seen in the page frame */
+	uintptr_t virt;
+	uint8_t flags;
+};
+
+static struct clock_pro_pf cp_pf[K_MEM_NUM_PAGE_FRAMES];
+
+/* Non-resident cold pages in their test period, oldest first */
+static uintptr_t cp_history[K_MEM_NUM_PAGE_FRAMES];
+static size_t cp_history_head;
+static size_t cp_history_count;
+
+static size_t cp_hand_cold;
+static size_t cp_hand_hot;
+static size_t cp_resident;
+static size_t cp_hot;
+/* Target number of resident cold pages */
+static size_t cp_cold_target = 1;
+
+static inline void *cp_virt(size_t idx)
+{
+	return (void *)cp_pf[idx].virt;
+}
+
+static inline size_t cp_next(size_t idx)
+{
+	return (idx + 1) % ARRAY_SIZE(cp_pf);
+}
+
+static void cp_cold_target_set(size_t target)
+{
+	cp_cold_target = CLAMP(target, 1, MAX(cp_resident, 1));
+}
+
+static void cp_history_push(uintptr_t virt)
+{
+	size_t tail = (cp_history_head + cp_history_count) % ARRAY_SIZE(cp_history);
+
+	if (cp_history_count == ARRAY_SIZE(cp_history)) {
+		/* The oldest page falls out of the history: its test period
+		 * ended without it being accessed again.
+		 */
+		if (cp_history[cp_history_head] != CP_NO_PAGE) {
+			cp_cold_target_set(cp_cold_target - 1);
+		}
+		cp_history_head = (cp_history_head + 1) % ARRAY_SIZE(cp_history);
+		cp_history_count--;
+	}
+
+	cp_history[tail] = virt;
+	cp_history_count++;
+}
+
+static bool cp_history_take(uintptr_t virt)
+{
+	for (size_t i = 0; i < cp_history_count; i++) {
+		size_t idx = (cp_history_head + i) % ARRAY_SIZE(cp_history);
+
+		if (cp_history[idx] == virt) {
+			cp_history[idx] = CP_NO_PAGE;
+			return true;
+		}
+	}
+
+	return false;
+}
+
+static void cp_forget(size_t idx)
+{
+	if ((cp_pf[idx].flags & CP_HOT) != 0U) {
+		cp_hot--;
+	}
+	cp_pf[idx].flags = 0U;
+	cp_resident--;
+}
+
+static void cp_page_in(size_t idx, uintptr_t virt)
+{
+	cp_pf[idx].virt = virt;
+	cp_resident++;
+
+	if (cp_history_take(virt)) {
+		/* Accessed again within its test period */
+		cp_pf[idx].flags = CP_RESIDENT | CP_HOT;
+		cp_hot++;
+		cp_cold_target_set(cp_cold_target + 1);
+		k_mem_paging_eviction_stats_inc(K_MEM_PAGING_EVICTION_THRASH);
+	} else {
+		cp_pf[idx].flags = CP_RESIDENT | CP_TEST;
+		k_mem_paging_eviction_stats_inc(K_MEM_PAGING_EVICTION_MISS);
+	}
+
+	/* The access that paged it in does not count */
+	(void)arch_page_info_get(cp_virt(idx), NULL, true);
+}
+
+/* Account for pages paged in, evicted or pinned since the last call */
+static void cp_update(void)
+{
+	for (size_t idx = 0; idx < ARRAY_SIZE(cp_pf); idx++) {
+		struct k_mem_page_frame *pf = &k_mem_page_frames[idx];
+		bool resident = (cp_pf[idx].flags & CP_RESIDENT) != 0U;
+		uintptr_t virt;
+
+		if (!k_mem_page_frame_is_evictable(pf)) {
+			if (resident) {
+				cp_forget(idx);
+			}
+			continue;
+		}
+
+		virt = (uintptr_t)k_mem_page_frame_to_virt(pf);
+		if (resident && (cp_pf[idx].virt == virt)) {
+			continue;
+		}
+
+		if (resident) {
+			cp_forget(idx);
+		}
+		cp_page_in(idx, virt);
+	}
+
+	cp_cold_target_set(cp_cold_target);
+}
+
+static uintptr_t cp_page_flags(size_t idx)
+{
+	uintptr_t flags = arch_page_info_get(cp_virt(idx), NULL, true);
+
+	/* Implies a mismatch with page frame ontology and page tables */
+	__ASSERT((flags & ARCH_DATA_PAGE_LOADED) != 0U, "non-present page %p",
+		 cp_virt(idx));
+
+	return flags;
+}
+
+/* Turn the next hot page not accessed recently cold */
+static void cp_run_hand_hot(void)
+{
+	/* Two rounds at most: the first one clears all accessed flags */
+	for (size_t n = 0; n < 2 * ARRAY_SIZE(cp_pf); n++) {
+		size_t idx = cp_hand_hot;
+
+		cp_hand_hot = cp_next(idx);
+
+		if ((cp_pf[idx].flags & CP_RESIDENT) == 0U) {
+			continue;
+		}
+
+		if ((cp_pf[idx].flags & CP_HOT) == 0U) {
+			cp_pf[idx].flags &= ~CP_TEST;
+			continue;
+		}
+
+		if ((cp_page_flags(idx) & ARCH_DATA_PAGE_ACCESSED) != 0U) {
+			k_mem_paging_eviction_stats_inc(K_MEM_PAGING_EVICTION_HIT);
+			continue;
+		}
+
+		cp_pf[idx].flags &= ~CP_HOT;
+		cp_hot--;
+		break;
+	}
+}
+
+static void cp_balance(void)
+{
+	while ((cp_hot > 0U) && (cp_hot > cp_resident - cp_cold_target)) {
+		cp_run_hand_hot();
+	}
+}
+
+struct k_mem_page_frame *k_mem_paging_eviction_select(bool *dirty_ptr)
+{
+	uintptr_t flags;
+	size_t idx;
+
+	cp_update();
+	if (cp_resident == 0U) {
+		/* Shouldn't ever happen unless every page is pinned */
+		__ASSERT(false, "no page to evict");
+		return NULL;
+	}
+
+	cp_balance();
+
+	for (;;) {
+		idx = cp_hand_cold;
+		cp_hand_cold = cp_next(idx);
+
+		if ((cp_pf[idx].flags & (CP_RESIDENT | CP_HOT)) != CP_RESIDENT) {
+			continue;
+		}
+
+		flags = cp_page_flags(idx);
+		if ((flags & ARCH_DATA_PAGE_ACCESSED) == 0U) {
+			break;
+		}
+
+		k_mem_paging_eviction_stats_inc(K_MEM_PAGING_EVICTION_HIT);
+		if ((cp_pf[idx].flags & CP_TEST) != 0U) {
+			cp_pf[idx].flags = CP_RESIDENT | CP_HOT;
+			cp_hot++;
+			/* Makes sure a cold page is left to evict */
+			cp_balance();
+		} else {
+			cp_pf[idx].flags |= CP_TEST;
+		}
+	}
+
+	if ((cp_pf[idx].flags & CP_TEST) != 0U) {
+		cp_history_push(cp_pf[idx].virt);
+	}
+	cp_forget(idx);
+
+	*dirty_ptr = (flags & ARCH_DATA_PAGE_DIRTY) != 0U;
+
+	return &k_mem_page_frames[idx];
+}
+
+void k_mem_paging_eviction_init(void)
+{
+}
+
+#ifdef CONFIG_EVICTION_TRACKING
+/*
+ * Empty functions defined here so that architectures unconditionally
+ * implement eviction tracking can still use this algorithm.
+ */
+
+void k_mem_paging_eviction_add(struct k_mem_page_frame *pf)
+{
+	ARG_UNUSED(pf);
+}
+
+void k_mem_paging_eviction_remove(struct k_mem_page_frame *pf)
+{
+	ARG_UNUSED(pf);
+}
+
+void k_mem_paging_eviction_accessed(uintptr_t phys)
+{
+	ARG_UNUSED(phys);
+}
+
+#endif /* CONFIG_EVICTION_TRACKING */
@@ -59,11 +59,29 @@ LOG_MODULE_REGISTER(net_conn, CONFIG_NET_CONN_LOG_LEVEL);
 
 #define NET_CONN_RANK(_flags)		(_flags & 0x78)
 
+/** Best rank, with all of the addresses and ports specified */
+#define NET_CONN_RANK_MAX		NET_CONN_RANK(0xff)
+
 static struct net_conn conns[CONFIG_NET_MAX_CONN];
 
 static sys_slist_t conn_unused;
 static sys_slist_t conn_used;
 
+/* TCP and UDP connections are also indexed, so that received packets are
+ * only matched against the connections they could be for:
+ * - conn_hash_remote: connections with the local port, remote port and
+ *   remote address specified, hashed on all of them,
+ * - conn_hash_port: other connections with the local port specified,
+ *   hashed on it,
+ * - conn_wildcard: connections without local port.
+ * Each list is sorted from the most recently registered connection, which
+ * is also the order of conn_used.
+ */
+static sys_slist_t conn_hash_remote[CONFIG_NET_CONN_HASH_BUCKETS];
+static sys_slist_t conn_hash_port[CONFIG_NET_CONN_HASH_BUCKETS];
+static sys_slist_t conn_wildcard;
+static uint32_t conn_seq;
+
 #if (CONFIG_NET_CONN_LOG_LEVEL >= LOG_LEVEL_DBG)
 static inline
 void conn_register_debug(struct net_conn *conn,
@@ -116,6 +134,129 @@ void conn_register_debug(struct net_conn *conn,
 
 static K_MUTEX_DEFINE(conn_lock);
 
+#define CONN_HASH_INIT	2166136261U
+
+/* FNV-1a */
+static uint32_t conn_hash(uint32_t hash, const void *data, size_t len)
+{
+	const uint8_t *ptr = data;
+
+	while (len-- > 0) {
+		hash = (hash ^ *ptr++) * 16777619U;
+	}
+
+	return hash;
+}
+
+static uint32_t conn_hash_port_key(uint16_t proto, uint16_t local_port)
+{
+	uint32_t hash = conn_hash(CONN_HASH_INIT, &proto, sizeof(proto));
+
+	return conn_hash(hash, &local_port, sizeof(local_port));
+}
+
+static uint32_t conn_hash_remote_key(uint32_t hash, uint16_t remote_port,
+				     const uint8_t *addr, size_t addr_len)
+{
+	hash = conn_hash(hash, &remote_port, sizeof(remote_port));
+
+	return conn_hash(hash, addr, addr_len);
+}
+
+static inline bool conn_is_indexed(struct net_conn *conn)
+{
+	return conn->family == AF_INET || conn->family == AF_INET6 ||
+		conn->family == AF_UNSPEC;
+}
+
+/* Return the specified remote address of the connection, if any */
+static const uint8_t *conn_remote_addr(struct net_conn *conn, size_t *len)
+{
+	if (!(conn->flags & NET_CONN_REMOTE_ADDR_SET)) {
+		return NULL;
+	}
+
+	if (IS_ENABLED(CONFIG_NET_IPV6) &&
+	    conn->remote_addr.sa_family == AF_INET6) {
+		if (net_ipv6_is_addr_unspecified(&net_sin6(&conn->remote_addr)->sin6_addr)) {
+			return NULL;
+		}
+
+		*len = sizeof(struct in6_addr);
+		return (const uint8_t *)&net_sin6(&conn->remote_addr)->sin6_addr;
+	} else if (IS_ENABLED(CONFIG_NET_IPV4) &&
+		   conn->remote_addr.sa_family == AF_INET) {
+		if (net_sin(&conn->remote_addr)->sin_addr.s_addr == 0U) {
+			return NULL;
+		}
+
+		*len = sizeof(struct in_addr);
+		return (const uint8_t *)&net_sin(&conn->remote_addr)->sin_addr;
+	}
+
+	return NULL;
+}
+
+/* Return the index list of the connection, given its current addresses
+ * and ports. Must be called with conn_lock held.
+ */
+static sys_slist_t *conn_hash_list(struct net_conn *conn)
+{
+	uint16_t local_port = net_sin(&conn->local_addr)->sin_port;
+	uint16_t remote_port = net_sin(&conn->remote_addr)->sin_port;
+	const uint8_t *addr;
+	size_t addr_len;
+	uint32_t hash;
+
+	if (local_port == 0U) {
+		return &conn_wildcard;
+	}
+
+	hash = conn_hash_port_key(conn->proto, local_port);
+
+	addr = conn_remote_addr(conn, &addr_len);
+	if (remote_port != 0U && addr != NULL) {
+		hash = conn_hash_remote_key(hash, remote_port, addr, addr_len);
+
+		return &conn_hash_remote[hash % CONFIG_NET_CONN_HASH_BUCKETS];
+	}
+
+	return &conn_hash_port[hash % CONFIG_NET_CONN_HASH_BUCKETS];
+}
+
+static void conn_hash_add(struct net_conn *conn)
+{
+	sys_slist_t *list;
+	struct net_conn *prev = NULL;
+	struct net_conn *tmp;
+
+	if (!conn_is_indexed(conn)) {
+		return;
+	}
+
+	list = conn_hash_list(conn);
+
+	SYS_SLIST_FOR_EACH_CONTAINER(list, tmp, hash_node) {
+		if ((int32_t)(tmp->seq - conn->seq) < 0) {
+			break;
+		}
+
+		prev = tmp;
+	}
+
+	sys_slist_insert(list, prev != NULL ? &prev->hash_node : NULL,
+			 &conn->hash_node);
+}
+
+static void conn_hash_remove(struct net_conn *conn)
+{
+	if (!conn_is_indexed(conn)) {
+		return;
+	}
+
+	sys_slist_find_and_remove(conn_hash_list(conn), &conn->hash_node);
+}
+
 static struct net_conn *conn_get_unused(void)
 {
 	sys_snode_t *node;
@@ -140,7 +281,9 @@ static void conn_set_used(struct net_conn *conn)
 	conn->flags |= NET_CONN_IN_USE;
 
 	k_mutex_lock(&conn_lock, K_FOREVER);
+	conn->seq = conn_seq++;
 	sys_slist_prepend(&conn_used, &conn->node);
+	conn_hash_add(conn);
 	k_mutex_unlock(&conn_lock);
 }
 
@@ -452,6 +595,7 @@ int net_conn_unregister(struct net_conn_handle *handle)
 
 	k_mutex_lock(&conn_lock, K_FOREVER);
 	sys_slist_find_and_remove(&conn_used, &conn->node);
+	conn_hash_remove(conn);
 	k_mutex_unlock(&conn_lock);
 
 	conn_set_unused(conn);
@@ -476,9 +620,16 @@ int net_conn_update(struct net_conn_handle *handle,
 		return -ENOENT;
 	}
 
+	k_mutex_lock(&conn_lock, K_FOREVER);
+
 	net_conn_change_callback(conn, cb, user_data);
 
+	/* The new remote address and port may move it in the index */
+	conn_hash_remove(conn);
 	ret = net_conn_change_remote(conn, remote_addr, remote_port);
+	conn_hash_add(conn);
+
+	k_mutex_unlock(&conn_lock);
 
 	return ret;
 }
@@ -634,6 +785,256 @@ static enum net_verdict conn_raw_socket(struct net_pkt *pkt,
 	return NET_OK;
 }
 
+/* State of the lookup of the connections matching a received packet */
+struct conn_input {
+	struct net_pkt *pkt;
+	union net_ip_header *ip_hdr;
+	union net_proto_header *proto_hdr;
+	struct net_conn *best_match;
+	int16_t best_rank;
+	uint16_t src_port;
+	uint16_t dst_port;
+	uint8_t proto;
+	bool is_mcast_pkt;
+	bool mcast_pkt_delivered;
+	bool raw_pkt_delivered;
+	bool raw_pkt_continue;
+};
+
+/* Iterator over the indexed connections a TCP/UDP packet may match, in the
+ * same order as conn_used: the lists of the packet's remote and local port
+ * buckets and the wildcard list are merged on the registration order.
+ */
+struct conn_hash_iter {
+	sys_snode_t *next[3];
+};
+
+static void conn_hash_iter_init(struct conn_hash_iter *iter,
+				struct conn_input *in)
+{
+	uint32_t hash = conn_hash_port_key(in->proto, in->dst_port);
+	uint32_t remote_hash;
+
+	if (IS_ENABLED(CONFIG_NET_IPV6) && net_pkt_family(in->pkt) == AF_INET6) {
+		remote_hash = conn_hash_remote_key(hash, in->src_port,
+						   in->ip_hdr->ipv6->src,
+						   sizeof(struct in6_addr));
+	} else {
+		remote_hash = conn_hash_remote_key(hash, in->src_port,
+						   in->ip_hdr->ipv4->src,
+						   sizeof(struct in_addr));
+	}
+
+	iter->next[0] = sys_slist_peek_head(
+		&conn_hash_remote[remote_hash % CONFIG_NET_CONN_HASH_BUCKETS]);
+	iter->next[1] = sys_slist_peek_head(
+		&conn_hash_port[hash % CONFIG_NET_CONN_HASH_BUCKETS]);
+	iter->next[2] = sys_slist_peek_head(&conn_wildcard);
+}
+
+static struct net_conn *conn_hash_iter_next(struct conn_hash_iter *iter)
+{
+	struct net_conn *conn = NULL;
+	struct net_conn *tmp;
+	int next = 0;
+
+	for (int i = 0; i < ARRAY_SIZE(iter->next); i++) {
+		if (iter->next[i] == NULL) {
+			continue;
+		}
+
+		tmp = CONTAINER_OF(iter->next[i], struct net_conn, hash_node);
+		if (conn == NULL || (int32_t)(tmp->seq - conn->seq) > 0) {
+			conn = tmp;
+			next = i;
+		}
+	}
+
+	if (conn != NULL) {
+		iter->next[next] = sys_slist_peek_next(iter->next[next]);
+	}
+
+	return conn;
+}
+
+/* Check a candidate connection for the packet. Returns NET_DROP if the
+ * packet is to be dropped.
+ */
+static enum net_verdict conn_input_match(struct conn_input *in,
+					 struct net_conn *conn)
+{
+	struct net_pkt *pkt = in->pkt;
+	struct net_if *pkt_iface = net_pkt_iface(pkt);
+	uint8_t pkt_family = net_pkt_family(pkt);
+	uint8_t proto = in->proto;
+
+	/* Is the candidate connection matching the packet's interface? */
+	if (conn->context != NULL &&
+	    net_context_is_bound_to_iface(conn->context) &&
+	    net_pkt_iface(pkt) != net_context_get_iface(conn->context)) {
+		return NET_CONTINUE; /* wrong interface */
+	}
+
+	/* Is the candidate connection matching the packet's protocol family? */
+	if (conn->family != AF_UNSPEC &&
+	    conn->family != pkt_family) {
+		if (IS_ENABLED(CONFIG_NET_SOCKETS_PACKET)) {
+			/* If there are other listening connections than
+			 * AF_PACKET, the packet shall be also passed back to
+			 * net_conn_input() in upper layer processing in order to
+			 * re-check if there is any listening socket interested
+			 * in this packet.
+			 */
+			if (conn->family != AF_PACKET) {
+				in->raw_pkt_continue = true;
+			}
+		}
+
+		if (IS_ENABLED(CONFIG_NET_IPV4_MAPPING_TO_IPV6)) {
+			if (!(conn->family == AF_INET6 && pkt_family == AF_INET &&
+			      !conn->v6only)) {
+				return NET_CONTINUE;
+			}
+		} else {
+			return NET_CONTINUE; /* wrong protocol family */
+		}
+
+		/* We might have a match for v4-to-v6 mapping, check more */
+	}
+
+	/* Is the candidate connection matching the packet's protocol within the family? */
+	if (conn->proto != proto) {
+		/* For packet socket data, the proto is set to ETH_P_ALL
+		 * or IPPROTO_RAW but the listener might have a specific
+		 * protocol set. This is ok and let the packet pass this
+		 * check in this case.
+		 */
+		if (IS_ENABLED(CONFIG_NET_SOCKETS_PACKET) && pkt_family == AF_PACKET) {
+			if (proto != ETH_P_ALL && proto != IPPROTO_RAW) {
+				return NET_CONTINUE; /* wrong protocol */
+			}
+		} else {
+			return NET_CONTINUE; /* wrong protocol */
+		}
+	}
+
+	/* Apply protocol-specific matching criteria... */
+	uint8_t conn_family = conn->family;
+
+	if (IS_ENABLED(CONFIG_NET_SOCKETS_PACKET) && conn_family == AF_PACKET) {
+		/* This code shall be only executed when one enters
+		 * the net_conn_input() from net_packet_socket() which
+		 * targets AF_PACKET sockets.
+		 *
+		 * All AF_PACKET connections will receive the packet if
+		 * their socket type and - in case of IPPROTO - protocol
+		 * also matches.
+		 */
+		if (proto == ETH_P_ALL) {
+			/* We shall continue with ETH_P_ALL to IPPROTO_RAW: */
+			in->raw_pkt_continue = true;
+		}
+
+		/* With IPPROTO_RAW deliver only if protocol match: */
+		if ((proto == ETH_P_ALL && conn->proto != IPPROTO_RAW) ||
+		    conn->proto == proto) {
+			enum net_verdict ret = conn_raw_socket(pkt, conn, proto);
+
+			if (ret == NET_DROP) {
+				return NET_DROP;
+			} else if (ret == NET_OK) {
+				in->raw_pkt_delivered = true;
+			}
+
+			return NET_CONTINUE; /* packet was consumed */
+		}
+	} else if ((IS_ENABLED(CONFIG_NET_UDP) || IS_ENABLED(CONFIG_NET_TCP)) &&
+		   (conn_family == AF_INET || conn_family == AF_INET6 ||
+		    conn_family == AF_UNSPEC)) {
+		/* Is the candidate connection matching the packet's TCP/UDP
+		 * address and port?
+		 */
+		if (net_sin(&conn->remote_addr)->sin_port &&
+		    net_sin(&conn->remote_addr)->sin_port != in->src_port) {
+			return NET_CONTINUE; /* wrong remote port */
+		}
+
+		if (net_sin(&conn->local_addr)->sin_port &&
+		    net_sin(&conn->local_addr)->sin_port != in->dst_port) {
+			return NET_CONTINUE; /* wrong local port */
+		}
+
+		if ((conn->flags & NET_CONN_REMOTE_ADDR_SET) &&
+		    !conn_addr_cmp(pkt, in->ip_hdr, &conn->remote_addr, true)) {
+			return NET_CONTINUE; /* wrong remote address */
+		}
+
+		if ((conn->flags & NET_CONN_LOCAL_ADDR_SET) &&
+		    !conn_addr_cmp(pkt, in->ip_hdr, &conn->local_addr, false)) {
+
+			/* Check if we could do a v4-mapping-to-v6 and the IPv6 socket
+			 * has no IPV6_V6ONLY option set and if the local IPV6 address
+			 * is unspecified, then we could accept a connection from IPv4
+			 * address by mapping it to IPv6 address.
+			 */
+			if (IS_ENABLED(CONFIG_NET_IPV4_MAPPING_TO_IPV6)) {
+				if (!(conn->family == AF_INET6 && pkt_family == AF_INET &&
+				      !conn->v6only &&
+				      net_ipv6_is_addr_unspecified(
+					      &net_sin6(&conn->local_addr)->sin6_addr))) {
+					return NET_CONTINUE; /* wrong local address */
+				}
+			} else {
+				return NET_CONTINUE; /* wrong local address */
+			}
+
+			/* We might have a match for v4-to-v6 mapping,
+			 * continue with rank checking.
+			 */
+		}
+
+		if (in->best_rank < NET_CONN_RANK(conn->flags)) {
+			struct net_pkt *mcast_pkt;
+
+			if (!in->is_mcast_pkt) {
+				in->best_rank = NET_CONN_RANK(conn->flags);
+				in->best_match = conn;
+
+				return NET_CONTINUE; /* found a match - but maybe not yet the best */
+			}
+
+			/* If we have a multicast packet, and we found
+			 * a match, then deliver the packet immediately
+			 * to the handler. As there might be several
+			 * sockets interested about these, we need to
+			 * clone the received pkt.
+			 */
+
+			NET_DBG("[%p] mcast match found cb %p ud %p", conn, conn->cb,
+				conn->user_data);
+
+			mcast_pkt = net_pkt_clone(pkt, CLONE_TIMEOUT);
+			if (!mcast_pkt) {
+				return NET_DROP;
+			}
+
+			if (conn->cb(conn, mcast_pkt, in->ip_hdr, in->proto_hdr,
+				     conn->user_data) == NET_DROP) {
+				net_stats_update_per_proto_drop(pkt_iface, proto);
+				net_pkt_unref(mcast_pkt);
+			} else {
+				net_stats_update_per_proto_recv(pkt_iface, proto);
+			}
+
+			in->mcast_pkt_delivered = true;
+		}
+	} else if (IS_ENABLED(CONFIG_NET_SOCKETS_CAN) && conn_family == AF_CAN) {
+		in->best_match = conn;
+	}
+
+	return NET_CONTINUE;
+}
+
 enum net_verdict net_conn_input(struct net_pkt *pkt,
 				union net_ip_header *ip_hdr,
 				uint8_t proto,
@@ -681,13 +1082,16 @@ enum net_verdict net_conn_input(struct net_pkt *pkt,
 		ntohs(src_port), ntohs(dst_port), net_pkt_family(pkt));
 
 
-	struct net_conn *best_match = NULL;
-	int16_t best_rank = -1;
-	bool is_mcast_pkt = false;
-	bool mcast_pkt_delivered = false;
+	struct conn_input in = {
+		.pkt = pkt,
+		.ip_hdr = ip_hdr,
+		.proto_hdr = proto_hdr,
+		.best_rank = -1,
+		.src_port = src_port,
+		.dst_port = dst_port,
+		.proto = proto,
+	};
 	bool is_bcast_pkt = false;
-	bool raw_pkt_delivered = false;
-	bool raw_pkt_continue = false;
 	struct net_conn *conn;
 	net_conn_cb_t cb = NULL;
 	void *user_data = NULL;
@@ -698,202 +1102,61 @@ enum net_verdict net_conn_input(struct net_pkt *pkt,
 		 */
 		if (IS_ENABLED(CONFIG_NET_IPV4) && pkt_family == AF_INET) {
 			if (net_ipv4_is_addr_mcast((struct in_addr *)ip_hdr->ipv4->dst)) {
-				is_mcast_pkt = true;
+				in.is_mcast_pkt = true;
 			} else if (net_if_ipv4_is_addr_bcast(pkt_iface,
 							     (struct in_addr *)ip_hdr->ipv4->dst)) {
 				is_bcast_pkt = true;
 			}
 		} else if (IS_ENABLED(CONFIG_NET_IPV6) && pkt_family == AF_INET6) {
-			is_mcast_pkt = net_ipv6_is_addr_mcast((struct in6_addr *)ip_hdr->ipv6->dst);
+			in.is_mcast_pkt = net_ipv6_is_addr_mcast((struct in6_addr *)ip_hdr->ipv6->dst);
 		}
 	}
 
 	k_mutex_lock(&conn_lock, K_FOREVER);
 
-	SYS_SLIST_FOR_EACH_CONTAINER(&conn_used, conn, node) {
-		/* Is the candidate connection matching the packet's interface? */
-		if (conn->context != NULL &&
-		    net_context_is_bound_to_iface(conn->context) &&
-		    net_pkt_iface(pkt) != net_context_get_iface(conn->context)) {
-			continue; /* wrong interface */
-		}
-
-		/* Is the candidate connection matching the packet's protocol family? */
-		if (conn->family != AF_UNSPEC &&
-		    conn->family != pkt_family) {
-			if (IS_ENABLED(CONFIG_NET_SOCKETS_PACKET)) {
-				/* If there are other listening connections than
-				 * AF_PACKET, the packet shall be also passed back to
-				 * net_conn_input() in upper layer processing in order to
-				 * re-check if there is any listening socket interested
-				 * in this packet.
-				 */
-				if (conn->family != AF_PACKET) {
-					raw_pkt_continue = true;
-				}
-			}
-
-			if (IS_ENABLED(CONFIG_NET_IPV4_MAPPING_TO_IPV6)) {
-				if (!(conn->family == AF_INET6 && pkt_family == AF_INET &&
-				      !conn->v6only)) {
-					continue;
-				}
-			} else {
-				continue; /* wrong protocol family */
-			}
-
-			/* We might have a match for v4-to-v6 mapping, check more */
-		}
-
-		/* Is the candidate connection matching the packet's protocol within the family? */
-		if (conn->proto != proto) {
-			/* For packet socket data, the proto is set to ETH_P_ALL
-			 * or IPPROTO_RAW but the listener might have a specific
-			 * protocol set. This is ok and let the packet pass this
-			 * check in this case.
-			 */
-			if (IS_ENABLED(CONFIG_NET_SOCKETS_PACKET) && pkt_family == AF_PACKET) {
-				if (proto != ETH_P_ALL && proto != IPPROTO_RAW) {
-					continue; /* wrong protocol */
-				}
-			} else {
-				continue; /* wrong protocol */
-			}
-		}
-
-		/* Apply protocol-specific matching criteria... */
-		uint8_t conn_family = conn->family;
-
-		if (IS_ENABLED(CONFIG_NET_SOCKETS_PACKET) && conn_family == AF_PACKET) {
-			/* This code shall be only executed when one enters
-			 * the net_conn_input() from net_packet_socket() which
-			 * targets AF_PACKET sockets.
-			 *
-			 * All AF_PACKET connections will receive the packet if
-			 * their socket type and - in case of IPPROTO - protocol
-			 * also matches.
-			 */
-			if (proto == ETH_P_ALL) {
-				/* We shall continue with ETH_P_ALL to IPPROTO_RAW: */
-				raw_pkt_continue = true;
-			}
-
-			/* With IPPROTO_RAW deliver only if protocol match: */
-			if ((proto == ETH_P_ALL && conn->proto != IPPROTO_RAW) ||
-			    conn->proto == proto) {
-				enum net_verdict ret = conn_raw_socket(pkt, conn, proto);
-
-				if (ret == NET_DROP) {
-					k_mutex_unlock(&conn_lock);
-					goto drop;
-				} else if (ret == NET_OK) {
-					raw_pkt_delivered = true;
-				}
+	if (IS_ENABLED(CONFIG_NET_IP) && (pkt_family == AF_INET || pkt_family == AF_INET6)) {
+		struct conn_hash_iter iter;
 
-				continue; /* packet was consumed */
-			}
-		} else if ((IS_ENABLED(CONFIG_NET_UDP) || IS_ENABLED(CONFIG_NET_TCP)) &&
-			   (conn_family == AF_INET || conn_family == AF_INET6 ||
-			    conn_family == AF_UNSPEC)) {
-			/* Is the candidate connection matching the packet's TCP/UDP
-			 * address and port?
-			 */
-			if (net_sin(&conn->remote_addr)->sin_port &&
-			    net_sin(&conn->remote_addr)->sin_port != src_port) {
-				continue; /* wrong remote port */
-			}
+		/* Only the indexed connections can match, and none seen after
+		 * a match of the best rank can be preferred to it.
+		 */
+		conn_hash_iter_init(&iter, &in);
 
-			if (net_sin(&conn->local_addr)->sin_port &&
-			    net_sin(&conn->local_addr)->sin_port != dst_port) {
-				continue; /* wrong local port */
+		while ((conn = conn_hash_iter_next(&iter)) != NULL) {
+			if (conn_input_match(&in, conn) == NET_DROP) {
+				k_mutex_unlock(&conn_lock);
+				goto drop;
 			}
 
-			if ((conn->flags & NET_CONN_REMOTE_ADDR_SET) &&
-			    !conn_addr_cmp(pkt, ip_hdr, &conn->remote_addr, true)) {
-				continue; /* wrong remote address */
+			if (!in.is_mcast_pkt && in.best_rank == NET_CONN_RANK_MAX) {
+				break;
 			}
-
-			if ((conn->flags & NET_CONN_LOCAL_ADDR_SET) &&
-			    !conn_addr_cmp(pkt, ip_hdr, &conn->local_addr, false)) {
-
-				/* Check if we could do a v4-mapping-to-v6 and the IPv6 socket
-				 * has no IPV6_V6ONLY option set and if the local IPV6 address
-				 * is unspecified, then we could accept a connection from IPv4
-				 * address by mapping it to IPv6 address.
-				 */
-				if (IS_ENABLED(CONFIG_NET_IPV4_MAPPING_TO_IPV6)) {
-					if (!(conn->family == AF_INET6 && pkt_family == AF_INET &&
-					      !conn->v6only &&
-					      net_ipv6_is_addr_unspecified(
-						      &net_sin6(&conn->local_addr)->sin6_addr))) {
-						continue; /* wrong local address */
-					}
-				} else {
-					continue; /* wrong local address */
-				}
-
-				/* We might have a match for v4-to-v6 mapping,
-				 * continue with rank checking.
-				 */
-			}
-
-			if (best_rank < NET_CONN_RANK(conn->flags)) {
-				struct net_pkt *mcast_pkt;
-
-				if (!is_mcast_pkt) {
-					best_rank = NET_CONN_RANK(conn->flags);
-					best_match = conn;
-
-					continue; /* found a match - but maybe not yet the best */
-				}
-
-				/* If we have a multicast packet, and we found
-				 * a match, then deliver the packet immediately
-				 * to the handler. As there might be several
-				 * sockets interested about these, we need to
-				 * clone the received pkt.
-				 */
-
-				NET_DBG("[%p] mcast match found cb %p ud %p", conn, conn->cb,
-					conn->user_data);
-
-				mcast_pkt = net_pkt_clone(pkt, CLONE_TIMEOUT);
-				if (!mcast_pkt) {
-					k_mutex_unlock(&conn_lock);
-					goto drop;
-				}
-
-				if (conn->cb(conn, mcast_pkt, ip_hdr, proto_hdr, conn->user_data) ==
-				    NET_DROP) {
-					net_stats_update_per_proto_drop(pkt_iface, proto);
-					net_pkt_unref(mcast_pkt);
-				} else {
-					net_stats_update_per_proto_recv(pkt_iface, proto);
-				}
-
-				mcast_pkt_delivered = true;
+		}
+	} else {
+		SYS_SLIST_FOR_EACH_CONTAINER(&conn_used, conn, node) {
+			if (conn_input_match(&in, conn) == NET_DROP) {
+				k_mutex_unlock(&conn_lock);
+				goto drop;
 			}
-		} else if (IS_ENABLED(CONFIG_NET_SOCKETS_CAN) && conn_family == AF_CAN) {
-			best_match = conn;
 		}
-	} /* loop end */
+	}
 
-	if (best_match) {
-		cb = best_match->cb;
-		user_data = best_match->user_data;
+	if (in.best_match) {
+		cb = in.best_match->cb;
+		user_data = in.best_match->user_data;
 	}
 
 	k_mutex_unlock(&conn_lock);
 
 	if (IS_ENABLED(CONFIG_NET_SOCKETS_PACKET) && pkt_family == AF_PACKET) {
-		if (raw_pkt_continue) {
+		if (in.raw_pkt_continue) {
 			/* When there is open connection different than
 			 * AF_PACKET this packet shall be also handled in
 			 * the upper net stack layers.
 			 */
 			return NET_CONTINUE;
 		}
-		if (raw_pkt_delivered) {
+		if (in.raw_pkt_delivered) {
 			/* As one or more raw socket packets
 			 * have already been delivered in the loop above,
 			 * we shall not call the callback again here.
@@ -903,7 +1166,7 @@ enum net_verdict net_conn_input(struct net_pkt *pkt,
 		}
 	}
 
-	if (IS_ENABLED(CONFIG_NET_IP) && is_mcast_pkt && mcast_pkt_delivered) {
+	if (IS_ENABLED(CONFIG_NET_IP) && in.is_mcast_pkt && in.mcast_pkt_delivered) {
 		/* As one or more multicast packets
 		 * have already been delivered in the loop above,
 		 * we shall not call the callback again here.
@@ -913,10 +1176,10 @@ enum net_verdict net_conn_input(struct net_pkt *pkt,
 	}
 
 	if (cb) {
-		NET_DBG("[%p] match found cb %p ud %p rank 0x%02x", best_match, cb,
-			user_data, NET_CONN_RANK(best_match->flags));
+		NET_DBG("[%p] match found cb %p ud %p rank 0x%02x", in.best_match, cb,
+			user_data, NET_CONN_RANK(in.best_match->flags));
 
-		if (cb(best_match, pkt, ip_hdr, proto_hdr, user_data)
+		if (cb(in.best_match, pkt, ip_hdr, proto_hdr, user_data)
 				== NET_DROP) {
 			goto drop;
 		}
@@ -929,7 +1192,7 @@ enum net_verdict net_conn_input(struct net_pkt *pkt,
 	NET_DBG("No match found.");
 
 	if (IS_ENABLED(CONFIG_NET_IP) && (pkt_family == AF_INET || pkt_family == AF_INET6) &&
-	    !(is_mcast_pkt || is_bcast_pkt)) {
+	    !(in.is_mcast_pkt || is_bcast_pkt)) {
 		if (IS_ENABLED(CONFIG_NET_TCP) && proto == IPPROTO_TCP &&
 		    IS_ENABLED(CONFIG_NET_TCP_REJECT_CONN_WITH_RST)) {
 			net_tcp_reply_rst(pkt);
@@ -968,4 +1231,11 @@ void net_conn_init(void)
 	for (i = 0; i < CONFIG_NET_MAX_CONN; i++) {
 		sys_slist_prepend(&conn_unused, &conns[i].node);
 	}
+
+	for (i = 0; i < CONFIG_NET_CONN_HASH_BUCKETS; i++) {
+		sys_slist_init(&conn_hash_remote[i]);
+		sys_slist_init(&conn_hash_port[i]);
+	}
+
+	sys_slist_init(&conn_wildcard);
 }
@@ -54,6 +54,12 @@ struct net_conn {
 	/** Internal slist node */
 	sys_snode_t node;
 
+	/** Node in the lookup hash table, for TCP/UDP connections */
+	sys_snode_t hash_node;
+
+	/** Registration order, connections registered last being preferred */
+	uint32_t seq;
+
 	/** Remote socket address */
 	struct sockaddr remote_addr;
 
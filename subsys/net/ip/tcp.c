@@ -82,6 +82,7 @@ static K_KERNEL_STACK_DEFINE(work_q_stack, CONFIG_NET_TCP_WORKQ_STACK_SIZE);
 static enum net_verdict tcp_in(struct tcp *conn, struct net_pkt *pkt);
 static bool is_destination_local(struct net_pkt *pkt);
 static void tcp_out(struct tcp *conn, uint8_t flags);
+static void tcp_sack_arm_probe(struct tcp *conn);
 static const char *tcp_state_to_str(enum tcp_state state, bool prefix);
 
 int (*tcp_send_cb)(struct net_pkt *pkt) = NULL;
@@ -805,6 +806,9 @@ static void tcp_conn_release(struct k_work *work)
 	(void)k_work_cancel_delayable(&conn->ack_timer);
 	(void)k_work_cancel_delayable(&conn->send_timer);
 	(void)k_work_cancel_delayable(&conn->recv_queue_timer);
+#if defined(CONFIG_NET_TCP_SACK)
+	(void)k_work_cancel_delayable(&conn->rack_timer);
+#endif
 	keep_alive_timer_stop(conn);
 
 	k_mutex_unlock(&conn->lock);
@@ -1087,7 +1091,7 @@ static uint8_t *tcp_options_get(struct net_pkt *pkt, int tcp_options_len,
 }
 
 static bool tcp_options_check(struct tcp_options *recv_options,
-			      struct net_pkt *pkt, ssize_t len)
+			      struct net_pkt *pkt, ssize_t len, bool syn)
 {
 	uint8_t options_buf[40]; /* TCP header max options size is 40 */
 	bool result = len > 0 && ((len % 4) == 0) ? true : false;
@@ -1097,8 +1101,18 @@ static bool tcp_options_check(struct tcp_options *recv_options,
 
 	NET_DBG("len=%zd", len);
 
-	recv_options->mss_found = false;
-	recv_options->wnd_found = false;
+	/* The MSS and window scale options are only valid in a SYN segment,
+	 * they are ignored in later segments.
+	 */
+	if (syn) {
+		recv_options->mss_found = false;
+		recv_options->wnd_found = false;
+	}
+
+#if defined(CONFIG_NET_TCP_SACK)
+	recv_options->sack_perm_found = false;
+	recv_options->sack_cnt = 0;
+#endif
 
 	for ( ; options && len >= 1; options += opt_len, len -= opt_len) {
 		opt = options[0];
@@ -1133,6 +1147,10 @@ static bool tcp_options_check(struct tcp_options *recv_options,
 				goto end;
 			}
 
+			if (!syn) {
+				break;
+			}
+
 			recv_options->mss =
 				ntohs(UNALIGNED_GET((uint16_t *)(options + 2)));
 			recv_options->mss_found = true;
@@ -1144,9 +1162,42 @@ static bool tcp_options_check(struct tcp_options *recv_options,
 				goto end;
 			}
 
+			if (!syn) {
+				break;
+			}
+
 			recv_options->window = opt;
 			recv_options->wnd_found = true;
 			break;
+#if defined(CONFIG_NET_TCP_SACK)
+		case NET_TCP_SACK_PERM_OPT:
+			if (opt_len != NET_TCP_SACK_PERM_SIZE) {
+				result = false;
+				goto end;
+			}
+
+			recv_options->sack_perm_found = true;
+			break;
+		case NET_TCP_SACK_OPT:
+			if (((opt_len - 2) % NET_TCP_SACK_BLOCK_SIZE) != 0) {
+				result = false;
+				goto end;
+			}
+
+			for (int i = 0; i < (opt_len - 2) / NET_TCP_SACK_BLOCK_SIZE &&
+					i < NET_TCP_SACK_MAX_BLOCKS; i++) {
+				uint8_t *block = options + 2 + i * NET_TCP_SACK_BLOCK_SIZE;
+
+				recv_options->sack[i].start =
+					ntohl(UNALIGNED_GET((uint32_t *)block));
+				recv_options->sack[i].end =
+					ntohl(UNALIGNED_GET((uint32_t *)(block + 4)));
+				recv_options->sack_cnt++;
+			}
+
+			NET_DBG("SACK blocks=%hu", (uint16_t)recv_options->sack_cnt);
+			break;
+#endif
 		default:
 			continue;
 		}
@@ -1338,7 +1389,7 @@ static int tcp_finalize_pkt(struct net_pkt *pkt)
 }
 
 static int tcp_header_add(struct tcp *conn, struct net_pkt *pkt, uint8_t flags,
-			  uint32_t seq)
+			  uint32_t seq, size_t opts_len)
 {
 	NET_PKT_DATA_ACCESS_DEFINE(tcp_access, struct tcphdr);
 	struct tcphdr *th;
@@ -1352,11 +1403,7 @@ static int tcp_header_add(struct tcp *conn, struct net_pkt *pkt, uint8_t flags,
 
 	UNALIGNED_PUT(conn->src.sin.sin_port, &th->th_sport);
 	UNALIGNED_PUT(conn->dst.sin.sin_port, &th->th_dport);
-	th->th_off = 5;
-
-	if (conn->send_options.mss_found) {
-		th->th_off++;
-	}
+	th->th_off = 5 + opts_len / 4;
 
 	UNALIGNED_PUT(flags, &th->th_flags);
 	UNALIGNED_PUT(htons(conn->recv_win), &th->th_win);
@@ -1436,6 +1483,65 @@ static int net_tcp_set_mss_opt(struct tcp *conn, struct net_pkt *pkt)
 	return net_pkt_set_data(pkt, &mss_opt_access);
 }
 
+#if defined(CONFIG_NET_TCP_SACK)
+/* Build the SACK related options of an outgoing segment into opts, which
+ * must have room for at least 12 bytes. SACK-permitted is offered in our SYN
+ * and echoed in the SYN-ACK if the peer offered it. Once negotiated, pure
+ * ACKs report the out-of-order data held in the receive queue. As that queue
+ * is always contiguous there is at most one block to report. The options are
+ * padded with NOPs to keep them 32-bit aligned.
+ */
+static size_t tcp_sack_opts_build(struct tcp *conn, uint8_t flags,
+				  bool has_data, uint8_t *opts)
+{
+	uint32_t start, end;
+
+	if (flags & SYN) {
+		if ((flags & ACK) && !conn->sack_permitted) {
+			return 0;
+		}
+
+		opts[0] = NET_TCP_NOP_OPT;
+		opts[1] = NET_TCP_NOP_OPT;
+		opts[2] = NET_TCP_SACK_PERM_OPT;
+		opts[3] = NET_TCP_SACK_PERM_SIZE;
+
+		return 4;
+	}
+
+	/* Do not add options to data segments, they would not fit the MSS */
+	if (!conn->sack_permitted || !(flags & ACK) || has_data ||
+	    !CONFIG_NET_TCP_RECV_QUEUE_TIMEOUT ||
+	    conn->queue_recv_data == NULL ||
+	    net_pkt_is_empty(conn->queue_recv_data)) {
+		return 0;
+	}
+
+	start = tcp_get_seq(conn->queue_recv_data->buffer);
+	end = start + net_pkt_get_len(conn->queue_recv_data);
+
+	opts[0] = NET_TCP_NOP_OPT;
+	opts[1] = NET_TCP_NOP_OPT;
+	opts[2] = NET_TCP_SACK_OPT;
+	opts[3] = 2 + NET_TCP_SACK_BLOCK_SIZE;
+	UNALIGNED_PUT(htonl(start), (uint32_t *)&opts[4]);
+	UNALIGNED_PUT(htonl(end), (uint32_t *)&opts[8]);
+
+	return 12;
+}
+#else
+static size_t tcp_sack_opts_build(struct tcp *conn, uint8_t flags,
+				  bool has_data, uint8_t *opts)
+{
+	ARG_UNUSED(conn);
+	ARG_UNUSED(flags);
+	ARG_UNUSED(has_data);
+	ARG_UNUSED(opts);
+
+	return 0;
+}
+#endif /* CONFIG_NET_TCP_SACK */
+
 static bool is_destination_local(struct net_pkt *pkt)
 {
 	if (IS_ENABLED(CONFIG_NET_IPV4) && net_pkt_family(pkt) == AF_INET) {
@@ -1541,13 +1647,20 @@ static int tcp_out_ext(struct tcp *conn, uint8_t flags, struct net_pkt *data,
 		       uint32_t seq)
 {
 	size_t alloc_len = sizeof(struct tcphdr);
+	uint8_t sack_opts[12];
+	size_t sack_opts_len;
+	size_t opts_len = 0;
 	struct net_pkt *pkt;
 	int ret = 0;
 
 	if (conn->send_options.mss_found) {
-		alloc_len += sizeof(uint32_t);
+		opts_len += sizeof(uint32_t);
 	}
 
+	sack_opts_len = tcp_sack_opts_build(conn, flags, data != NULL, sack_opts);
+	opts_len += sack_opts_len;
+	alloc_len += opts_len;
+
 	pkt = tcp_pkt_alloc(conn, alloc_len);
 	if (!pkt) {
 		ret = -ENOBUFS;
@@ -1566,7 +1679,7 @@ static int tcp_out_ext(struct tcp *conn, uint8_t flags, struct net_pkt *data,
 		goto out;
 	}
 
-	ret = tcp_header_add(conn, pkt, flags, seq);
+	ret = tcp_header_add(conn, pkt, flags, seq, opts_len);
 	if (ret < 0) {
 		tcp_pkt_unref(pkt);
 		goto out;
@@ -1580,6 +1693,14 @@ static int tcp_out_ext(struct tcp *conn, uint8_t flags, struct net_pkt *data,
 		}
 	}
 
+	if (sack_opts_len > 0) {
+		ret = net_pkt_write(pkt, sack_opts, sack_opts_len);
+		if (ret < 0) {
+			tcp_pkt_unref(pkt);
+			goto out;
+		}
+	}
+
 	ret = tcp_finalize_pkt(pkt);
 	if (ret < 0) {
 		tcp_pkt_unref(pkt);
@@ -1626,6 +1747,28 @@ static int tcp_pkt_pull(struct net_pkt *pkt, size_t len)
 		goto out;
 	}
 
+	if (IS_ENABLED(CONFIG_NET_TCP_TX_ZEROCOPY)) {
+		/* Unlike net_pkt_pull(), do not move the remaining data, as
+		 * the buffers may reference read-only application data.
+		 */
+		while (len > 0) {
+			struct net_buf *buf = pkt->buffer;
+			size_t pull_len = MIN(len, buf->len);
+
+			net_buf_pull(buf, pull_len);
+			len -= pull_len;
+
+			if (buf->len == 0) {
+				pkt->buffer = buf->frags;
+				buf->frags = NULL;
+				net_buf_unref(buf);
+			}
+		}
+
+		net_pkt_cursor_init(pkt);
+		goto out;
+	}
+
 	net_pkt_cursor_init(pkt);
 	net_pkt_set_overwrite(pkt, true);
 	net_pkt_pull(pkt, len);
@@ -1634,6 +1777,7 @@ static int tcp_pkt_pull(struct net_pkt *pkt, size_t len)
 	return ret;
 }
 
+#if !defined(CONFIG_NET_TCP_TX_ZEROCOPY)
 static int tcp_pkt_peek(struct net_pkt *to, struct net_pkt *from, size_t pos,
 			size_t len)
 {
@@ -1647,6 +1791,7 @@ static int tcp_pkt_peek(struct net_pkt *to, struct net_pkt *from, size_t pos,
 
 	return net_pkt_copy(to, from, len);
 }
+#endif
 
 static int tcp_pkt_append(struct net_pkt *pkt, const uint8_t *data, size_t len)
 {
@@ -1691,6 +1836,91 @@ static int tcp_pkt_append(struct net_pkt *pkt, const uint8_t *data, size_t len)
 	return ret;
 }
 
+#if defined(CONFIG_NET_TCP_TX_ZEROCOPY)
+/* Buffers referencing application data. The data queued by the application
+ * is referenced by a buffer which holds the completion callback, and the part
+ * of it sent in a segment by a buffer which holds a reference to the former.
+ */
+struct tcp_zc_info {
+	net_tcp_zc_cb_t cb;
+	void *user_data;
+	struct net_buf *parent;
+};
+
+static void tcp_zc_destroy(struct net_buf *buf);
+
+NET_BUF_POOL_FIXED_DEFINE(tcp_zc_pool, CONFIG_NET_TCP_TX_ZEROCOPY_BUF_COUNT, 0,
+			  sizeof(struct tcp_zc_info), tcp_zc_destroy);
+
+static void tcp_zc_destroy(struct net_buf *buf)
+{
+	struct tcp_zc_info info = *(struct tcp_zc_info *)net_buf_user_data(buf);
+
+	net_buf_destroy(buf);
+
+	if (info.parent != NULL) {
+		net_buf_unref(info.parent);
+	} else if (info.cb != NULL) {
+		info.cb(info.user_data);
+	}
+}
+
+static bool tcp_is_zc_buf(struct net_buf *buf)
+{
+	return net_buf_pool_get(buf->pool_id) == &tcp_zc_pool;
+}
+
+/* Copy the data to send in a segment from the send queue, except for the
+ * application data, which is referenced instead.
+ */
+static int tcp_pkt_peek_zc(struct net_pkt *to, struct net_pkt *from,
+			   size_t pos, size_t len)
+{
+	struct net_buf *frag;
+
+	for (frag = from->buffer; frag != NULL && len > 0; frag = frag->frags) {
+		size_t frag_len;
+		int ret;
+
+		if (pos >= frag->len) {
+			pos -= frag->len;
+			continue;
+		}
+
+		frag_len = MIN(len, frag->len - pos);
+
+		if (tcp_is_zc_buf(frag)) {
+			struct tcp_zc_info *info;
+			struct net_buf *buf;
+
+			buf = net_buf_alloc_with_data(&tcp_zc_pool,
+						      frag->data + pos,
+						      frag_len, K_NO_WAIT);
+			if (buf == NULL) {
+				return -ENOBUFS;
+			}
+
+			info = net_buf_user_data(buf);
+			info->cb = NULL;
+			info->user_data = NULL;
+			info->parent = net_buf_ref(frag);
+
+			net_pkt_append_buffer(to, buf);
+		} else {
+			ret = tcp_pkt_append(to, frag->data + pos, frag_len);
+			if (ret < 0) {
+				return ret;
+			}
+		}
+
+		pos = 0;
+		len -= frag_len;
+	}
+
+	return 0;
+}
+#endif /* CONFIG_NET_TCP_TX_ZEROCOPY */
+
 static bool tcp_window_full(struct tcp *conn)
 {
 	bool window_full = (conn->send_data_total >= conn->send_win);
@@ -1735,11 +1965,49 @@ static int tcp_unsent_len(struct tcp *conn)
 	return unsent_len;
 }
 
+/* Send len bytes of the send queue, starting offset bytes after the first
+ * unacknowledged byte.
+ */
+static int tcp_send_segment(struct tcp *conn, int offset, int len)
+{
+	struct net_pkt *pkt;
+	int ret;
+
+#if defined(CONFIG_NET_TCP_TX_ZEROCOPY)
+	pkt = tcp_pkt_alloc(conn, 0);
+#else
+	pkt = tcp_pkt_alloc(conn, len);
+#endif
+	if (!pkt) {
+		NET_ERR("conn: %p packet allocation failed, len=%d", conn, len);
+		return -ENOBUFS;
+	}
+
+#if defined(CONFIG_NET_TCP_TX_ZEROCOPY)
+	ret = tcp_pkt_peek_zc(pkt, conn->send_data, offset, len);
+#else
+	ret = tcp_pkt_peek(pkt, conn->send_data, offset, len);
+#endif
+	if (ret < 0) {
+		tcp_pkt_unref(pkt);
+		return -ENOBUFS;
+	}
+
+	ret = tcp_out_ext(conn, PSH | ACK, pkt, conn->seq + offset);
+
+	/* The data we want to send, has been moved to the send queue so we
+	 * can unref the head net_pkt. If there was an error, we need to remove
+	 * the packet anyway.
+	 */
+	tcp_pkt_unref(pkt);
+
+	return ret;
+}
+
 static int tcp_send_data(struct tcp *conn)
 {
 	int ret = 0;
 	int len;
-	struct net_pkt *pkt;
 
 	len = MIN(tcp_unsent_len(conn), conn_mss(conn));
 	if (len < 0) {
@@ -1752,23 +2020,10 @@ static int tcp_send_data(struct tcp *conn)
 		goto out;
 	}
 
-	pkt = tcp_pkt_alloc(conn, len);
-	if (!pkt) {
-		NET_ERR("conn: %p packet allocation failed, len=%d", conn, len);
-		ret = -ENOBUFS;
-		goto out;
-	}
-
-	ret = tcp_pkt_peek(pkt, conn->send_data, conn->unacked_len, len);
-	if (ret < 0) {
-		tcp_pkt_unref(pkt);
-		ret = -ENOBUFS;
-		goto out;
-	}
-
-	ret = tcp_out_ext(conn, PSH | ACK, pkt, conn->seq + conn->unacked_len);
+	ret = tcp_send_segment(conn, conn->unacked_len, len);
 	if (ret == 0) {
 		conn->unacked_len += len;
+		tcp_sack_arm_probe(conn);
 
 		if (conn->data_mode == TCP_DATA_MODE_RESEND) {
 			net_stats_update_tcp_resent(conn->iface, len);
@@ -1779,12 +2034,6 @@ static int tcp_send_data(struct tcp *conn)
 		}
 	}
 
-	/* The data we want to send, has been moved to the send queue so we
-	 * can unref the head net_pkt. If there was an error, we need to remove
-	 * the packet anyway.
-	 */
-	tcp_pkt_unref(pkt);
-
 	conn_send_data_dump(conn);
 
  out:
@@ -1839,6 +2088,374 @@ static int tcp_send_queued_data(struct tcp *conn)
 	return ret;
 }
 
+#if defined(CONFIG_NET_TCP_SACK)
+
+static bool tcp_sack_in_use(struct tcp *conn)
+{
+	return conn->sack_permitted;
+}
+
+/* Merge a block SACKed by the peer into the sorted scoreboard. If the
+ * scoreboard is full, the highest block is forgotten; the peer repeats it
+ * in later acknowledgements anyway.
+ */
+static void tcp_sack_insert(struct tcp *conn, uint32_t start, uint32_t end)
+{
+	struct tcp_sack_block *sb = conn->sacked;
+	int cnt = conn->sacked_cnt;
+	int i = 0;
+	int j;
+
+	while (i < cnt && net_tcp_seq_cmp(sb[i].end, start) < 0) {
+		i++;
+	}
+
+	/* Blocks [i, j) overlap or touch the new block */
+	for (j = i; j < cnt && net_tcp_seq_cmp(sb[j].start, end) <= 0; j++) {
+		if (net_tcp_seq_cmp(sb[j].start, start) < 0) {
+			start = sb[j].start;
+		}
+
+		if (net_tcp_seq_cmp(sb[j].end, end) > 0) {
+			end = sb[j].end;
+		}
+	}
+
+	if (j > i) {
+		memmove(&sb[i + 1], &sb[j], (cnt - j) * sizeof(*sb));
+		cnt -= j - i - 1;
+	} else {
+		if (i == NET_TCP_SACK_MAX_BLOCKS) {
+			return;
+		}
+
+		if (cnt == NET_TCP_SACK_MAX_BLOCKS) {
+			cnt--;
+		}
+
+		memmove(&sb[i + 1], &sb[i], (cnt - i) * sizeof(*sb));
+		cnt++;
+	}
+
+	sb[i].start = start;
+	sb[i].end = end;
+	conn->sacked_cnt = cnt;
+}
+
+/* Drop the acknowledged data from the scoreboard and add the blocks of the
+ * received segment to it.
+ */
+static void tcp_sack_update(struct tcp *conn, struct tcphdr *th)
+{
+	struct tcp_options *opts = &conn->recv_options;
+	uint32_t snd_una = th_ack(th);
+	uint32_t snd_max = conn->seq + conn->unacked_len;
+	int i = 0;
+
+	if (!tcp_sack_in_use(conn)) {
+		return;
+	}
+
+	if (net_tcp_seq_cmp(snd_una, conn->seq) < 0 ||
+	    net_tcp_seq_cmp(snd_una, snd_max) > 0) {
+		snd_una = conn->seq;
+	}
+
+	/* New data acknowledged, another tail loss probe may be sent */
+	if (net_tcp_seq_greater(snd_una, conn->seq)) {
+		conn->sack_tlp_sent = false;
+	}
+
+	while (i < conn->sacked_cnt &&
+	       net_tcp_seq_cmp(conn->sacked[i].end, snd_una) <= 0) {
+		i++;
+	}
+
+	if (i > 0) {
+		conn->sacked_cnt -= i;
+		memmove(&conn->sacked[0], &conn->sacked[i],
+			conn->sacked_cnt * sizeof(conn->sacked[0]));
+	}
+
+	if (conn->sacked_cnt > 0 &&
+	    net_tcp_seq_cmp(conn->sacked[0].start, snd_una) < 0) {
+		conn->sacked[0].start = snd_una;
+	}
+
+	/* Ignore D-SACK and bogus blocks */
+	for (i = 0; i < opts->sack_cnt; i++) {
+		if (net_tcp_seq_cmp(opts->sack[i].start, snd_una) < 0 ||
+		    net_tcp_seq_cmp(opts->sack[i].end, opts->sack[i].start) <= 0 ||
+		    net_tcp_seq_cmp(opts->sack[i].end, snd_max) > 0) {
+			continue;
+		}
+
+		tcp_sack_insert(conn, opts->sack[i].start, opts->sack[i].end);
+	}
+
+	opts->sack_cnt = 0;
+}
+
+/* RFC 6675 IsLost(): the data at seq is considered lost if DupThresh
+ * blocks or more than (DupThresh - 1) * SMSS bytes above it have been SACKed.
+ */
+static bool tcp_sack_is_lost(struct tcp *conn, uint32_t seq)
+{
+	uint32_t sacked = 0;
+
+	for (int i = 0; i < conn->sacked_cnt; i++) {
+		if (net_tcp_seq_cmp(conn->sacked[i].start, seq) > 0) {
+			sacked += conn->sacked[i].end - conn->sacked[i].start;
+		}
+	}
+
+	return conn->sacked_cnt >= DUPLICATE_ACK_RETRANSMIT_TRHESHOLD ||
+		sacked > (DUPLICATE_ACK_RETRANSMIT_TRHESHOLD - 1) * conn_mss(conn);
+}
+
+/* Find the next segment to retransmit during recovery, i.e. the lowest
+ * unSACKed data above the highest retransmitted sequence number and below
+ * the highest SACKed one. Without SACK information only the first
+ * unacknowledged segment is retransmitted, as after a partial ACK in
+ * NewReno (RFC 6582).
+ */
+static bool tcp_sack_next_seg(struct tcp *conn, uint32_t *seq, int *len)
+{
+	uint32_t start = conn->seq;
+	uint32_t end;
+	int i;
+
+	if (net_tcp_seq_greater(conn->sack_high_rxt, start)) {
+		start = conn->sack_high_rxt;
+	}
+
+	if (conn->sacked_cnt == 0) {
+		if (start != conn->seq) {
+			return false;
+		}
+
+		end = conn->sack_recovery_point;
+	} else {
+		for (i = 0; i < conn->sacked_cnt; i++) {
+			if (net_tcp_seq_cmp(start, conn->sacked[i].start) < 0) {
+				break;
+			}
+
+			if (net_tcp_seq_cmp(start, conn->sacked[i].end) < 0) {
+				start = conn->sacked[i].end;
+			}
+		}
+
+		if (i == conn->sacked_cnt) {
+			return false;
+		}
+
+		end = conn->sacked[i].start;
+	}
+
+	if (net_tcp_seq_cmp(end, start) <= 0) {
+		return false;
+	}
+
+	*seq = start;
+	*len = MIN(end - start, conn_mss(conn));
+
+	return true;
+}
+
+static int tcp_sack_retransmit(struct tcp *conn)
+{
+	uint32_t seq;
+	int len;
+	int ret;
+
+	if (!tcp_sack_next_seg(conn, &seq, &len)) {
+		return -ENODATA;
+	}
+
+	ret = tcp_send_segment(conn, seq - conn->seq, len);
+	if (ret == 0) {
+		conn->sack_high_rxt = seq + len;
+		net_stats_update_tcp_resent(conn->iface, len);
+		net_stats_update_tcp_seg_rexmit(conn->iface);
+	}
+
+	return ret;
+}
+
+static void tcp_sack_recovery_enter(struct tcp *conn)
+{
+	NET_DBG("conn: %p enter recovery, sacked blocks %hu", conn,
+		(uint16_t)conn->sacked_cnt);
+
+	(void)k_work_cancel_delayable(&conn->rack_timer);
+	conn->sack_reo_armed = false;
+
+	conn->sack_recovery = true;
+	conn->sack_recovery_point = conn->seq + conn->unacked_len;
+	conn->sack_high_rxt = conn->seq;
+
+	(void)tcp_sack_retransmit(conn);
+
+	tcp_ca_fast_retransmit(conn);
+	if (tcp_window_full(conn)) {
+		(void)k_sem_take(&conn->tx_sem, K_NO_WAIT);
+	}
+}
+
+/* Loss recovery based on the scoreboard, called for every acknowledgement
+ * in the established state. Recovery is entered after DupThresh duplicate
+ * ACKs or as soon as the SACKed data shows that the first unacknowledged
+ * segment is lost. Otherwise a hole in the scoreboard arms the RACK timer
+ * with the reordering window, and outstanding data without holes arms it
+ * with the tail loss probe timeout. During recovery, each ACK clocks out the
+ * retransmission of the next hole, until all the data outstanding when
+ * entering it is acknowledged.
+ */
+static void tcp_sack_recover(struct tcp *conn)
+{
+	if (!tcp_sack_in_use(conn) || conn->data_mode != TCP_DATA_MODE_SEND ||
+	    conn->send_data_total == 0) {
+		return;
+	}
+
+	if (conn->sack_recovery) {
+		if (net_tcp_seq_cmp(conn->seq, conn->sack_recovery_point) < 0) {
+			(void)tcp_sack_retransmit(conn);
+			return;
+		}
+
+		conn->sack_recovery = false;
+	}
+
+	if (conn->dup_ack_cnt >= DUPLICATE_ACK_RETRANSMIT_TRHESHOLD ||
+	    (conn->sacked_cnt > 0 && tcp_sack_is_lost(conn, conn->seq))) {
+		tcp_sack_recovery_enter(conn);
+	} else if (conn->sacked_cnt > 0) {
+		/* The window starts when the hole first appears */
+		if (!conn->sack_reo_armed) {
+			k_work_reschedule_for_queue(&tcp_work_q,
+						    &conn->rack_timer,
+						    K_MSEC(TCP_RTO_MS / 4));
+			conn->sack_reo_armed = true;
+		}
+	} else if (conn->unacked_len > 0 && !conn->sack_tlp_sent) {
+		k_work_reschedule_for_queue(&tcp_work_q, &conn->rack_timer,
+					    K_MSEC(TCP_RTO_MS / 2));
+		conn->sack_reo_armed = false;
+	} else {
+		(void)k_work_cancel_delayable(&conn->rack_timer);
+		conn->sack_reo_armed = false;
+	}
+}
+
+/* Arm the tail loss probe when data is sent, so that it is also sent if
+ * the whole flight is lost and no ACK comes back at all.
+ */
+static void tcp_sack_arm_probe(struct tcp *conn)
+{
+	if (!tcp_sack_in_use(conn) || conn->data_mode != TCP_DATA_MODE_SEND ||
+	    conn->sack_recovery || conn->sack_reo_armed ||
+	    conn->sack_tlp_sent ||
+	    k_work_delayable_is_pending(&conn->rack_timer)) {
+		return;
+	}
+
+	k_work_reschedule_for_queue(&tcp_work_q, &conn->rack_timer,
+				    K_MSEC(TCP_RTO_MS / 2));
+}
+
+/* Send the last transmitted segment again as a tail loss probe. Its ACK
+ * either acknowledges everything or carries the SACK information needed to
+ * recover without a retransmission timeout.
+ */
+static void tcp_sack_send_probe(struct tcp *conn)
+{
+	int len = MIN(conn->unacked_len, conn_mss(conn));
+
+	if (tcp_send_segment(conn, conn->unacked_len - len, len) == 0) {
+		conn->sack_tlp_sent = true;
+		net_stats_update_tcp_resent(conn->iface, len);
+		net_stats_update_tcp_seg_rexmit(conn->iface);
+	}
+}
+
+/* Time based loss detection in the spirit of RACK-TLP (RFC 8985). A hole of
+ * the scoreboard that has not been filled within the reordering window is
+ * considered lost instead of waiting for DupThresh duplicate ACKs, which
+ * might never arrive with a small window. If the tail of the data is lost
+ * there are no ACKs at all, so probe for it before the retransmission
+ * timeout collapses the congestion window.
+ */
+static void tcp_sack_rack_timeout(struct k_work *work)
+{
+	struct k_work_delayable *dwork = k_work_delayable_from_work(work);
+	struct tcp *conn = CONTAINER_OF(dwork, struct tcp, rack_timer);
+
+	k_mutex_lock(&conn->lock, K_FOREVER);
+
+	conn->sack_reo_armed = false;
+
+	if (conn->state != TCP_ESTABLISHED || conn->sack_recovery ||
+	    conn->data_mode != TCP_DATA_MODE_SEND) {
+		goto out;
+	}
+
+	if (conn->sacked_cnt > 0) {
+		NET_DBG("conn: %p reordering window expired", conn);
+		tcp_sack_recovery_enter(conn);
+	} else if (conn->unacked_len > 0 && !conn->sack_tlp_sent) {
+		tcp_sack_send_probe(conn);
+	}
+
+out:
+	k_mutex_unlock(&conn->lock);
+}
+
+/* After a retransmission timeout the data is sent again from the first
+ * unacknowledged byte. The peer may also have discarded data it SACKed
+ * (RFC 2018), so forget the scoreboard.
+ */
+static void tcp_sack_reset(struct tcp *conn)
+{
+	conn->sacked_cnt = 0;
+	conn->sack_recovery = false;
+	conn->sack_reo_armed = false;
+	(void)k_work_cancel_delayable(&conn->rack_timer);
+}
+
+#else
+
+static inline bool tcp_sack_in_use(struct tcp *conn)
+{
+	ARG_UNUSED(conn);
+
+	return false;
+}
+
+static inline void tcp_sack_update(struct tcp *conn, struct tcphdr *th)
+{
+	ARG_UNUSED(conn);
+	ARG_UNUSED(th);
+}
+
+static inline void tcp_sack_recover(struct tcp *conn)
+{
+	ARG_UNUSED(conn);
+}
+
+static inline void tcp_sack_arm_probe(struct tcp *conn)
+{
+	ARG_UNUSED(conn);
+}
+
+static inline void tcp_sack_reset(struct tcp *conn)
+{
+	ARG_UNUSED(conn);
+}
+
+#endif /* CONFIG_NET_TCP_SACK */
+
 static void tcp_cleanup_recv_queue(struct k_work *work)
 {
 	struct k_work_delayable *dwork = k_work_delayable_from_work(work);
@@ -1884,6 +2501,7 @@ static void tcp_resend_data(struct k_work *work)
 
 	conn->data_mode = TCP_DATA_MODE_RESEND;
 	conn->unacked_len = 0;
+	tcp_sack_reset(conn);
 
 	ret = tcp_send_data(conn);
 	conn->send_data_retries++;
@@ -2155,6 +2773,9 @@ static struct tcp *tcp_conn_alloc(void)
 	k_work_init_delayable(&conn->recv_queue_timer, tcp_cleanup_recv_queue);
 	k_work_init_delayable(&conn->persist_timer, tcp_send_zwp);
 	k_work_init_delayable(&conn->ack_timer, tcp_send_ack);
+#if defined(CONFIG_NET_TCP_SACK)
+	k_work_init_delayable(&conn->rack_timer, tcp_sack_rack_timeout);
+#endif
 	k_work_init(&conn->conn_release, tcp_conn_release);
 	keep_alive_timer_init(conn);
 
@@ -2869,7 +3490,8 @@ static enum net_verdict tcp_in(struct tcp *conn, struct net_pkt *pkt)
 	}
 
 	if (tcp_options_len && !tcp_options_check(&conn->recv_options, pkt,
-						  tcp_options_len)) {
+						  tcp_options_len,
+						  th_flags(th) & SYN)) {
 		NET_DBG("DROP: Invalid TCP option list");
 		tcp_out(conn, RST);
 		do_close = true;
@@ -2927,6 +3549,9 @@ next_state:
 		if (FL(&fl, ==, SYN)) {
 			/* Make sure our MSS is also sent in the ACK */
 			conn->send_options.mss_found = true;
+#if defined(CONFIG_NET_TCP_SACK)
+			conn->sack_permitted = conn->recv_options.sack_perm_found;
+#endif
 			conn_ack(conn, th_seq(th) + 1); /* capture peer's isn */
 			tcp_out(conn, SYN | ACK);
 			conn->send_options.mss_found = false;
@@ -3053,6 +3678,9 @@ next_state:
 		if (FL(&fl, &, SYN | ACK, th && th_ack(th) == conn->seq)) {
 			tcp_send_timer_cancel(conn);
 			conn_ack(conn, th_seq(th) + 1);
+#if defined(CONFIG_NET_TCP_SACK)
+			conn->sack_permitted = conn->recv_options.sack_perm_found;
+#endif
 			if (len) {
 				verdict = tcp_data_get(conn, pkt, &len);
 				if (verdict == NET_OK) {
@@ -3135,6 +3763,10 @@ next_state:
 		 */
 		keep_alive_timer_restart(conn);
 
+		if (th) {
+			tcp_sack_update(conn, th);
+		}
+
 #ifdef CONFIG_NET_TCP_FAST_RETRANSMIT
 		if (th && (net_tcp_seq_cmp(th_ack(th), conn->seq) == 0)) {
 			/* Only if there is pending data, increment the duplicate ack count */
@@ -3153,8 +3785,11 @@ next_state:
 			}
 
 			/* Only do fast retransmit when not already in a resend state */
-			if ((conn->data_mode == TCP_DATA_MODE_SEND) &&
-			    (conn->dup_ack_cnt == DUPLICATE_ACK_RETRANSMIT_TRHESHOLD)) {
+			if (tcp_sack_in_use(conn)) {
+				/* Recover selectively using the scoreboard */
+				tcp_sack_recover(conn);
+			} else if ((conn->data_mode == TCP_DATA_MODE_SEND) &&
+				   (conn->dup_ack_cnt == DUPLICATE_ACK_RETRANSMIT_TRHESHOLD)) {
 				/* Apply a fast retransmit */
 				int temp_unacked_len = conn->unacked_len;
 
@@ -3234,6 +3869,9 @@ next_state:
 					    K_MSEC(TCP_RTO_MS));
 			}
 
+			/* Retransmit the next hole on a partial ACK */
+			tcp_sack_recover(conn);
+
 			/* We are closing the connection, send a FIN to peer */
 			if (conn->in_close && conn->send_data_total == 0) {
 				tcp_send_timer_cancel(conn);
@@ -3710,6 +4348,32 @@ int net_tcp_update_recv_wnd(struct net_context *context, int32_t delta)
 	return ret;
 }
 
+/* Send the data just appended to the send queue, called with the connection
+ * lock held.
+ */
+static int tcp_send_appended_data(struct tcp *conn, size_t len)
+{
+	int ret;
+
+	conn->send_data_total += len;
+
+	/* Successfully queued data for transmission. Even if there's a transmit
+	 * failure now (out-of-buf case), it can be ignored for now, retransmit
+	 * timer will take care of queued data retransmission.
+	 */
+	ret = tcp_send_queued_data(conn);
+	if (ret < 0 && ret != -ENOBUFS) {
+		tcp_conn_close(conn, ret);
+		return ret;
+	}
+
+	if (tcp_window_full(conn)) {
+		(void)k_sem_take(&conn->tx_sem, K_NO_WAIT);
+	}
+
+	return len;
+}
+
 int net_tcp_queue(struct net_context *context, const void *data, size_t len,
 		  const struct msghdr *msg)
 {
@@ -3778,28 +4442,60 @@ int net_tcp_queue(struct net_context *context, const void *data, size_t len,
 		queued_len = len;
 	}
 
-	conn->send_data_total += queued_len;
+	ret = tcp_send_appended_data(conn, queued_len);
+out:
+	k_mutex_unlock(&conn->lock);
 
-	/* Successfully queued data for transmission. Even if there's a transmit
-	 * failure now (out-of-buf case), it can be ignored for now, retransmit
-	 * timer will take care of queued data retransmission.
-	 */
-	ret = tcp_send_queued_data(conn);
-	if (ret < 0 && ret != -ENOBUFS) {
-		tcp_conn_close(conn, ret);
-		goto out;
+	return ret;
+}
+
+#if defined(CONFIG_NET_TCP_TX_ZEROCOPY)
+int net_tcp_queue_zc(struct net_context *context, const void *data, size_t len,
+		     net_tcp_zc_cb_t cb, void *user_data)
+{
+	struct tcp *conn = context->tcp;
+	struct tcp_zc_info *info;
+	struct net_buf *buf;
+	int ret;
+
+	if (!conn || conn->state != TCP_ESTABLISHED) {
+		return -ENOTCONN;
+	}
+
+	if (len == 0) {
+		return 0;
 	}
 
+	k_mutex_lock(&conn->lock, K_FOREVER);
+
 	if (tcp_window_full(conn)) {
-		(void)k_sem_take(&conn->tx_sem, K_NO_WAIT);
+		ret = -EAGAIN;
+		goto out;
+	}
+
+	len = MIN(conn->send_win - conn->send_data_total, len);
+
+	/* The stack never writes to the data, see tcp_pkt_pull() */
+	buf = net_buf_alloc_with_data(&tcp_zc_pool, (void *)data, len, K_NO_WAIT);
+	if (buf == NULL) {
+		ret = -ENOBUFS;
+		goto out;
 	}
 
-	ret = queued_len;
+	info = net_buf_user_data(buf);
+	info->cb = cb;
+	info->user_data = user_data;
+	info->parent = NULL;
+
+	net_pkt_append_buffer(conn->send_data, buf);
+
+	ret = tcp_send_appended_data(conn, len);
 out:
 	k_mutex_unlock(&conn->lock);
 
 	return ret;
 }
+#endif /* CONFIG_NET_TCP_TX_ZEROCOPY */
 
 /* net context is about to send out queued data - inform caller only */
 int net_tcp_send_data(struct net_context *context, net_context_send_cb_t cb,
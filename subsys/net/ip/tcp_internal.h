@@ -312,6 +312,47 @@ static inline int net_tcp_queue(struct net_context *context, const void *data,
 }
 #endif
 
+/**
+ * @typedef net_tcp_zc_cb_t
+ * @brief Called once the stack no longer uses data queued without copying it
+ *
+ * @param user_data The user data given to net_tcp_queue_zc()
+ */
+typedef void (*net_tcp_zc_cb_t)(void *user_data);
+
+/**
+ * @brief Enqueue data for transmission without copying it
+ *
+ * The data is referenced until it has been acknowledged by the peer, or
+ * the connection is closed, after which @p cb is called. It is not called
+ * if no data could be queued.
+ *
+ * @param context	Network context
+ * @param data		Pointer to the data
+ * @param len		Number of bytes
+ * @param cb		Callback to call once the data is no longer used
+ * @param user_data	User data given to @p cb
+ *
+ * @return Number of bytes queued, or < 0 if error
+ */
+#if defined(CONFIG_NET_TCP_TX_ZEROCOPY)
+int net_tcp_queue_zc(struct net_context *context, const void *data, size_t len,
+		     net_tcp_zc_cb_t cb, void *user_data);
+#else
+static inline int net_tcp_queue_zc(struct net_context *context,
+				   const void *data, size_t len,
+				   net_tcp_zc_cb_t cb, void *user_data)
+{
+	ARG_UNUSED(context);
+	ARG_UNUSED(data);
+	ARG_UNUSED(len);
+	ARG_UNUSED(cb);
+	ARG_UNUSED(user_data);
+
+	return -EPROTONOSUPPORT;
+}
+#endif
+
 /**
  * @brief Update TCP receive window
  *
@@ -227,16 +227,35 @@ union tcp_endpoint {
 #define NET_TCP_NOP_OPT          1
 #define NET_TCP_MSS_OPT          2
 #define NET_TCP_WINDOW_SCALE_OPT 3
+#define NET_TCP_SACK_PERM_OPT    4
+#define NET_TCP_SACK_OPT         5
 
 /* TCP Option sizes */
 #define NET_TCP_END_SIZE          1
 #define NET_TCP_NOP_SIZE          1
 #define NET_TCP_MSS_SIZE          4
 #define NET_TCP_WINDOW_SCALE_SIZE 3
+#define NET_TCP_SACK_PERM_SIZE    2
+#define NET_TCP_SACK_BLOCK_SIZE   8
+
+/* Number of SACK blocks that fit into the 40 bytes of TCP options */
+#define NET_TCP_SACK_MAX_BLOCKS   4
+
+#if defined(CONFIG_NET_TCP_SACK)
+struct tcp_sack_block {
+	uint32_t start;
+	uint32_t end;
+};
+#endif
 
 struct tcp_options {
 	uint16_t mss;
 	uint16_t window;
+#if defined(CONFIG_NET_TCP_SACK)
+	struct tcp_sack_block sack[NET_TCP_SACK_MAX_BLOCKS];
+	uint8_t sack_cnt;
+	bool sack_perm_found : 1;
+#endif
 	bool mss_found : 1;
 	bool wnd_found : 1;
 };
@@ -282,6 +301,9 @@ struct tcp { /* TCP connection */
 	struct k_work_delayable timewait_timer;
 	struct k_work_delayable persist_timer;
 	struct k_work_delayable ack_timer;
+#if defined(CONFIG_NET_TCP_SACK)
+	struct k_work_delayable rack_timer;
+#endif
 #if defined(CONFIG_NET_TCP_KEEPALIVE)
 	struct k_work_delayable keepalive_timer;
 #endif /* CONFIG_NET_TCP_KEEPALIVE */
@@ -328,6 +350,17 @@ struct tcp { /* TCP connection */
 	uint8_t send_data_retries;
 #ifdef CONFIG_NET_TCP_FAST_RETRANSMIT
 	uint8_t dup_ack_cnt;
+#endif
+#if defined(CONFIG_NET_TCP_SACK)
+	/* Scoreboard of the data SACKed by the peer, sorted by sequence */
+	struct tcp_sack_block sacked[NET_TCP_SACK_MAX_BLOCKS];
+	uint32_t sack_recovery_point;
+	uint32_t sack_high_rxt;
+	uint8_t sacked_cnt;
+	bool sack_permitted : 1;
+	bool sack_recovery : 1;
+	bool sack_reo_armed : 1;
+	bool sack_tlp_sent : 1;
 #endif
 	uint8_t zwp_retries;
 	bool in_retransmission : 1;
@@ -14,6 +14,7 @@ LOG_MODULE_REGISTER(net_sock, CONFIG_NET_SOCKETS_LOG_LEVEL);
 #include <zephyr/tracing/tracing.h>
 #include <zephyr/net/socket.h>
 #include <zephyr/internal/syscall_handler.h>
+#include <zephyr/sys/math_extras.h>
 
 #include "sockets_internal.h"
 
@@ -474,6 +475,216 @@ fail:
 #include <zephyr/syscalls/zsock_sendmsg_mrsh.c>
 #endif /* CONFIG_USERSPACE */
 
+int z_impl_zsock_sendmmsg(int sock, struct mmsghdr *msgvec, unsigned int vlen,
+			  int flags)
+{
+	const struct socket_op_vtable *vtable;
+	struct k_mutex *lock;
+	unsigned int count = 0U;
+	ssize_t bytes_sent;
+	void *obj;
+
+	obj = get_sock_vtable(sock, &vtable, &lock);
+	if (obj == NULL) {
+		errno = EBADF;
+		return -1;
+	}
+
+	if (vtable->sendmsg == NULL) {
+		errno = EOPNOTSUPP;
+		return -1;
+	}
+
+	(void)k_mutex_lock(lock, K_FOREVER);
+
+	while (count < vlen) {
+		SYS_PORT_TRACING_OBJ_FUNC_ENTER(socket, sendmsg, sock,
+						&msgvec[count].msg_hdr, flags);
+
+		bytes_sent = vtable->sendmsg(obj, &msgvec[count].msg_hdr, flags);
+
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(socket, sendmsg, sock,
+					       bytes_sent < 0 ? -errno : bytes_sent);
+
+		sock_obj_core_update_send_stats(sock, bytes_sent);
+
+		if (bytes_sent < 0) {
+			break;
+		}
+
+		msgvec[count].msg_len = bytes_sent;
+		count++;
+	}
+
+	k_mutex_unlock(lock);
+
+	if (count == 0U && vlen > 0U) {
+		return -1;
+	}
+
+	return count;
+}
+
+#ifdef CONFIG_USERSPACE
+/* Free the buffers of a message copied by mmsg_copy_from_user() */
+static void mmsg_free_copy(struct msghdr *msg, size_t iovlen)
+{
+	k_free(msg->msg_name);
+	k_free(msg->msg_control);
+
+	if (msg->msg_iov != NULL) {
+		for (size_t i = 0; i < iovlen; i++) {
+			k_free(msg->msg_iov[i].iov_base);
+		}
+
+		k_free(msg->msg_iov);
+	}
+}
+
+/*
+ * Replace the user buffers of a message header copied from user mode by
+ * kernel copies of them, as zsock_sendmsg() and zsock_recvmsg() do. The
+ * number of buffers to free is returned in iovlen, even on failure.
+ */
+static int mmsg_copy_from_user(struct msghdr *msg, size_t *iovlen)
+{
+	struct iovec *iov = msg->msg_iov;
+	void *name = msg->msg_name;
+	void *control = msg->msg_control;
+	size_t size;
+
+	msg->msg_iov = NULL;
+	msg->msg_name = NULL;
+	msg->msg_control = NULL;
+	*iovlen = 0;
+
+	if (((msg->msg_iovlen > 0) && (iov == NULL)) ||
+	    size_mul_overflow(msg->msg_iovlen, sizeof(struct iovec), &size) ||
+	    ((msg->msg_namelen > 0) && (name == NULL)) ||
+	    ((msg->msg_controllen > 0) && (control == NULL))) {
+		errno = EINVAL;
+		return -1;
+	}
+
+	if (msg->msg_iovlen > 0) {
+		msg->msg_iov = k_usermode_alloc_from_copy(iov, size);
+		if (msg->msg_iov == NULL) {
+			errno = ENOMEM;
+			return -1;
+		}
+	}
+
+	while (*iovlen < msg->msg_iovlen) {
+		iov = &msg->msg_iov[*iovlen];
+		iov->iov_base = k_usermode_alloc_from_copy(iov->iov_base,
+							   iov->iov_len);
+		if (iov->iov_base == NULL) {
+			errno = ENOMEM;
+			return -1;
+		}
+
+		(*iovlen)++;
+	}
+
+	if (msg->msg_namelen > 0) {
+		msg->msg_name = k_usermode_alloc_from_copy(name, msg->msg_namelen);
+		if (msg->msg_name == NULL) {
+			errno = ENOMEM;
+			return -1;
+		}
+	}
+
+	if (msg->msg_controllen > 0) {
+		msg->msg_control = k_usermode_alloc_from_copy(control,
+							      msg->msg_controllen);
+		if (msg->msg_control == NULL) {
+			errno = ENOMEM;
+			return -1;
+		}
+	}
+
+	return 0;
+}
+
+/*
+ * Copy the user mode messages, so that they can all be handled with one
+ * socket lookup and lock. Returns the kernel copies, or NULL with errno set,
+ * with the number of buffers of each message to free in iovlens.
+ */
+static struct mmsghdr *mmsg_vec_copy_from_user(struct mmsghdr *msgvec,
+					       unsigned int vlen, size_t *iovlens)
+{
+	struct mmsghdr *msgvec_copy;
+	unsigned int i;
+
+	K_OOPS(K_SYSCALL_MEMORY_ARRAY_WRITE(msgvec, vlen, sizeof(*msgvec)));
+
+	msgvec_copy = k_usermode_alloc_from_copy(msgvec, vlen * sizeof(*msgvec));
+	if (msgvec_copy == NULL) {
+		errno = ENOMEM;
+		return NULL;
+	}
+
+	for (i = 0; i < vlen; i++) {
+		if (mmsg_copy_from_user(&msgvec_copy[i].msg_hdr, &iovlens[i]) < 0) {
+			break;
+		}
+	}
+
+	if (i < vlen) {
+		/* Messages after the failed one still point to user buffers */
+		for (unsigned int j = 0; j <= i; j++) {
+			mmsg_free_copy(&msgvec_copy[j].msg_hdr, iovlens[j]);
+		}
+
+		k_free(msgvec_copy);
+		return NULL;
+	}
+
+	return msgvec_copy;
+}
+
+static void mmsg_vec_free_copy(struct mmsghdr *msgvec_copy, unsigned int vlen,
+			       const size_t *iovlens)
+{
+	for (unsigned int i = 0; i < vlen; i++) {
+		mmsg_free_copy(&msgvec_copy[i].msg_hdr, iovlens[i]);
+	}
+
+	k_free(msgvec_copy);
+}
+
+static inline int z_vrfy_zsock_sendmmsg(int sock, struct mmsghdr *msgvec,
+					unsigned int vlen, int flags)
+{
+	size_t iovlens[CONFIG_NET_SOCKETS_MMSG_USER_MAX];
+	struct mmsghdr *msgvec_copy;
+	int ret;
+
+	vlen = MIN(vlen, CONFIG_NET_SOCKETS_MMSG_USER_MAX);
+	if (vlen == 0U) {
+		return 0;
+	}
+
+	msgvec_copy = mmsg_vec_copy_from_user(msgvec, vlen, iovlens);
+	if (msgvec_copy == NULL) {
+		return -1;
+	}
+
+	ret = z_impl_zsock_sendmmsg(sock, msgvec_copy, vlen, flags);
+
+	for (int i = 0; i < ret; i++) {
+		K_OOPS(k_usermode_to_copy(&msgvec[i].msg_len, &msgvec_copy[i].msg_len,
+					  sizeof(msgvec[i].msg_len)));
+	}
+
+	mmsg_vec_free_copy(msgvec_copy, vlen, iovlens);
+
+	return ret;
+}
+#include <zephyr/syscalls/zsock_sendmmsg_mrsh.c>
+#endif /* CONFIG_USERSPACE */
+
 ssize_t z_impl_zsock_recvfrom(int sock, void *buf, size_t max_len, int flags,
 			     struct sockaddr *src_addr, socklen_t *addrlen)
 {
@@ -710,6 +921,242 @@ fail:
 #include <zephyr/syscalls/zsock_recvmsg_mrsh.c>
 #endif /* CONFIG_USERSPACE */
 
+static inline k_timepoint_t recvmmsg_timepoint(const struct timespec *timeout)
+{
+	if (timeout == NULL) {
+		return sys_timepoint_calc(K_FOREVER);
+	}
+
+	return sys_timepoint_calc(K_USEC(timeout->tv_sec * USEC_PER_SEC +
+					 timeout->tv_nsec / NSEC_PER_USEC));
+}
+
+int z_impl_zsock_recvmmsg(int sock, struct mmsghdr *msgvec, unsigned int vlen,
+			  int flags, struct timespec *timeout)
+{
+	const struct socket_op_vtable *vtable;
+	k_timepoint_t end = recvmmsg_timepoint(timeout);
+	struct k_mutex *lock;
+	unsigned int count = 0U;
+	ssize_t bytes_received;
+	void *obj;
+
+	obj = get_sock_vtable(sock, &vtable, &lock);
+	if (obj == NULL) {
+		errno = EBADF;
+		return -1;
+	}
+
+	if (vtable->recvmsg == NULL) {
+		errno = EOPNOTSUPP;
+		return -1;
+	}
+
+	(void)k_mutex_lock(lock, K_FOREVER);
+
+	while (count < vlen) {
+		SYS_PORT_TRACING_OBJ_FUNC_ENTER(socket, recvmsg, sock,
+						&msgvec[count].msg_hdr,
+						flags & ~ZSOCK_MSG_WAITFORONE);
+
+		bytes_received = vtable->recvmsg(obj, &msgvec[count].msg_hdr,
+						 flags & ~ZSOCK_MSG_WAITFORONE);
+
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(socket, recvmsg, sock,
+					       &msgvec[count].msg_hdr,
+					       bytes_received < 0 ? -errno : bytes_received);
+
+		sock_obj_core_update_recv_stats(sock, bytes_received);
+
+		if (bytes_received < 0) {
+			break;
+		}
+
+		msgvec[count].msg_len = bytes_received;
+		count++;
+
+		if (flags & ZSOCK_MSG_WAITFORONE) {
+			flags |= ZSOCK_MSG_DONTWAIT;
+		}
+
+		if (sys_timepoint_expired(end)) {
+			break;
+		}
+	}
+
+	k_mutex_unlock(lock);
+
+	if (count == 0U && vlen > 0U) {
+		return -1;
+	}
+
+	return count;
+}
+
+#ifdef CONFIG_USERSPACE
+/* Copy a received message back to user mode, as zsock_recvmsg() does */
+static void mmsg_copy_to_user(struct mmsghdr *msg, const struct mmsghdr *msg_copy,
+			      size_t iovlen)
+{
+	const struct msghdr *hdr = &msg_copy->msg_hdr;
+	struct msghdr user_hdr;
+	struct iovec user_iov;
+	size_t zero = 0;
+
+	K_OOPS(k_usermode_from_copy(&user_hdr, &msg->msg_hdr, sizeof(user_hdr)));
+
+	if ((hdr->msg_name != NULL) && (user_hdr.msg_name != NULL)) {
+		K_OOPS(k_usermode_to_copy(user_hdr.msg_name, hdr->msg_name,
+					  MIN(hdr->msg_namelen, user_hdr.msg_namelen)));
+		K_OOPS(k_usermode_to_copy(&msg->msg_hdr.msg_namelen, &hdr->msg_namelen,
+					  sizeof(hdr->msg_namelen)));
+	}
+
+	if ((hdr->msg_control != NULL) && (user_hdr.msg_control != NULL)) {
+		K_OOPS(k_usermode_to_copy(user_hdr.msg_control, hdr->msg_control,
+					  MIN(hdr->msg_controllen,
+					      user_hdr.msg_controllen)));
+		K_OOPS(k_usermode_to_copy(&msg->msg_hdr.msg_controllen,
+					  &hdr->msg_controllen,
+					  sizeof(hdr->msg_controllen)));
+	} else {
+		K_OOPS(k_usermode_to_copy(&msg->msg_hdr.msg_controllen, &zero,
+					  sizeof(msg->msg_hdr.msg_controllen)));
+	}
+
+	/* The new iovlen cannot be bigger than the original one */
+	NET_ASSERT(hdr->msg_iovlen <= iovlen);
+
+	K_OOPS(k_usermode_to_copy(&msg->msg_hdr.msg_iovlen, &hdr->msg_iovlen,
+				  sizeof(hdr->msg_iovlen)));
+
+	for (size_t i = 0; i < MIN(iovlen, user_hdr.msg_iovlen); i++) {
+		K_OOPS(k_usermode_from_copy(&user_iov, &user_hdr.msg_iov[i],
+					    sizeof(user_iov)));
+
+		if (i < hdr->msg_iovlen) {
+			K_OOPS(k_usermode_to_copy(user_iov.iov_base,
+						  hdr->msg_iov[i].iov_base,
+						  MIN(hdr->msg_iov[i].iov_len,
+						      user_iov.iov_len)));
+			user_iov.iov_len = hdr->msg_iov[i].iov_len;
+		} else {
+			/* Clear out those vectors that we could not populate */
+			user_iov.iov_len = 0;
+		}
+
+		K_OOPS(k_usermode_to_copy(&user_hdr.msg_iov[i].iov_len,
+					  &user_iov.iov_len, sizeof(user_iov.iov_len)));
+	}
+
+	K_OOPS(k_usermode_to_copy(&msg->msg_hdr.msg_flags, &hdr->msg_flags,
+				  sizeof(hdr->msg_flags)));
+	K_OOPS(k_usermode_to_copy(&msg->msg_len, &msg_copy->msg_len,
+				  sizeof(msg->msg_len)));
+}
+
+static inline int z_vrfy_zsock_recvmmsg(int sock, struct mmsghdr *msgvec,
+					unsigned int vlen, int flags,
+					struct timespec *timeout)
+{
+	size_t iovlens[CONFIG_NET_SOCKETS_MMSG_USER_MAX];
+	struct timespec timeout_copy;
+	struct mmsghdr *msgvec_copy;
+	int ret;
+
+	if (timeout != NULL) {
+		K_OOPS(k_usermode_from_copy(&timeout_copy, timeout,
+					    sizeof(timeout_copy)));
+	}
+
+	vlen = MIN(vlen, CONFIG_NET_SOCKETS_MMSG_USER_MAX);
+	if (vlen == 0U) {
+		return 0;
+	}
+
+	msgvec_copy = mmsg_vec_copy_from_user(msgvec, vlen, iovlens);
+	if (msgvec_copy == NULL) {
+		return -1;
+	}
+
+	ret = z_impl_zsock_recvmmsg(sock, msgvec_copy, vlen, flags,
+				    timeout != NULL ? &timeout_copy : NULL);
+
+	for (int i = 0; i < ret; i++) {
+		mmsg_copy_to_user(&msgvec[i], &msgvec_copy[i], iovlens[i]);
+	}
+
+	mmsg_vec_free_copy(msgvec_copy, vlen, iovlens);
+
+	return ret;
+}
+#include <zephyr/syscalls/zsock_recvmmsg_mrsh.c>
+#endif /* CONFIG_USERSPACE */
+
+#if defined(CONFIG_NET_SOCKETS_RECV_ZEROCOPY)
+ssize_t zsock_recv_zc(int sock, struct net_buf **frags, int flags,
+		      struct sockaddr *src_addr, socklen_t *addrlen)
+{
+	const struct socket_op_vtable *vtable;
+	struct k_mutex *lock;
+	ssize_t ret;
+	void *obj;
+
+	obj = get_sock_vtable(sock, &vtable, &lock);
+	if (obj == NULL) {
+		errno = EBADF;
+		return -1;
+	}
+
+	if (vtable->recv_zc == NULL) {
+		errno = EOPNOTSUPP;
+		return -1;
+	}
+
+	(void)k_mutex_lock(lock, K_FOREVER);
+
+	ret = vtable->recv_zc(obj, frags, flags, src_addr, addrlen);
+
+	k_mutex_unlock(lock);
+
+	sock_obj_core_update_recv_stats(sock, ret);
+
+	return ret;
+}
+#endif /* CONFIG_NET_SOCKETS_RECV_ZEROCOPY */
+
+#if defined(CONFIG_NET_TCP_TX_ZEROCOPY)
+ssize_t zsock_send_zc(int sock, const void *buf, size_t len, int flags,
+		      zsock_send_zc_cb_t cb, void *user_data)
+{
+	const struct socket_op_vtable *vtable;
+	struct k_mutex *lock;
+	ssize_t ret;
+	void *obj;
+
+	obj = get_sock_vtable(sock, &vtable, &lock);
+	if (obj == NULL) {
+		errno = EBADF;
+		return -1;
+	}
+
+	if (vtable->send_zc == NULL) {
+		errno = EOPNOTSUPP;
+		return -1;
+	}
+
+	(void)k_mutex_lock(lock, K_FOREVER);
+
+	ret = vtable->send_zc(obj, buf, len, flags, cb, user_data);
+
+	k_mutex_unlock(lock);
+
+	sock_obj_core_update_send_stats(sock, ret);
+
+	return ret;
+}
+#endif /* CONFIG_NET_TCP_TX_ZEROCOPY */
+
 /* As this is limited function, we don't follow POSIX signature, with
  * "..." instead of last arg.
  */
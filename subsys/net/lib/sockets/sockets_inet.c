@@ -689,6 +689,53 @@ ssize_t zsock_sendmsg_ctx(struct net_context *ctx, const struct msghdr *msg,
 	return status;
 }
 
+#if defined(CONFIG_NET_TCP_TX_ZEROCOPY)
+static ssize_t zsock_send_zc_ctx(struct net_context *ctx, const void *buf,
+				 size_t len, int flags, zsock_send_zc_cb_t cb,
+				 void *user_data)
+{
+	k_timeout_t timeout = K_FOREVER;
+	uint32_t retry_timeout = WAIT_BUFS_INITIAL_MS;
+	k_timepoint_t buf_timeout, end;
+	int status;
+
+	if (net_context_get_type(ctx) != SOCK_STREAM ||
+	    net_if_is_ip_offloaded(net_context_get_iface(ctx))) {
+		errno = EOPNOTSUPP;
+		return -1;
+	}
+
+	if ((flags & ZSOCK_MSG_DONTWAIT) || sock_is_nonblock(ctx)) {
+		timeout = K_NO_WAIT;
+		buf_timeout = sys_timepoint_calc(K_NO_WAIT);
+	} else {
+		net_context_get_option(ctx, NET_OPT_SNDTIMEO, &timeout, NULL);
+		buf_timeout = sys_timepoint_calc(MAX_WAIT_BUFS);
+	}
+	end = sys_timepoint_calc(timeout);
+
+	while (1) {
+		status = net_tcp_queue_zc(ctx, buf, len, cb, user_data);
+		if (status < 0) {
+			status = send_check_and_wait(ctx, status, buf_timeout,
+						     timeout, &retry_timeout);
+			if (status < 0) {
+				return status;
+			}
+
+			/* Update the timeout value in case loop is repeated. */
+			timeout = sys_timepoint_timeout(end);
+
+			continue;
+		}
+
+		break;
+	}
+
+	return status;
+}
+#endif /* CONFIG_NET_TCP_TX_ZEROCOPY */
+
 static int sock_get_pkt_src_addr(struct net_pkt *pkt,
 				 enum net_ip_protocol proto,
 				 struct sockaddr *addr,
@@ -1047,6 +1094,42 @@ static int update_msg_controllen(struct msghdr *msg)
 	return 0;
 }
 
+static int zsock_get_src_addr(struct net_context *ctx, struct net_pkt *pkt,
+			      struct sockaddr *src_addr, socklen_t *addrlen)
+{
+	int ret;
+
+	if (IS_ENABLED(CONFIG_NET_OFFLOAD) &&
+	    net_if_is_ip_offloaded(net_context_get_iface(ctx))) {
+		ret = sock_get_offload_pkt_src_addr(pkt, ctx, src_addr,
+						    *addrlen);
+		if (ret < 0) {
+			NET_DBG("sock_get_offload_pkt_src_addr %d", ret);
+			return ret;
+		}
+	} else {
+		ret = sock_get_pkt_src_addr(pkt, net_context_get_proto(ctx),
+					    src_addr, *addrlen);
+		if (ret < 0) {
+			NET_DBG("sock_get_pkt_src_addr %d", ret);
+			return ret;
+		}
+	}
+
+	/* addrlen is a value-result argument, set to actual
+	 * size of source address
+	 */
+	if (src_addr->sa_family == AF_INET) {
+		*addrlen = sizeof(struct sockaddr_in);
+	} else if (src_addr->sa_family == AF_INET6) {
+		*addrlen = sizeof(struct sockaddr_in6);
+	} else {
+		return -ENOTSUP;
+	}
+
+	return 0;
+}
+
 static inline ssize_t zsock_recv_dgram(struct net_context *ctx,
 				       struct msghdr *msg,
 				       void *buf,
@@ -1098,38 +1181,11 @@ static inline ssize_t zsock_recv_dgram(struct net_context *ctx,
 	net_pkt_cursor_backup(pkt, &backup);
 
 	if (src_addr && addrlen) {
-		if (IS_ENABLED(CONFIG_NET_OFFLOAD) &&
-		    net_if_is_ip_offloaded(net_context_get_iface(ctx))) {
-			int ret;
-
-			ret  = sock_get_offload_pkt_src_addr(pkt, ctx, src_addr,
-								*addrlen);
-			if (ret < 0) {
-				errno = -ret;
-				NET_DBG("sock_get_offload_pkt_src_addr %d", ret);
-				goto fail;
-			}
-		} else {
-			int ret;
-
-			ret = sock_get_pkt_src_addr(pkt, net_context_get_proto(ctx),
-						   src_addr, *addrlen);
-			if (ret < 0) {
-				errno = -ret;
-				NET_DBG("sock_get_pkt_src_addr %d", ret);
-				goto fail;
-			}
-		}
+		int ret;
 
-		/* addrlen is a value-result argument, set to actual
-		 * size of source address
-		 */
-		if (src_addr->sa_family == AF_INET) {
-			*addrlen = sizeof(struct sockaddr_in);
-		} else if (src_addr->sa_family == AF_INET6) {
-			*addrlen = sizeof(struct sockaddr_in6);
-		} else {
-			errno = ENOTSUP;
+		ret = zsock_get_src_addr(ctx, pkt, src_addr, addrlen);
+		if (ret < 0) {
+			errno = -ret;
 			goto fail;
 		}
 	}
@@ -1509,6 +1565,179 @@ ssize_t zsock_recvmsg_ctx(struct net_context *ctx, struct msghdr *msg,
 	return -1;
 }
 
+#if defined(CONFIG_NET_SOCKETS_RECV_ZEROCOPY)
+/* Take the unread data of the packet, from its cursor on, out of it.
+ * The fragments holding the headers are released, and the packet is left
+ * without any buffer.
+ */
+static struct net_buf *zsock_pkt_detach_data(struct net_pkt *pkt)
+{
+	struct net_buf *buf = pkt->cursor.buf;
+	size_t offset = pkt->cursor.pos - buf->data;
+	struct net_buf *prev;
+
+	while (offset == buf->len) {
+		buf = buf->frags;
+		offset = 0;
+	}
+
+	if (buf != pkt->buffer) {
+		for (prev = pkt->buffer; prev->frags != buf; prev = prev->frags) {
+		}
+
+		prev->frags = NULL;
+		net_pkt_frag_unref(pkt->buffer);
+	}
+
+	pkt->buffer = NULL;
+	net_pkt_cursor_init(pkt);
+
+	net_buf_pull(buf, offset);
+
+	return buf;
+}
+
+static bool zsock_pkt_data_is_shared(struct net_pkt *pkt)
+{
+	for (struct net_buf *buf = pkt->buffer; buf != NULL; buf = buf->frags) {
+		if (buf->ref > 1) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+static ssize_t zsock_recv_zc_ctx(struct net_context *ctx,
+				 struct net_buf **frags, int flags,
+				 struct sockaddr *src_addr, socklen_t *addrlen)
+{
+	enum net_sock_type sock_type = net_context_get_type(ctx);
+	k_timeout_t timeout = K_FOREVER;
+	struct net_pkt *pkt;
+	k_timepoint_t end;
+	size_t len;
+	int ret;
+
+	if (frags == NULL || (flags & (ZSOCK_MSG_PEEK | ZSOCK_MSG_TRUNC))) {
+		errno = EINVAL;
+		return -1;
+	}
+
+	*frags = NULL;
+
+	if (sock_type == SOCK_STREAM) {
+		if (!net_context_is_used(ctx)) {
+			errno = EBADF;
+			return -1;
+		}
+
+		if (net_context_get_state(ctx) != NET_CONTEXT_CONNECTED) {
+			errno = ENOTCONN;
+			return -1;
+		}
+	} else if (sock_type != SOCK_DGRAM) {
+		errno = ENOTSUP;
+		return -1;
+	}
+
+	if ((flags & ZSOCK_MSG_DONTWAIT) || sock_is_nonblock(ctx)) {
+		timeout = K_NO_WAIT;
+	} else {
+		net_context_get_option(ctx, NET_OPT_RCVTIMEO, &timeout, NULL);
+	}
+
+	for (end = sys_timepoint_calc(timeout); ; timeout = sys_timepoint_timeout(end)) {
+		if (sock_type == SOCK_STREAM) {
+			if (sock_is_error(ctx)) {
+				errno = POINTER_TO_INT(ctx->user_data);
+				return -1;
+			}
+
+			if (sock_is_eof(ctx)) {
+				return 0;
+			}
+		}
+
+		if (!K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+			ret = zsock_wait_data(ctx, &timeout);
+			if (ret < 0) {
+				errno = -ret;
+				return -1;
+			}
+		}
+
+		pkt = k_fifo_get(&ctx->recv_q, K_NO_WAIT);
+		if (pkt == NULL) {
+			if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+				errno = EAGAIN;
+				return -1;
+			}
+
+			continue;
+		}
+
+		if (sock_type == SOCK_DGRAM) {
+			break;
+		}
+
+		if (net_pkt_eof(pkt)) {
+			sock_set_eof(ctx);
+		}
+
+		if (net_pkt_remaining_data(pkt) > 0) {
+			break;
+		}
+
+		/* Nothing to hand over, e.g. the end of stream marker */
+		net_pkt_unref(pkt);
+	}
+
+	if (src_addr != NULL && addrlen != NULL) {
+		ret = zsock_get_src_addr(ctx, pkt, src_addr, addrlen);
+		if (ret < 0) {
+			net_pkt_unref(pkt);
+			errno = -ret;
+			return -1;
+		}
+	}
+
+	if (IS_ENABLED(CONFIG_NET_PKT_RXTIME_STATS) ||
+	    IS_ENABLED(CONFIG_TRACING_NET_CORE)) {
+		net_socket_update_tc_rx_time(pkt, k_cycle_get_32());
+	}
+
+	len = net_pkt_remaining_data(pkt);
+	if (len > 0) {
+		/* Fragments shared with another packet, for instance one being
+		 * forwarded, cannot be handed over, so lend a copy of them.
+		 */
+		if (zsock_pkt_data_is_shared(pkt)) {
+			struct net_pkt *clone = net_pkt_rx_clone(pkt, K_NO_WAIT);
+
+			net_pkt_unref(pkt);
+
+			if (clone == NULL) {
+				errno = ENOBUFS;
+				return -1;
+			}
+
+			pkt = clone;
+		}
+
+		*frags = zsock_pkt_detach_data(pkt);
+	}
+
+	net_pkt_unref(pkt);
+
+	if (sock_type == SOCK_STREAM) {
+		net_context_update_recv_wnd(ctx, len);
+	}
+
+	return len;
+}
+#endif /* CONFIG_NET_SOCKETS_RECV_ZEROCOPY */
+
 static int zsock_poll_prepare_ctx(struct net_context *ctx,
 				  struct zsock_pollfd *pfd,
 				  struct k_poll_event **pev,
@@ -2982,6 +3211,23 @@ static ssize_t sock_recvfrom_vmeth(void *obj, void *buf, size_t max_len,
 				  src_addr, addrlen);
 }
 
+#if defined(CONFIG_NET_SOCKETS_RECV_ZEROCOPY)
+static ssize_t sock_recv_zc_vmeth(void *obj, struct net_buf **frags, int flags,
+				  struct sockaddr *src_addr, socklen_t *addrlen)
+{
+	return zsock_recv_zc_ctx(obj, frags, flags, src_addr, addrlen);
+}
+#endif
+
+#if defined(CONFIG_NET_TCP_TX_ZEROCOPY)
+static ssize_t sock_send_zc_vmeth(void *obj, const void *buf, size_t len,
+				  int flags, zsock_send_zc_cb_t cb,
+				  void *user_data)
+{
+	return zsock_send_zc_ctx(obj, buf, len, flags, cb, user_data);
+}
+#endif
+
 static int sock_getsockopt_vmeth(void *obj, int level, int optname,
 				 void *optval, socklen_t *optlen)
 {
@@ -3030,6 +3276,12 @@ const struct socket_op_vtable sock_fd_op_vtable = {
 	.setsockopt = sock_setsockopt_vmeth,
 	.getpeername = sock_getpeername_vmeth,
 	.getsockname = sock_getsockname_vmeth,
+#if defined(CONFIG_NET_SOCKETS_RECV_ZEROCOPY)
+	.recv_zc = sock_recv_zc_vmeth,
+#endif
+#if defined(CONFIG_NET_TCP_TX_ZEROCOPY)
+	.send_zc = sock_send_zc_vmeth,
+#endif
 };
 
 static bool inet_is_supported(int family, int type, int proto)
@@ -75,6 +75,10 @@ struct socket_op_vtable {
 			   socklen_t *addrlen);
 	int (*getsockname)(void *obj, struct sockaddr *addr,
 			   socklen_t *addrlen);
+	ssize_t (*recv_zc)(void *obj, struct net_buf **frags, int flags,
+			   struct sockaddr *src_addr, socklen_t *addrlen);
+	ssize_t (*send_zc)(void *obj, const void *buf, size_t len, int flags,
+			   zsock_send_zc_cb_t cb, void *user_data);
 };
 
 size_t msghdr_non_empty_iov_count(const struct msghdr *msg);
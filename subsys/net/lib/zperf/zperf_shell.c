@@ -324,14 +324,19 @@ static void udp_session_cb(enum zperf_status status,
 
 	case ZPERF_SESSION_FINISHED: {
 		uint32_t rate_in_kbps;
+		uint32_t rate_in_pps;
 
 		/* Compute baud rate */
 		if (result->time_in_us != 0U) {
 			rate_in_kbps = (uint32_t)
 				((result->total_len * 8ULL * USEC_PER_SEC) /
 				 (result->time_in_us * 1000ULL));
+			rate_in_pps = (uint32_t)
+				(((uint64_t)result->nb_packets_rcvd * USEC_PER_SEC) /
+				 result->time_in_us);
 		} else {
 			rate_in_kbps = 0U;
+			rate_in_pps = 0U;
 		}
 
 		shell_fprintf(sh, SHELL_NORMAL, "End of session!\n");
@@ -355,6 +360,9 @@ static void udp_session_cb(enum zperf_status status,
 		print_number(sh, rate_in_kbps, KBPS, KBPS_UNIT);
 		shell_fprintf(sh, SHELL_NORMAL, "\n");
 
+		shell_fprintf(sh, SHELL_NORMAL, " packet rate:\t\t%u pps\n",
+			      rate_in_pps);
+
 		break;
 	}
 
@@ -480,6 +488,7 @@ static void shell_udp_upload_print_stats(const struct shell *sh,
 {
 	if (IS_ENABLED(CONFIG_NET_UDP)) {
 		uint64_t rate_in_kbps, client_rate_in_kbps;
+		uint32_t rate_in_pps, client_rate_in_pps;
 
 		shell_fprintf(sh, SHELL_NORMAL, "-\nUpload completed!\n");
 
@@ -487,8 +496,12 @@ static void shell_udp_upload_print_stats(const struct shell *sh,
 			rate_in_kbps = (uint32_t)
 				((results->total_len * 8 * USEC_PER_SEC) /
 				 (results->time_in_us * 1000U));
+			rate_in_pps = (uint32_t)
+				(((uint64_t)results->nb_packets_rcvd * USEC_PER_SEC) /
+				 results->time_in_us);
 		} else {
 			rate_in_kbps = 0U;
+			rate_in_pps = 0U;
 		}
 
 		if (results->client_time_in_us != 0U) {
@@ -497,8 +510,12 @@ static void shell_udp_upload_print_stats(const struct shell *sh,
 				  (uint64_t)results->packet_size * (uint64_t)8 *
 				  (uint64_t)USEC_PER_SEC) /
 				 (results->client_time_in_us * 1000U));
+			client_rate_in_pps = (uint32_t)
+				(((uint64_t)results->nb_packets_sent * USEC_PER_SEC) /
+				 results->client_time_in_us);
 		} else {
 			client_rate_in_kbps = 0U;
+			client_rate_in_pps = 0U;
 		}
 
 		if (!rate_in_kbps) {
@@ -536,6 +553,9 @@ static void shell_udp_upload_print_stats(const struct shell *sh,
 		shell_fprintf(sh, SHELL_NORMAL, "\t(");
 		print_number(sh, client_rate_in_kbps, KBPS, KBPS_UNIT);
 		shell_fprintf(sh, SHELL_NORMAL, ")\n");
+
+		shell_fprintf(sh, SHELL_NORMAL, "Packet rate:\t\t%u pps\t(%u pps)\n",
+			      rate_in_pps, client_rate_in_pps);
 	}
 }
 
@@ -18,6 +18,13 @@ static uint8_t sample_packet[sizeof(struct zperf_udp_datagram) +
 			     sizeof(struct zperf_client_hdr_v1) +
 			     PACKET_SIZE_MAX];
 
+#define UDP_UPLOAD_BATCH CONFIG_NET_ZPERF_UDP_BATCH
+#define UDP_UPLOAD_HDR_SIZE (sizeof(struct zperf_udp_datagram) + \
+			     sizeof(struct zperf_client_hdr_v1))
+
+/* Headers of the packets sent at once, their payload being sample_packet's */
+static uint8_t upload_hdrs[UDP_UPLOAD_BATCH][UDP_UPLOAD_HDR_SIZE];
+
 static struct zperf_async_upload_context udp_async_upload_ctx;
 
 static inline void zperf_upload_decode_stat(const uint8_t *data,
@@ -146,12 +153,16 @@ static int udp_upload(int sock, int port,
 	uint32_t packet_size = param->packet_size;
 	uint32_t rate_in_kbps = param->rate_kbps;
 	uint32_t packet_duration_us = zperf_packet_duration(packet_size, rate_in_kbps);
-	uint32_t packet_duration = k_us_to_ticks_ceil32(packet_duration_us);
+	uint32_t packet_duration = k_us_to_ticks_ceil32(packet_duration_us *
+							UDP_UPLOAD_BATCH);
 	uint32_t delay = packet_duration;
 	uint32_t nb_packets = 0U;
 	int64_t start_time, end_time;
 	int64_t print_time, last_loop_time;
 	uint32_t print_period;
+	struct iovec iov[UDP_UPLOAD_BATCH][2];
+	struct mmsghdr msgs[UDP_UPLOAD_BATCH];
+	size_t hdr_len;
 	bool is_mcast_pkt = false;
 	int ret;
 
@@ -176,6 +187,20 @@ static int udp_upload(int sock, int port,
 
 	(void)memset(sample_packet, 'z', sizeof(sample_packet));
 
+	/* Each packet is its own header followed by the sample payload */
+	hdr_len = MIN(packet_size, UDP_UPLOAD_HDR_SIZE);
+
+	for (int i = 0; i < UDP_UPLOAD_BATCH; i++) {
+		iov[i][0].iov_base = upload_hdrs[i];
+		iov[i][0].iov_len = hdr_len;
+		iov[i][1].iov_base = sample_packet + hdr_len;
+		iov[i][1].iov_len = packet_size - hdr_len;
+
+		memset(&msgs[i].msg_hdr, 0, sizeof(msgs[i].msg_hdr));
+		msgs[i].msg_hdr.msg_iov = iov[i];
+		msgs[i].msg_hdr.msg_iovlen = ARRAY_SIZE(iov[i]);
+	}
+
 	do {
 		struct zperf_udp_datagram *datagram;
 		struct zperf_client_hdr_v1 *hdr;
@@ -209,30 +234,32 @@ static int udp_upload(int sock, int port,
 		secs = usecs64 / USEC_PER_SEC;
 		usecs = usecs64 - (uint64_t)secs * USEC_PER_SEC;
 
-		/* Fill the packet header */
-		datagram = (struct zperf_udp_datagram *)sample_packet;
-
-		datagram->id = htonl(nb_packets);
-		datagram->tv_sec = htonl(secs);
-		datagram->tv_usec = htonl(usecs);
-
-		hdr = (struct zperf_client_hdr_v1 *)(sample_packet +
-						     sizeof(*datagram));
-		hdr->flags = 0;
-		hdr->num_of_threads = htonl(1);
-		hdr->port = htonl(port);
-		hdr->buffer_len = sizeof(sample_packet) -
-			sizeof(*datagram) - sizeof(*hdr);
-		hdr->bandwidth = htonl(rate_in_kbps);
-		hdr->num_of_bytes = htonl(packet_size);
+		/* Fill the packet headers */
+		for (int i = 0; i < UDP_UPLOAD_BATCH; i++) {
+			datagram = (struct zperf_udp_datagram *)upload_hdrs[i];
+
+			datagram->id = htonl(nb_packets + i);
+			datagram->tv_sec = htonl(secs);
+			datagram->tv_usec = htonl(usecs);
+
+			hdr = (struct zperf_client_hdr_v1 *)(upload_hdrs[i] +
+							     sizeof(*datagram));
+			hdr->flags = 0;
+			hdr->num_of_threads = htonl(1);
+			hdr->port = htonl(port);
+			hdr->buffer_len = sizeof(sample_packet) -
+				sizeof(*datagram) - sizeof(*hdr);
+			hdr->bandwidth = htonl(rate_in_kbps);
+			hdr->num_of_bytes = htonl(packet_size);
+		}
 
-		/* Send the packet */
-		ret = zsock_send(sock, sample_packet, packet_size, 0);
+		/* Send the packets */
+		ret = zsock_sendmmsg(sock, msgs, UDP_UPLOAD_BATCH, 0);
 		if (ret < 0) {
 			NET_ERR("Failed to send the packet (%d)", errno);
 			return -errno;
 		} else {
-			nb_packets++;
+			nb_packets += ret;
 		}
 
 		if (IS_ENABLED(CONFIG_NET_ZPERF_LOG_LEVEL_DBG)) {
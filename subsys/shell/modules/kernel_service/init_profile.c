@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "kernel_shell.h"
+
+#include <zephyr/init.h>
+#include <zephyr/kernel.h>
+
+struct init_profile_shell {
+	const struct shell *sh;
+	uint64_t total_ns;
+	int rank;
+};
+
+static bool init_profile_print(const struct sys_init_profile *profile, void *user_data)
+{
+	struct init_profile_shell *ctx = user_data;
+
+	ctx->rank++;
+	ctx->total_ns += profile->duration_ns;
+	shell_print(ctx->sh, "%4d %-12s %-32s %10llu %6d", ctx->rank,
+		    sys_init_level_name(profile->level), profile->name,
+		    profile->duration_ns / NSEC_PER_USEC, profile->result);
+
+	return true;
+}
+
+static bool init_profile_print_csv(const struct sys_init_profile *profile, void *user_data)
+{
+	struct init_profile_shell *ctx = user_data;
+
+	/* Same format as CONFIG_INIT_PROFILING_EXPORT */
+	if (!profile->measured) {
+		shell_print(ctx->sh, "init_profile,%s,%s,,%d", sys_init_level_name(profile->level),
+			    profile->name, profile->result);
+		return true;
+	}
+
+	shell_print(ctx->sh, "init_profile,%s,%s,%llu,%d", sys_init_level_name(profile->level),
+		    profile->name, profile->duration_ns, profile->result);
+
+	return true;
+}
+
+static int cmd_kernel_init_profile(const struct shell *sh, size_t argc, char **argv)
+{
+	struct init_profile_shell ctx = {
+		.sh = sh,
+	};
+
+	if (argc == 1) {
+		shell_print(sh, "Rank Level        Name                             Time (us) Result");
+		sys_init_profile_foreach_ranked(init_profile_print, &ctx);
+		shell_print(sh, "Sum: %llu us", ctx.total_ns / NSEC_PER_USEC);
+		return 0;
+	}
+
+	/* No need to enable the getopt and getopt_long for just one option. */
+	if (strcmp("-c", argv[1]) && strcmp("--csv", argv[1]) != 0) {
+		shell_error(sh, "Unsupported option: %s", argv[1]);
+		return -EIO;
+	}
+
+	sys_init_profile_foreach(init_profile_print_csv, &ctx);
+
+	return 0;
+}
+
+KERNEL_CMD_ARG_ADD(init_profile, NULL,
+		   "Init entries, slowest first. Can be called with the -c or --csv options "
+		   "to list them in init order as comma separated values",
+		   cmd_kernel_init_profile, 1, 1);
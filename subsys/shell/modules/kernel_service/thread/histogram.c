@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "kernel_shell.h"
+
+#include <zephyr/kernel.h>
+
+#define BINS  CONFIG_SCHED_THREAD_USAGE_HISTOGRAM_BINS
+#define SHIFT CONFIG_SCHED_THREAD_USAGE_HISTOGRAM_SHIFT
+
+static void shell_histogram_print(const struct shell *sh, const struct k_sched_histogram *hist)
+{
+	char bound[24];
+
+	shell_print(sh, "%-14s %10s %10s", "cycles", "run", "latency");
+
+	for (int i = 0; i < BINS; i++) {
+		if ((hist->run[i] == 0U) && (hist->latency[i] == 0U)) {
+			continue;
+		}
+
+		if (i < (BINS - 1)) {
+			snprintk(bound, sizeof(bound), "< %llu", BIT64(SHIFT + i));
+		} else {
+			snprintk(bound, sizeof(bound), ">= %llu", BIT64(SHIFT + i - 1));
+		}
+
+		shell_print(sh, "%-14s %10u %10u", bound, hist->run[i], hist->latency[i]);
+	}
+
+	shell_print(sh, "longest latency: %u cycles", hist->latency_max);
+}
+
+static int cmd_kernel_thread_histogram(const struct shell *sh, size_t argc, char **argv)
+{
+	struct k_sched_histogram hist;
+	struct k_thread *thread;
+	int err = 0;
+
+	if (argc == 1) {
+		unsigned int num_cpus = arch_num_cpus();
+
+		for (int i = 0; i < num_cpus; i++) {
+			(void)k_thread_runtime_histogram_cpu_get(i, &hist);
+			shell_print(sh, "CPU %d", i);
+			shell_histogram_print(sh, &hist);
+		}
+
+		return 0;
+	}
+
+	thread = UINT_TO_POINTER(shell_strtoull(argv[1], 16, &err));
+	if (err != 0) {
+		shell_error(sh, "Unable to parse thread ID %s (err %d)", argv[1], err);
+		return err;
+	}
+
+	if (!z_thread_is_valid(thread)) {
+		shell_error(sh, "Invalid thread id %p", (void *)thread);
+		return -EINVAL;
+	}
+
+	(void)k_thread_runtime_histogram_get(thread, &hist);
+	shell_print(sh, "%p %s", (void *)thread, k_thread_name_get(thread));
+	shell_histogram_print(sh, &hist);
+
+	return 0;
+}
+
+KERNEL_THREAD_CMD_ARG_ADD(histogram, NULL,
+			  "Show the run time and wake-up latency histograms of a thread,\n"
+			  "or of the threads of each CPU.\n"
+			  "Usage: kernel thread histogram [<thread ID>]",
+			  cmd_kernel_thread_histogram, 1, 1);
@@ -24,6 +24,10 @@ BENCH_BMEM char msg[MAX_MSG];
 BENCH_BMEM char data_bench[MESSAGE_SIZE];
 
 BENCH_DMEM struct k_pipe *test_pipes[] = {&PIPE_NOBUFF, &PIPE_SMALLBUFF, &PIPE_BIGBUFF};
+#ifdef CONFIG_PIPE_SPSC
+/* Indexed like test_pipes[], there is no bufferless SPSC pipe */
+BENCH_DMEM struct k_pipe *test_spsc_pipes[] = {NULL, &PIPE_SMALLBUFF_SPSC, &PIPE_BIGBUFF_SPSC};
+#endif
 BENCH_BMEM char sline[SLINE_LEN + 1];
 
 /*
@@ -73,6 +77,10 @@ K_MUTEX_DEFINE(DEMO_MUTEX);
 K_PIPE_DEFINE(PIPE_NOBUFF, 0, 4);
 K_PIPE_DEFINE(PIPE_SMALLBUFF, 256, 4);
 K_PIPE_DEFINE(PIPE_BIGBUFF, 4096, 4);
+#ifdef CONFIG_PIPE_SPSC
+K_PIPE_SPSC_DEFINE(PIPE_SMALLBUFF_SPSC, 256, 4);
+K_PIPE_SPSC_DEFINE(PIPE_BIGBUFF_SPSC, 4096, 4);
+#endif
 
 /*
  * Custom syscalls
@@ -98,6 +106,17 @@ static timing_t z_vrfy_timing_timestamp_get(void)
 #include <zephyr/syscalls/timing_timestamp_get_mrsh.c>
 #endif
 
+#ifdef CONFIG_USERSPACE
+static void spsc_pipes_grant(struct k_thread *thread)
+{
+#ifdef CONFIG_PIPE_SPSC
+	k_thread_access_grant(thread, &PIPE_SMALLBUFF_SPSC, &PIPE_BIGBUFF_SPSC);
+#else
+	ARG_UNUSED(thread);
+#endif
+}
+#endif /* CONFIG_USERSPACE */
+
 /*
  * Main test
  */
@@ -189,6 +208,7 @@ int main(void)
 			      &MB_COMM, &CH_COMM, &SEM0, &SEM1, &SEM2, &SEM3,
 			      &SEM4, &STARTRCV, &DEMO_MUTEX,
 			      &PIPE_NOBUFF, &PIPE_SMALLBUFF, &PIPE_BIGBUFF);
+	spsc_pipes_grant(&recv_thread);
 
 	k_thread_start(&recv_thread);
 	k_thread_start(&test_thread);
@@ -213,6 +233,7 @@ int main(void)
 			      &MB_COMM, &CH_COMM, &SEM0, &SEM1, &SEM2, &SEM3,
 			      &SEM4, &STARTRCV, &DEMO_MUTEX,
 			      &PIPE_NOBUFF, &PIPE_SMALLBUFF, &PIPE_BIGBUFF);
+	spsc_pipes_grant(&test_thread);
 
 	k_thread_start(&recv_thread);
 	k_thread_start(&test_thread);
@@ -237,10 +258,12 @@ int main(void)
 			      &MB_COMM, &CH_COMM, &SEM0, &SEM1, &SEM2, &SEM3,
 			      &SEM4, &STARTRCV, &DEMO_MUTEX,
 			      &PIPE_NOBUFF, &PIPE_SMALLBUFF, &PIPE_BIGBUFF);
+	spsc_pipes_grant(&test_thread);
 	k_thread_access_grant(&recv_thread, &DEMOQX1, &DEMOQX4, &DEMOQX192,
 			      &MB_COMM, &CH_COMM, &SEM0, &SEM1, &SEM2, &SEM3,
 			      &SEM4, &STARTRCV, &DEMO_MUTEX,
 			      &PIPE_NOBUFF, &PIPE_SMALLBUFF, &PIPE_BIGBUFF);
+	spsc_pipes_grant(&recv_thread);
 
 	k_thread_start(&recv_thread);
 	k_thread_start(&test_thread);
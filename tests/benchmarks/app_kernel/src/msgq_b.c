@@ -8,6 +8,73 @@
 
 #include "master.h"
 
+#ifdef CONFIG_MSGQ_ZERO_COPY
+/* Messages claimed at once by the batch runs */
+#define MSGQ_BATCH 16
+
+/**
+ * @brief Message queue zero-copy transfer speed test
+ *
+ * Same as the 192 bytes runs, with the messages written and read in place.
+ */
+static void message_queue_zero_copy_test(void)
+{
+	uint32_t et; /* elapsed time */
+	int i;
+	int n;
+	void *slot;
+	timing_t  start;
+	timing_t  end;
+
+	start = timing_timestamp_get();
+	for (i = 0; i < NR_OF_MSGQ_RUNS; i++) {
+		k_msgq_put_claim(&DEMOQX192, &slot, K_FOREVER);
+		k_msgq_put_commit(&DEMOQX192);
+	}
+	end = timing_timestamp_get();
+	et = (uint32_t)timing_cycles_get(&start, &end);
+
+	PRINT_F(FORMAT, "enqueue 192 bytes msg in MSGQ in place",
+		SYS_CLOCK_HW_CYCLES_TO_NS_AVG(et, NR_OF_MSGQ_RUNS));
+
+	start = timing_timestamp_get();
+	for (i = 0; i < NR_OF_MSGQ_RUNS; i++) {
+		k_msgq_get_claim(&DEMOQX192, &slot, K_FOREVER);
+		k_msgq_get_finish(&DEMOQX192);
+	}
+	end = timing_timestamp_get();
+	et = (uint32_t)timing_cycles_get(&start, &end);
+
+	PRINT_F(FORMAT, "dequeue 192 bytes msg in MSGQ in place",
+		SYS_CLOCK_HW_CYCLES_TO_NS_AVG(et, NR_OF_MSGQ_RUNS));
+
+	start = timing_timestamp_get();
+	for (i = 0; i < NR_OF_MSGQ_RUNS; i += n) {
+		n = k_msgq_put_claim_batch(&DEMOQX192, &slot,
+					   MIN(MSGQ_BATCH, NR_OF_MSGQ_RUNS - i),
+					   K_FOREVER);
+		k_msgq_put_commit_batch(&DEMOQX192, n);
+	}
+	end = timing_timestamp_get();
+	et = (uint32_t)timing_cycles_get(&start, &end);
+
+	PRINT_F(FORMAT, "enqueue 192 bytes msg in MSGQ in place, batch of 16",
+		SYS_CLOCK_HW_CYCLES_TO_NS_AVG(et, NR_OF_MSGQ_RUNS));
+
+	start = timing_timestamp_get();
+	for (i = 0; i < NR_OF_MSGQ_RUNS; i += n) {
+		n = k_msgq_get_claim_batch(&DEMOQX192, &slot, MSGQ_BATCH,
+					   K_FOREVER);
+		k_msgq_get_finish_batch(&DEMOQX192, n);
+	}
+	end = timing_timestamp_get();
+	et = (uint32_t)timing_cycles_get(&start, &end);
+
+	PRINT_F(FORMAT, "dequeue 192 bytes msg in MSGQ in place, batch of 16",
+		SYS_CLOCK_HW_CYCLES_TO_NS_AVG(et, NR_OF_MSGQ_RUNS));
+}
+#endif /* CONFIG_MSGQ_ZERO_COPY */
+
 /**
  * @brief Message queue transfer speed test
  */
@@ -78,6 +145,13 @@ void message_queue_test(void)
 	PRINT_F(FORMAT, "dequeue 192 bytes msg in MSGQ",
 		SYS_CLOCK_HW_CYCLES_TO_NS_AVG(et, NR_OF_MSGQ_RUNS));
 
+#ifdef CONFIG_MSGQ_ZERO_COPY
+	/* The zero-copy API is not available to user threads */
+	if (!k_is_user_context()) {
+		message_queue_zero_copy_test();
+	}
+#endif /* CONFIG_MSGQ_ZERO_COPY */
+
 	k_sem_give(&STARTRCV);
 
 	start = timing_timestamp_get();
@@ -41,6 +41,12 @@
 		(uint32_t)(((uint64_t)putsize * 1000000U) /             \
 			   SAFE_DIVISOR(puttime[2])))
 
+#define PRINT_SPSC_ALL_TO_N()                                             \
+	PRINT_F("|%5u|%5u|%10s|%10u|%10u|%10s|%10u|%10u|\n",                 \
+		putsize, putsize, "-", puttime[1], puttime[2], "-",          \
+		(1000000 * putsize) / SAFE_DIVISOR(puttime[1]),              \
+		(1000000 * putsize) / SAFE_DIVISOR(puttime[2]))
+
 /*
  * Function prototypes.
  */
@@ -51,6 +57,43 @@ int pipeput(struct k_pipe *pipe, enum pipe_options
  * Function declarations.
  */
 
+#ifdef CONFIG_PIPE_SPSC
+/**
+ * @brief Test the single-producer/single-consumer pipes transfer speed
+ *
+ * Same as the matching sizes runs, on pipes that pass data through their
+ * buffer without locking. These pipes need a buffer.
+ */
+static void pipe_spsc_test(void)
+{
+	uint32_t	putsize;
+	uint32_t	puttime[3];
+	int		pipe;
+	struct getinfo	getinfo;
+
+	PRINT_STRING("|       matching sizes (_ALL_N), "
+		     "single-producer/single-consumer pipes        |\n");
+	PRINT_STRING(dashline);
+	PRINT_ALL_TO_N_HEADER_UNIT();
+	PRINT_STRING(dashline);
+	PRINT_STRING("| put | get |  no buf  | small buf| big buf  |"
+		     "  no buf  | small buf| big buf  |\n");
+	PRINT_STRING(dashline);
+
+	for (putsize = 8U; putsize <= MESSAGE_SIZE_PIPE; putsize <<= 1) {
+		for (pipe = 1; pipe < 3; pipe++) {
+			pipeput(test_spsc_pipes[pipe], _ALL_N, putsize,
+				NR_OF_PIPE_RUNS, &puttime[pipe]);
+
+			/* waiting for ack */
+			k_msgq_get(&CH_COMM, &getinfo, K_FOREVER);
+		}
+		PRINT_SPSC_ALL_TO_N();
+	}
+	PRINT_STRING(dashline);
+}
+#endif /* CONFIG_PIPE_SPSC */
+
 /**
  * @brief Test the pipes transfer speed
  */
@@ -102,6 +145,10 @@ void pipe_test(void)
 	}
 	PRINT_STRING(dashline);
 
+#ifdef CONFIG_PIPE_SPSC
+	pipe_spsc_test();
+#endif /* CONFIG_PIPE_SPSC */
+
 	/* Test with two different sender priorities */
 	for (prio = 0; prio < 2; prio++) {
 		/* non-buffered operation, non-matching (1_TO_N) */
@@ -48,6 +48,23 @@ void piperecvtask(void)
 		}
 	}
 
+#ifdef CONFIG_PIPE_SPSC
+	/* matching (ALL_N), single-producer/single-consumer pipes */
+
+	for (getsize = 8; getsize <= MESSAGE_SIZE_PIPE; getsize <<= 1) {
+		for (pipe = 1; pipe < 3; pipe++) {
+			getcount = NR_OF_PIPE_RUNS;
+			pipeget(test_spsc_pipes[pipe], _ALL_N, getsize,
+				getcount, &gettime);
+			getinfo.time = gettime;
+			getinfo.size = getsize;
+			getinfo.count = getcount;
+			/* acknowledge to master */
+			k_msgq_put(&CH_COMM, &getinfo, K_FOREVER);
+		}
+	}
+#endif /* CONFIG_PIPE_SPSC */
+
 	for (prio = 0; prio < 2; prio++) {
 		/* non-matching (1_TO_N) */
 		for (getsize = (MESSAGE_SIZE_PIPE); getsize >= 8; getsize >>= 1) {
@@ -96,9 +113,17 @@ int pipeget(struct k_pipe *pipe, enum pipe_options option, int size, int count,
 		size_t sizexferd = 0;
 		size_t size2xfer = MIN(size, size2xfer_total - sizexferd_total);
 		int ret;
-
+		size_t mim_num_of_bytes = option;
+
+		/* Pipes without a reader-side copy from a waiting writer,
+		 * such as single-producer/single-consumer pipes, may return
+		 * the buffered data only.
+		 */
+		if (option == _ALL_N) {
+			mim_num_of_bytes = size2xfer;
+		}
 		ret = k_pipe_get(pipe, data_recv, size2xfer,
-				 &sizexferd, option, K_FOREVER);
+				 &sizexferd, mim_num_of_bytes, K_FOREVER);
 
 		if (ret != 0) {
 			return 1;
@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * @file
+ * This file contains the test that measures the average time of a system
+ * call on a dynamically allocated kernel object, as the number of
+ * allocated kernel objects grows.  Every system call looks up its object
+ * among them.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/timing/timing.h>
+#include "utils.h"
+#include "timing_sc.h"
+
+#ifdef CONFIG_DYNAMIC_OBJECTS
+
+#define MAX_OBJECTS 256
+
+static const uint32_t num_objects[] = { 1, 16, 64, MAX_OBJECTS };
+
+static struct k_sem *sems[MAX_OBJECTS];
+
+static void dyn_sem_give(void *p1, void *p2, void *p3)
+{
+	uint32_t num_iterations = (uint32_t)(uintptr_t)p1;
+	struct k_sem *sem = p2;
+	timing_t start;
+	timing_t finish;
+
+	ARG_UNUSED(p3);
+
+	start = timing_timestamp_get();
+
+	for (uint32_t i = 0; i < num_iterations; i++) {
+		k_sem_give(sem);
+	}
+
+	finish = timing_timestamp_get();
+
+	timestamp.cycles = timing_cycles_get(&start, &finish);
+}
+
+void dyn_object_syscall(uint32_t num_iterations, uint32_t options)
+{
+	uint32_t num_allocated = 0;
+	int  priority;
+	char tag[50];
+	char description[120];
+
+	priority = k_thread_priority_get(k_current_get());
+
+	k_thread_system_pool_assign(k_current_get());
+
+	timing_start();
+
+	for (size_t step = 0; step < ARRAY_SIZE(num_objects); step++) {
+		while (num_allocated < num_objects[step]) {
+			sems[num_allocated] = k_object_alloc(K_OBJ_SEM);
+			if (sems[num_allocated] == NULL) {
+				error_count++;
+				goto out;
+			}
+			k_sem_init(sems[num_allocated], 0, K_SEM_MAX_LIMIT);
+			num_allocated++;
+		}
+
+		/* The most recently allocated object */
+		struct k_sem *sem = sems[num_allocated - 1];
+
+		k_thread_create(&start_thread, start_stack,
+				K_THREAD_STACK_SIZEOF(start_stack),
+				dyn_sem_give,
+				(void *)(uintptr_t)num_iterations, sem, NULL,
+				priority - 1, options, K_FOREVER);
+
+		k_thread_access_grant(&start_thread, sem);
+		k_thread_start(&start_thread);
+		k_thread_join(&start_thread, K_FOREVER);
+
+		snprintf(tag, sizeof(tag), "syscall.dyn_object.%u.%s",
+			 num_allocated,
+			 (options & K_USER) == K_USER ? "user" : "kernel");
+		snprintf(description, sizeof(description),
+			 "%-40s - Give a dynamic semaphore (%u objects)",
+			 tag, num_allocated);
+
+		PRINT_STATS_AVG(description, (uint32_t)timestamp.cycles,
+				num_iterations, false, "");
+	}
+
+out:
+	for (uint32_t i = 0; i < num_allocated; i++) {
+		k_object_free(sems[i]);
+	}
+
+	timing_stop();
+}
+
+#endif /* CONFIG_DYNAMIC_OBJECTS */
@@ -11,7 +11,20 @@
 #define TEST_COUNT 100
 #define TEST_SIZE 10
 
-void heap_malloc_free(void)
+#if (CONFIG_MP_MAX_NUM_CPUS > 1)
+/* Set while the busy threads on the other CPUs use the heap as well */
+static atomic_t heap_contended;
+
+/* Invoked repeatedly by the busy threads */
+void heap_malloc_free_busy(void)
+{
+	if (atomic_get(&heap_contended) != 0) {
+		k_free(k_malloc(TEST_SIZE));
+	}
+}
+#endif
+
+static void heap_malloc_free_measure(const char *tag, const char *desc_suffix)
 {
 	timing_t heap_malloc_start_time = 0U;
 	timing_t heap_malloc_end_time = 0U;
@@ -27,6 +40,11 @@ void heap_malloc_free(void)
 	char  error_string[80];
 	char  description[120];
 	const char *notes = "";
+	char  tag_malloc[40];
+	char  tag_free[40];
+
+	snprintf(tag_malloc, sizeof(tag_malloc), "heap.malloc.%s", tag);
+	snprintf(tag_free, sizeof(tag_free), "heap.free.%s", tag);
 
 	timing_start();
 
@@ -65,14 +83,26 @@ void heap_malloc_free(void)
 	}
 
 	snprintf(description, sizeof(description),
-		 "%-40s - Average time for heap malloc",
-		 "heap.malloc.immediate");
+		 "%-40s - Average time for heap malloc%s",
+		 tag_malloc, desc_suffix);
 	PRINT_STATS_AVG(description, sum_malloc, count, failed, notes);
 
 	snprintf(description, sizeof(description),
-		 "%-40s - Average time for heap free",
-		 "heap.free.immediate");
+		 "%-40s - Average time for heap free%s",
+		 tag_free, desc_suffix);
 	PRINT_STATS_AVG(description, sum_free, count, failed, notes);
 
 	timing_stop();
 }
+
+void heap_malloc_free(void)
+{
+	heap_malloc_free_measure("immediate", "");
+
+#if (CONFIG_MP_MAX_NUM_CPUS > 1)
+	/* Again, with all other CPUs hammering the same heap */
+	atomic_set(&heap_contended, 1);
+	heap_malloc_free_measure("contended", " (other CPUs allocating)");
+	atomic_set(&heap_contended, 0);
+#endif
+}
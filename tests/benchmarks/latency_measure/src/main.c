@@ -67,11 +67,18 @@ extern int stack_ops(uint32_t num_iterations, uint32_t options);
 extern int stack_blocking_ops(uint32_t num_iterations, uint32_t start_options,
 			       uint32_t alt_options);
 extern void heap_malloc_free(void);
+extern void mem_slab_alloc_free(void);
+extern void dyn_object_syscall(uint32_t num_iterations, uint32_t options);
 
 #if (CONFIG_MP_MAX_NUM_CPUS > 1)
+extern void heap_malloc_free_busy(void);
+extern void mem_slab_alloc_free_busy(void);
+
 static void busy_thread_entry(void *arg1, void *arg2, void *arg3)
 {
 	while (1) {
+		heap_malloc_free_busy();
+		mem_slab_alloc_free_busy();
 	}
 }
 #endif
@@ -203,6 +210,12 @@ static void test_thread(void *arg1, void *arg2, void *arg3)
 
 	heap_malloc_free();
 
+	mem_slab_alloc_free();
+
+#ifdef CONFIG_DYNAMIC_OBJECTS
+	dyn_object_syscall(CONFIG_BENCHMARK_NUM_ITERATIONS, K_USER);
+#endif
+
 	TC_END_REPORT(error_count);
 }
 
@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * @file
+ * This file contains the test that measures the average time to allocate
+ * a block from a memory slab and to free it again.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/timing/timing.h>
+#include "utils.h"
+
+#define TEST_COUNT 100
+#define BLOCK_SIZE 32
+#define NUM_BLOCKS (4 * CONFIG_MP_MAX_NUM_CPUS)
+
+K_MEM_SLAB_DEFINE_STATIC(bench_slab, BLOCK_SIZE, NUM_BLOCKS, sizeof(void *));
+
+#if (CONFIG_MP_MAX_NUM_CPUS > 1)
+/* Set while the busy threads on the other CPUs use the slab as well */
+static atomic_t slab_contended;
+
+/* Invoked repeatedly by the busy threads */
+void mem_slab_alloc_free_busy(void)
+{
+	void *block;
+
+	if ((atomic_get(&slab_contended) != 0) &&
+	    (k_mem_slab_alloc(&bench_slab, &block, K_NO_WAIT) == 0)) {
+		k_mem_slab_free(&bench_slab, block);
+	}
+}
+#endif
+
+static void mem_slab_alloc_free_measure(const char *tag, const char *desc_suffix)
+{
+	timing_t alloc_start_time;
+	timing_t alloc_end_time;
+	timing_t free_start_time;
+	timing_t free_end_time;
+
+	uint32_t count = 0U;
+	uint32_t sum_alloc = 0U;
+	uint32_t sum_free = 0U;
+
+	bool  failed = false;
+	char  error_string[80];
+	char  description[120];
+	const char *notes = "";
+	char  tag_alloc[40];
+	char  tag_free[40];
+	void *block;
+	int   ret;
+
+	snprintf(tag_alloc, sizeof(tag_alloc), "mem_slab.alloc.%s", tag);
+	snprintf(tag_free, sizeof(tag_free), "mem_slab.free.%s", tag);
+
+	timing_start();
+
+	while (count != TEST_COUNT) {
+		alloc_start_time = timing_counter_get();
+		ret = k_mem_slab_alloc(&bench_slab, &block, K_NO_WAIT);
+		alloc_end_time = timing_counter_get();
+
+		if (ret != 0) {
+			error_count++;
+			snprintk(error_string, 78,
+				 "alloc block @ iteration %d", count);
+			notes = error_string;
+			failed = true;
+			break;
+		}
+
+		free_start_time = timing_counter_get();
+		k_mem_slab_free(&bench_slab, block);
+		free_end_time = timing_counter_get();
+
+		sum_alloc += timing_cycles_get(&alloc_start_time, &alloc_end_time);
+		sum_free += timing_cycles_get(&free_start_time, &free_end_time);
+		count++;
+	}
+
+	snprintf(description, sizeof(description),
+		 "%-40s - Average time for slab alloc%s",
+		 tag_alloc, desc_suffix);
+	PRINT_STATS_AVG(description, sum_alloc, MAX(count, 1U), failed, notes);
+
+	snprintf(description, sizeof(description),
+		 "%-40s - Average time for slab free%s",
+		 tag_free, desc_suffix);
+	PRINT_STATS_AVG(description, sum_free, MAX(count, 1U), failed, notes);
+
+	timing_stop();
+}
+
+void mem_slab_alloc_free(void)
+{
+	mem_slab_alloc_free_measure("immediate", "");
+
+#if (CONFIG_MP_MAX_NUM_CPUS > 1)
+	/* Again, with all other CPUs hammering the same slab */
+	atomic_set(&slab_contended, 1);
+	mem_slab_alloc_free_measure("contended", " (other CPUs allocating)");
+	atomic_set(&slab_contended, 0);
+#endif
+}
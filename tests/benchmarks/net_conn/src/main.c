@@ -0,0 +1,225 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * @file
+ * This file measures the time taken by net_conn_input() to find the
+ * connection a received UDP packet is for, as the number of registered
+ * connections grows. The packet is built once and handed over directly to
+ * the connection layer, whose callback does not consume it, so that only
+ * the lookup is measured.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/timing/timing.h>
+#include <zephyr/tc_util.h>
+#include <zephyr/net/net_core.h>
+#include <zephyr/net/net_if.h>
+#include <zephyr/net/net_pkt.h>
+#include <zephyr/net/dummy.h>
+
+#include "ipv4.h"
+#include "udp_internal.h"
+#include "connection.h"
+
+#define NUM_ITERATIONS 1000
+#define LOCAL_PORT 5000
+#define REMOTE_PORT 1000
+
+static const struct in_addr my_addr = { { { 192, 0, 2, 1 } } };
+static const struct in_addr peer_addr = { { { 192, 0, 2, 9 } } };
+
+static struct net_conn_handle *handles[CONFIG_NET_MAX_CONN];
+static uint32_t received;
+
+static int dummy_send(const struct device *dev, struct net_pkt *pkt)
+{
+	ARG_UNUSED(dev);
+	ARG_UNUSED(pkt);
+
+	return 0;
+}
+
+static void dummy_iface_init(struct net_if *iface)
+{
+	static uint8_t mac[] = { 0x00, 0x00, 0x5E, 0x00, 0x53, 0x01 };
+
+	net_if_set_link_addr(iface, mac, sizeof(mac), NET_LINK_ETHERNET);
+}
+
+static struct dummy_api dummy_api = {
+	.iface_api.init = dummy_iface_init,
+	.send = dummy_send,
+};
+
+NET_DEVICE_INIT(net_conn_bench, "net_conn_bench", NULL, NULL, NULL, NULL,
+		CONFIG_KERNEL_INIT_PRIORITY_DEFAULT, &dummy_api, DUMMY_L2,
+		NET_L2_GET_CTX_TYPE(DUMMY_L2), 127);
+
+static enum net_verdict recv_cb(struct net_conn *conn, struct net_pkt *pkt,
+				union net_ip_header *ip_hdr,
+				union net_proto_header *proto_hdr,
+				void *user_data)
+{
+	ARG_UNUSED(conn);
+	ARG_UNUSED(pkt);
+	ARG_UNUSED(ip_hdr);
+	ARG_UNUSED(proto_hdr);
+	ARG_UNUSED(user_data);
+
+	received++;
+
+	/* Keep the packet, it is sent again */
+	return NET_OK;
+}
+
+static int register_conns(int count, bool connected)
+{
+	struct sockaddr_in local = {
+		.sin_family = AF_INET,
+		.sin_addr = my_addr,
+	};
+	struct sockaddr_in remote = {
+		.sin_family = AF_INET,
+		.sin_addr = peer_addr,
+	};
+	int ret;
+
+	for (int i = 0; i < count; i++) {
+		ret = net_udp_register(AF_INET,
+				       connected ? (struct sockaddr *)&remote : NULL,
+				       (struct sockaddr *)&local,
+				       connected ? REMOTE_PORT + i : 0,
+				       LOCAL_PORT + i, NULL, recv_cb, NULL,
+				       &handles[i]);
+		if (ret < 0) {
+			printk("Cannot register connection %d (%d)\n", i, ret);
+			return ret;
+		}
+	}
+
+	return 0;
+}
+
+static void unregister_conns(int count)
+{
+	for (int i = 0; i < count; i++) {
+		(void)net_udp_unregister(handles[i]);
+	}
+}
+
+static struct net_pkt *create_pkt(struct net_if *iface, uint16_t src_port,
+				  uint16_t dst_port)
+{
+	struct net_pkt *pkt;
+
+	pkt = net_pkt_alloc_with_buffer(iface, 0, AF_INET, IPPROTO_UDP,
+					K_SECONDS(1));
+	if (pkt == NULL) {
+		return NULL;
+	}
+
+	if (net_ipv4_create(pkt, &peer_addr, &my_addr) < 0 ||
+	    net_udp_create(pkt, htons(src_port), htons(dst_port)) < 0) {
+		net_pkt_unref(pkt);
+		return NULL;
+	}
+
+	net_pkt_cursor_init(pkt);
+	net_ipv4_finalize(pkt, IPPROTO_UDP);
+
+	return pkt;
+}
+
+/*
+ * Measure the lookup among count connections, the packet being for the
+ * one registered first, which is the last one a linear scan would find.
+ */
+static int bench_lookup(struct net_if *iface, int count, bool connected)
+{
+	const char *kind = connected ? "connected" : "listening";
+	union net_ip_header ip_hdr;
+	union net_proto_header proto_hdr;
+	struct net_pkt *pkt;
+	timing_t start, end;
+	uint64_t cycles;
+	int ret;
+
+	ret = register_conns(count, connected);
+	if (ret < 0) {
+		unregister_conns(count);
+		return ret;
+	}
+
+	pkt = create_pkt(iface, REMOTE_PORT, LOCAL_PORT);
+	if (pkt == NULL) {
+		printk("Cannot create packet\n");
+		unregister_conns(count);
+		return -ENOMEM;
+	}
+
+	ip_hdr.ipv4 = (struct net_ipv4_hdr *)pkt->buffer->data;
+	proto_hdr.udp = (struct net_udp_hdr *)(pkt->buffer->data +
+					      sizeof(struct net_ipv4_hdr));
+
+	received = 0U;
+
+	start = timing_counter_get();
+
+	for (int i = 0; i < NUM_ITERATIONS; i++) {
+		(void)net_conn_input(pkt, &ip_hdr, IPPROTO_UDP, &proto_hdr);
+	}
+
+	end = timing_counter_get();
+
+	net_pkt_unref(pkt);
+	unregister_conns(count);
+
+	if (received != NUM_ITERATIONS) {
+		printk("Received %u packets out of %u\n", received,
+		       NUM_ITERATIONS);
+		return -EIO;
+	}
+
+	cycles = timing_cycles_get(&start, &end) / NUM_ITERATIONS;
+
+	printk("REC: net_conn.%s.%d - lookup among %4d %s sockets :"
+	       " %7llu cycles , %7u ns :\n", kind, count, count, kind, cycles,
+	       (uint32_t)timing_cycles_to_ns(cycles));
+
+	return 0;
+}
+
+int main(void)
+{
+	struct net_if *iface = net_if_get_first_by_type(&NET_L2_GET_NAME(DUMMY));
+	int ret = 0;
+
+	if (net_if_ipv4_addr_add(iface, (struct in_addr *)&my_addr,
+				 NET_ADDR_MANUAL, 0) == NULL) {
+		printk("Cannot add address\n");
+		return 0;
+	}
+
+	timing_init();
+	timing_start();
+
+	printk("net_conn_input() lookup time with %d hash buckets\n",
+	       CONFIG_NET_CONN_HASH_BUCKETS);
+
+	for (int count = 1; count <= CONFIG_NET_MAX_CONN && ret == 0; count *= 2) {
+		ret = bench_lookup(iface, count, true);
+		if (ret == 0) {
+			ret = bench_lookup(iface, count, false);
+		}
+	}
+
+	timing_stop();
+
+	TC_END_REPORT(ret == 0 ? TC_PASS : TC_FAIL);
+
+	return 0;
+}
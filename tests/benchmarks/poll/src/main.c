@@ -0,0 +1,177 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * @file
+ * This file contains a benchmark that measures the cost of k_poll() on a
+ * large set of poll signals of which only a few are raised at a time.
+ * A high priority thread polls on all of the signals in a loop, while
+ * the main thread raises them, either one or several at a time.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/timing/timing.h>
+#include <zephyr/tc_util.h>
+
+#define NUM_EVENTS     CONFIG_BENCHMARK_NUM_EVENTS
+#define NUM_FIRED      CONFIG_BENCHMARK_NUM_FIRED
+#define NUM_ITERATIONS CONFIG_BENCHMARK_NUM_ITERATIONS
+
+#ifdef CONFIG_POLL_LOCK_SHARDING
+#define NUM_LOCK_SHARDS CONFIG_POLL_LOCK_SHARDS
+#else
+#define NUM_LOCK_SHARDS 1
+#endif
+
+#define STACK_SIZE     (1024 + CONFIG_TEST_EXTRA_STACK_SIZE)
+
+/* Fired signals are spread over the whole set */
+#define FIRED_STRIDE   (NUM_EVENTS / NUM_FIRED)
+
+BUILD_ASSERT(NUM_FIRED <= NUM_EVENTS, "more fired than polled events");
+
+static struct k_poll_signal signals[NUM_EVENTS];
+static struct k_poll_event events[NUM_EVENTS];
+static struct k_poll_signal *fired[NUM_FIRED];
+
+static K_THREAD_STACK_DEFINE(poller_stack, STACK_SIZE);
+static struct k_thread poller_thread;
+
+static volatile timing_t block_start;
+static volatile timing_t wake_time;
+static volatile uint32_t num_wakeups;
+
+static int status = TC_PASS;
+
+static void poller_entry(void *p1, void *p2, void *p3)
+{
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	while (true) {
+		block_start = timing_counter_get();
+		if (k_poll(events, NUM_EVENTS, K_FOREVER) != 0) {
+			TC_ERROR("k_poll() failed\n");
+			status = TC_FAIL;
+			return;
+		}
+		wake_time = timing_counter_get();
+
+		num_wakeups++;
+
+		for (int i = 0; i < NUM_EVENTS; i++) {
+			if (events[i].state != K_POLL_STATE_NOT_READY) {
+				k_poll_signal_reset(&signals[i]);
+				events[i].state = K_POLL_STATE_NOT_READY;
+			}
+		}
+	}
+}
+
+static void report(const char *tag, const char *str, uint64_t cycles)
+{
+	uint64_t average = cycles / NUM_ITERATIONS;
+	uint32_t nsec = (uint32_t)timing_cycles_to_ns_avg(cycles, NUM_ITERATIONS);
+
+#ifdef CONFIG_BENCHMARK_RECORDING
+	printk("REC: %-40s - %-50s : %7llu cycles , %7u ns :\n", tag, str,
+	       average, nsec);
+#else
+	ARG_UNUSED(tag);
+
+	printk("%-60s : %7llu cycles (%7u nsec)\n", str, average, nsec);
+#endif
+}
+
+int main(void)
+{
+	uint64_t wake = 0;
+	uint64_t block = 0;
+	uint64_t separate = 0;
+	uint64_t batch = 0;
+	uint32_t separate_wakeups;
+	uint32_t batch_wakeups;
+	timing_t start;
+	timing_t finish;
+
+	timing_init();
+
+	printk("Poll measurements: %u events, %u fired together, %u lock shards\n",
+	       NUM_EVENTS, NUM_FIRED, NUM_LOCK_SHARDS);
+	printk("Timing results: Clock frequency: %u MHz\n",
+	       timing_freq_get_mhz());
+
+	for (int i = 0; i < NUM_EVENTS; i++) {
+		k_poll_signal_init(&signals[i]);
+		k_poll_event_init(&events[i], K_POLL_TYPE_SIGNAL,
+				  K_POLL_MODE_NOTIFY_ONLY, &signals[i]);
+	}
+
+	for (int i = 0; i < NUM_FIRED; i++) {
+		fired[i] = &signals[i * FIRED_STRIDE];
+	}
+
+	timing_start();
+
+	/* Higher priority than main: blocks in k_poll() right away */
+	k_thread_create(&poller_thread, poller_stack, STACK_SIZE, poller_entry,
+			NULL, NULL, NULL,
+			k_thread_priority_get(k_current_get()) - 1, 0, K_NO_WAIT);
+
+	/* One signal out of all, picked round-robin */
+	for (int iter = 0; iter < NUM_ITERATIONS; iter++) {
+		start = timing_counter_get();
+		k_poll_signal_raise(&signals[iter % NUM_EVENTS], 0);
+		finish = timing_counter_get();
+
+		wake += timing_cycles_get(&start, (timing_t *)&wake_time);
+		block += timing_cycles_get((timing_t *)&block_start, &finish);
+	}
+
+	num_wakeups = 0;
+	for (int iter = 0; iter < NUM_ITERATIONS; iter++) {
+		start = timing_counter_get();
+		for (int i = 0; i < NUM_FIRED; i++) {
+			k_poll_signal_raise(fired[i], 0);
+		}
+		finish = timing_counter_get();
+
+		separate += timing_cycles_get(&start, &finish);
+	}
+	separate_wakeups = num_wakeups;
+
+	num_wakeups = 0;
+	for (int iter = 0; iter < NUM_ITERATIONS; iter++) {
+		start = timing_counter_get();
+		k_poll_signal_raise_batch(fired, NUM_FIRED, 0);
+		finish = timing_counter_get();
+
+		batch += timing_cycles_get(&start, &finish);
+	}
+	batch_wakeups = num_wakeups;
+
+	timing_stop();
+
+	k_thread_abort(&poller_thread);
+
+	report("poll.signal.wake", "Raise signal, switch to woken poller", wake);
+	report("poll.block", "Poll on all events and block", block);
+	report("poll.signal.raise.separate", "Raise signals one at a time", separate);
+	report("poll.signal.raise.batch", "Raise signals as a batch", batch);
+
+	printk("Poller wakeups per round: %u separate, %u batch\n",
+	       separate_wakeups / NUM_ITERATIONS, batch_wakeups / NUM_ITERATIONS);
+
+	if (batch_wakeups > separate_wakeups) {
+		TC_ERROR("batch raise woke the poller more often\n");
+		status = TC_FAIL;
+	}
+
+	TC_END_REPORT(status);
+
+	return 0;
+}
@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/printk.h>
+#include <zephyr/sys/atomic.h>
+
+/* SMP variant of the scheduler benchmark.  Instead of timing the
+ * individual steps of one context switch, it measures how many
+ * context switches the scheduler sustains on each CPU when all of
+ * them are busy.  Pairs of equal priority threads hand control back
+ * and forth through a pair of semaphores:
+ *
+ *    A: take(sem[0]) ... give(sem[1]) ... take(sem[0]) ...
+ *    B: take(sem[1]) ... give(sem[0]) ... take(sem[1]) ...
+ *
+ * Every return from take() is one switch into a thread.  Each thread
+ * counts them per CPU it observed itself running on, and the totals
+ * are reported per CPU as switches per second.  There are several
+ * pairs per CPU so that ready threads regularly have to be placed on,
+ * or stolen from, other CPUs' ready queues.
+ */
+
+#define NUM_CPUS    CONFIG_MP_MAX_NUM_CPUS
+#define NUM_PAIRS   (CONFIG_SCHED_BENCHMARK_SMP_PAIRS_PER_CPU * NUM_CPUS)
+#define NUM_THREADS (2 * NUM_PAIRS)
+#define STACK_SIZE  (1024 + CONFIG_TEST_EXTRA_STACK_SIZE)
+#define THREAD_PRIO K_PRIO_PREEMPT(1)
+
+struct pair {
+	struct k_sem sem[2];
+};
+
+static K_THREAD_STACK_ARRAY_DEFINE(stacks, NUM_THREADS, STACK_SIZE);
+static struct k_thread threads[NUM_THREADS];
+static struct pair pairs[NUM_PAIRS];
+
+static uint32_t switches[NUM_THREADS][NUM_CPUS];
+static atomic_t running;
+
+static void pair_thread(void *p1, void *p2, void *p3)
+{
+	uintptr_t idx = (uintptr_t)p1;
+	struct pair *pair = &pairs[idx / 2];
+	unsigned int side = idx % 2;
+
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	while (true) {
+		k_sem_take(&pair->sem[side], K_FOREVER);
+		if (atomic_get(&running) == 0) {
+			break;
+		}
+
+		switches[idx][arch_curr_cpu()->id]++;
+
+		k_sem_give(&pair->sem[side ^ 1]);
+	}
+}
+
+int main(void)
+{
+	uint64_t total = 0U;
+
+	printk("SMP context switch rate: %d CPUs, %d thread pairs, %d ms\n",
+	       NUM_CPUS, NUM_PAIRS, CONFIG_SCHED_BENCHMARK_SMP_DURATION_MS);
+
+	atomic_set(&running, 1);
+
+	for (int i = 0; i < NUM_PAIRS; i++) {
+		k_sem_init(&pairs[i].sem[0], 0, 1);
+		k_sem_init(&pairs[i].sem[1], 0, 1);
+	}
+
+	for (uintptr_t i = 0; i < NUM_THREADS; i++) {
+		k_thread_create(&threads[i], stacks[i], STACK_SIZE,
+				pair_thread, (void *)i, NULL, NULL,
+				THREAD_PRIO, 0, K_NO_WAIT);
+	}
+
+	/* Start the ball rolling in every pair */
+	for (int i = 0; i < NUM_PAIRS; i++) {
+		k_sem_give(&pairs[i].sem[0]);
+	}
+
+	k_msleep(CONFIG_SCHED_BENCHMARK_SMP_DURATION_MS);
+
+	atomic_set(&running, 0);
+
+	for (int i = 0; i < NUM_PAIRS; i++) {
+		k_sem_give(&pairs[i].sem[0]);
+		k_sem_give(&pairs[i].sem[1]);
+	}
+
+	for (int i = 0; i < NUM_THREADS; i++) {
+		k_thread_join(&threads[i], K_FOREVER);
+	}
+
+	for (int cpu = 0; cpu < NUM_CPUS; cpu++) {
+		uint64_t count = 0U;
+
+		for (int i = 0; i < NUM_THREADS; i++) {
+			count += switches[i][cpu];
+		}
+		total += count;
+
+		printk("cpu %d: %llu switches/s\n", cpu,
+		       (count * MSEC_PER_SEC) / CONFIG_SCHED_BENCHMARK_SMP_DURATION_MS);
+	}
+
+	printk("total: %llu switches/s\n",
+	       (total * MSEC_PER_SEC) / CONFIG_SCHED_BENCHMARK_SMP_DURATION_MS);
+	printk("fin\n");
+	return 0;
+}
@@ -69,6 +69,61 @@ void yielder_entry(void *_thread, void *_tid, void *_nb_threads)
 
 static k_tid_t threads[MAX_NB_THREADS];
 
+K_APP_BMEM(app_1_partition) SYS_MUTEX_DEFINE(bench_mutex);
+K_APP_DMEM(app_1_partition) SYS_SEM_DEFINE(bench_sem, 1, 1);
+
+void sync_entry(void *_thread, void *_func, void *p3)
+{
+	struct k_app_thread *thread = (struct k_app_thread *) _thread;
+	k_thread_entry_t func = (k_thread_entry_t)_func;
+	int ret;
+
+	struct k_mem_partition *parts[] = {
+		thread->partition,
+	};
+
+	ret = k_mem_domain_init(&thread->domain, ARRAY_SIZE(parts), parts);
+	if (ret != 0) {
+		printk("k_mem_domain_init failed %d\n", ret);
+		yielder_status = 1;
+		return;
+	}
+
+	k_mem_domain_add_thread(&thread->domain, k_current_get());
+
+	k_thread_user_mode_enter(func, NULL, NULL, NULL);
+}
+
+/* Runs one user thread in the memory domain holding the mutex and the
+ * semaphore, which are never contended.
+ */
+static int exec_sync_test(const char *name, k_thread_entry_t func)
+{
+	yielder_status = 0;
+
+	app_threads[0].partition = app_partitions[0];
+	app_threads[0].stack = &app_thread_stacks[0];
+
+	threads[0] = k_thread_create(&app_threads[0].thread, app_thread_stacks[0],
+				     APP_STACKSIZE, sync_entry, &app_threads[0],
+				     (void *)func, NULL, THREADS_PRIO, 0, K_FOREVER);
+
+	k_thread_priority_set(k_current_get(), MAIN_PRIO);
+
+	stamp(MEAS_START);
+	k_thread_start(threads[0]);
+	k_thread_join(threads[0], K_FOREVER);
+	stamp(MEAS_END);
+
+	uint32_t full_time = stamps[MEAS_END] - stamps[MEAS_START];
+	uint64_t time_ns = k_cyc_to_ns_near64(full_time)/NB_SYNC_OPS;
+
+	printk("%-32s %8" PRIu32 " cyc & %6" PRIu32 " rounds -> %6"
+	       PRIu64 " ns per round\n", name, full_time, NB_SYNC_OPS, time_ns);
+
+	return yielder_status;
+}
+
 static int exec_test(uint8_t nb_threads)
 {
 	if (nb_threads > MAX_NB_THREADS) {
@@ -136,6 +191,17 @@ int main(void)
 		}
 	}
 
+	printk("============================\n");
+	printk("uncontended user mode synchronization\n");
+
+	ret = exec_sync_test("sys_mutex lock/unlock (atomic)", sync_mutex_atomic);
+	ret |= exec_sync_test("sys_mutex lock/unlock (syscall)", sync_mutex_syscall);
+	ret |= exec_sync_test("sys_sem take/give (atomic)", sync_sem_atomic);
+	if (ret != 0) {
+		printk("FAIL\n");
+		return 0;
+	}
+
 	printk("SUCCESS\n");
 	return 0;
 }
@@ -19,3 +19,29 @@ void context_switch_yield(void *p1, void *p2, void *p3)
 		k_yield();
 	}
 }
+
+/* Uncontended, so this never leaves user mode */
+void sync_mutex_atomic(void *p1, void *p2, void *p3)
+{
+	for (uint32_t i = 0; i < NB_SYNC_OPS; i++) {
+		(void)sys_mutex_lock(&bench_mutex, K_FOREVER);
+		(void)sys_mutex_unlock(&bench_mutex);
+	}
+}
+
+/* What the same takes through system calls */
+void sync_mutex_syscall(void *p1, void *p2, void *p3)
+{
+	for (uint32_t i = 0; i < NB_SYNC_OPS; i++) {
+		(void)z_sys_mutex_kernel_lock(&bench_mutex, K_FOREVER);
+		(void)z_sys_mutex_kernel_unlock(&bench_mutex);
+	}
+}
+
+void sync_sem_atomic(void *p1, void *p2, void *p3)
+{
+	for (uint32_t i = 0; i < NB_SYNC_OPS; i++) {
+		(void)sys_sem_take(&bench_sem, K_FOREVER);
+		(void)sys_sem_give(&bench_sem);
+	}
+}
@@ -4,6 +4,16 @@
  * SPDX-License-Identifier: Apache-2.0
  */
 
+#include <zephyr/sys/mutex.h>
+#include <zephyr/sys/sem.h>
+
 #define NB_YIELDS UINT32_C(1000000)
+#define NB_SYNC_OPS UINT32_C(100000)
+
+extern struct sys_mutex bench_mutex;
+extern struct sys_sem bench_sem;
 
 void context_switch_yield(void *p1, void *p2, void *p3);
+void sync_mutex_atomic(void *p1, void *p2, void *p3);
+void sync_mutex_syscall(void *p1, void *p2, void *p3);
+void sync_sem_atomic(void *p1, void *p2, void *p3);
@@ -0,0 +1,197 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * @file
+ * SMP contention benchmark for the kernel synchronization objects.
+ *
+ * One worker thread per active CPU repeatedly gives and takes a
+ * semaphore (or locks and unlocks a mutex) for a fixed amount of time.
+ * In the "independent" runs every worker uses its own object, so any
+ * loss of scaling as CPUs are added is caused by state shared inside
+ * the kernel (e.g. a file-global spinlock) and not by the application.
+ * The "shared" runs have all workers use one object, as a reference for
+ * true contention, and are repeated with the mutex held for a short
+ * critical section, which is where CONFIG_MUTEX_ADAPTIVE_SPIN matters.
+ * Throughput is reported for 1..N active workers so the scaling with CPU
+ * count can be compared between kernel configurations (e.g. with and
+ * without CONFIG_KERNEL_SYNC_OBJ_LOCKS).
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/atomic.h>
+#include <zephyr/tc_util.h>
+
+#define NUM_CPUS     CONFIG_MP_MAX_NUM_CPUS
+#define STACK_SIZE   (1024 + CONFIG_TEST_EXTRA_STACK_SIZE)
+#define WORKER_PRIO  K_PRIO_PREEMPT(1)
+
+enum bench_obj {
+	BENCH_SEM,
+	BENCH_MUTEX,
+	BENCH_MUTEX_CRITICAL,
+};
+
+static K_THREAD_STACK_ARRAY_DEFINE(worker_stacks, NUM_CPUS, STACK_SIZE);
+static struct k_thread worker_threads[NUM_CPUS];
+
+static struct k_sem sems[NUM_CPUS];
+static struct k_mutex mutexes[NUM_CPUS];
+
+static uint64_t ops[NUM_CPUS];
+static atomic_t running;
+
+/* Touched inside the critical sections */
+static volatile uint32_t shared_data;
+
+static void sem_worker(void *p1, void *p2, void *p3)
+{
+	struct k_sem *sem = p1;
+	uint64_t *count = p2;
+
+	ARG_UNUSED(p3);
+
+	while (atomic_get(&running) != 0) {
+		k_sem_give(sem);
+		(void)k_sem_take(sem, K_NO_WAIT);
+		(*count)++;
+	}
+}
+
+static void mutex_worker(void *p1, void *p2, void *p3)
+{
+	struct k_mutex *mutex = p1;
+	uint64_t *count = p2;
+
+	ARG_UNUSED(p3);
+
+	while (atomic_get(&running) != 0) {
+		(void)k_mutex_lock(mutex, K_FOREVER);
+		(void)k_mutex_unlock(mutex);
+		(*count)++;
+	}
+}
+
+static void mutex_critical_worker(void *p1, void *p2, void *p3)
+{
+	struct k_mutex *mutex = p1;
+	uint64_t *count = p2;
+
+	ARG_UNUSED(p3);
+
+	while (atomic_get(&running) != 0) {
+		(void)k_mutex_lock(mutex, K_FOREVER);
+		for (int i = 0; i < CONFIG_BENCHMARK_CRITICAL_SECTION_LOOPS; i++) {
+			shared_data++;
+		}
+		(void)k_mutex_unlock(mutex);
+		(*count)++;
+	}
+}
+
+static uint64_t run_one(enum bench_obj obj, unsigned int num_workers,
+			bool shared)
+{
+	k_thread_entry_t entry = (obj == BENCH_SEM) ? sem_worker :
+				 (obj == BENCH_MUTEX) ? mutex_worker :
+				 mutex_critical_worker;
+	uint64_t total = 0U;
+	unsigned int i;
+	unsigned int idx;
+
+	atomic_set(&running, 1);
+
+	for (i = 0; i < num_workers; i++) {
+		idx = shared ? 0 : i;
+		ops[i] = 0U;
+
+		k_thread_create(&worker_threads[i], worker_stacks[i],
+				STACK_SIZE, entry,
+				(obj == BENCH_SEM) ? (void *)&sems[idx] :
+						     (void *)&mutexes[idx],
+				&ops[i], NULL, WORKER_PRIO, 0, K_FOREVER);
+#ifdef CONFIG_SCHED_CPU_MASK
+		(void)k_thread_cpu_pin(&worker_threads[i], i);
+#endif /* CONFIG_SCHED_CPU_MASK */
+	}
+
+	for (i = 0; i < num_workers; i++) {
+		k_thread_start(&worker_threads[i]);
+	}
+
+	k_msleep(CONFIG_BENCHMARK_DURATION_MS);
+
+	atomic_set(&running, 0);
+
+	for (i = 0; i < num_workers; i++) {
+		k_thread_join(&worker_threads[i], K_FOREVER);
+		total += ops[i];
+	}
+
+	return (total * MSEC_PER_SEC) / CONFIG_BENCHMARK_DURATION_MS;
+}
+
+static void report(const char *tag, const char *desc, unsigned int num_workers,
+		   uint64_t ops_per_sec, uint64_t baseline)
+{
+	uint32_t scale_pct = (baseline != 0U) ?
+			     (uint32_t)((ops_per_sec * 100U) / baseline) : 0U;
+
+#ifdef CONFIG_BENCHMARK_RECORDING
+	printk("REC: %s - %u threads : %llu ops/s\n", tag, num_workers,
+	       ops_per_sec);
+#else
+	ARG_UNUSED(tag);
+#endif /* CONFIG_BENCHMARK_RECORDING */
+
+	printk("%-40s %u threads : %10llu ops/s (%3u%% of 1 thread)\n",
+	       desc, num_workers, ops_per_sec, scale_pct);
+}
+
+static void run_series(enum bench_obj obj, bool shared, const char *tag,
+		       const char *desc)
+{
+	uint64_t baseline = 0U;
+	uint64_t result;
+
+	for (unsigned int n = 1; n <= NUM_CPUS; n++) {
+		result = run_one(obj, n, shared);
+		if (n == 1) {
+			baseline = result;
+		}
+		report(tag, desc, n, result, baseline);
+	}
+}
+
+int main(void)
+{
+	for (unsigned int i = 0; i < NUM_CPUS; i++) {
+		k_sem_init(&sems[i], 0, 1);
+		k_mutex_init(&mutexes[i]);
+	}
+
+	printk("SMP contention benchmark: %u CPUs, %u ms per run, %s%s\n",
+	       NUM_CPUS, CONFIG_BENCHMARK_DURATION_MS,
+	       IS_ENABLED(CONFIG_KERNEL_SYNC_OBJ_LOCKS) ?
+	       "per-object locks" : "global locks",
+	       IS_ENABLED(CONFIG_MUTEX_ADAPTIVE_SPIN) ?
+	       ", adaptive mutexes" : "");
+
+	run_series(BENCH_SEM, false, "sem.independent",
+		   "k_sem give/take, independent objects");
+	run_series(BENCH_SEM, true, "sem.shared",
+		   "k_sem give/take, shared object");
+	run_series(BENCH_MUTEX, false, "mutex.independent",
+		   "k_mutex lock/unlock, independent objects");
+	run_series(BENCH_MUTEX, true, "mutex.shared",
+		   "k_mutex lock/unlock, shared object");
+	run_series(BENCH_MUTEX_CRITICAL, true, "mutex.shared.critical",
+		   "k_mutex critical section, shared object");
+
+	TC_END_REPORT(0);
+
+	return 0;
+}
@@ -0,0 +1,219 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * @file
+ * This file contains tests that measure the cost of arming, querying and
+ * cancelling kernel timeouts while a large number of them are pending.
+ * The timeouts are bare struct _timeout objects handed directly to the
+ * timeout queue, so no thread or k_timer bookkeeping is included in the
+ * measurements.  All of them are far enough in the future to never expire
+ * during the benchmark.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/timing/timing.h>
+#include <zephyr/tc_util.h>
+#include <timeout_q.h>
+
+#define NUM_TIMEOUTS CONFIG_BENCHMARK_NUM_TIMEOUTS
+
+/* At least 10 seconds out, spread over about 2^20 ticks */
+#define MIN_TICKS   (10 * CONFIG_SYS_CLOCK_TICKS_PER_SEC)
+#define SPREAD_MASK (BIT(20) - 1)
+
+static struct _timeout timeouts[NUM_TIMEOUTS];
+static k_ticks_t durations[NUM_TIMEOUTS];
+static uint32_t order[NUM_TIMEOUTS];
+
+static uint32_t rand_state = 0x12345678U;
+static unsigned int num_expired;
+static int status = TC_PASS;
+
+static uint32_t next_rand(void)
+{
+	/* Fixed xorshift sequence so every backend sees the same input */
+	rand_state ^= rand_state << 13;
+	rand_state ^= rand_state >> 17;
+	rand_state ^= rand_state << 5;
+
+	return rand_state;
+}
+
+static void timeout_handler(struct _timeout *t)
+{
+	ARG_UNUSED(t);
+
+	num_expired++;
+}
+
+static void shuffle_order(void)
+{
+	for (uint32_t i = 0; i < NUM_TIMEOUTS; i++) {
+		order[i] = i;
+	}
+
+	for (uint32_t i = NUM_TIMEOUTS - 1; i > 0; i--) {
+		uint32_t j = next_rand() % (i + 1);
+		uint32_t tmp = order[i];
+
+		order[i] = order[j];
+		order[j] = tmp;
+	}
+}
+
+static uint64_t arm_all(void)
+{
+	timing_t start;
+	timing_t finish;
+
+	start = timing_counter_get();
+	for (uint32_t i = 0; i < NUM_TIMEOUTS; i++) {
+		z_add_timeout(&timeouts[i], timeout_handler, K_TICKS(durations[i]));
+	}
+	finish = timing_counter_get();
+
+	return timing_cycles_get(&start, &finish);
+}
+
+static uint64_t query_all(void)
+{
+	timing_t start;
+	timing_t finish;
+	k_ticks_t sum = 0;
+
+	start = timing_counter_get();
+	for (uint32_t i = 0; i < NUM_TIMEOUTS; i++) {
+		sum += z_timeout_remaining(&timeouts[order[i]]);
+	}
+	finish = timing_counter_get();
+
+	if (sum <= 0) {
+		TC_ERROR("timeouts not pending\n");
+		status = TC_FAIL;
+	}
+
+	return timing_cycles_get(&start, &finish);
+}
+
+static uint64_t next_expiry_all(void)
+{
+	timing_t start;
+	timing_t finish;
+	int32_t min = INT32_MAX;
+
+	start = timing_counter_get();
+	for (uint32_t i = 0; i < NUM_TIMEOUTS; i++) {
+		min = MIN(min, z_get_next_timeout_expiry());
+	}
+	finish = timing_counter_get();
+
+	ARG_UNUSED(min);
+
+	return timing_cycles_get(&start, &finish);
+}
+
+static uint64_t cancel_all(void)
+{
+	timing_t start;
+	timing_t finish;
+	int failed = 0;
+
+	start = timing_counter_get();
+	for (uint32_t i = 0; i < NUM_TIMEOUTS; i++) {
+		failed |= z_abort_timeout(&timeouts[order[i]]);
+	}
+	finish = timing_counter_get();
+
+	if (failed != 0) {
+		TC_ERROR("timeout was not pending\n");
+		status = TC_FAIL;
+	}
+
+	return timing_cycles_get(&start, &finish);
+}
+
+static void report(const char *tag, const char *str, uint64_t cycles)
+{
+	uint64_t ops = (uint64_t)NUM_TIMEOUTS * CONFIG_BENCHMARK_NUM_ITERATIONS;
+	uint64_t average = cycles / ops;
+	uint32_t nsec = (uint32_t)timing_cycles_to_ns_avg(cycles, ops);
+
+#ifdef CONFIG_BENCHMARK_RECORDING
+	printk("REC: %-40s - %-50s : %7llu cycles , %7u ns :\n", tag, str,
+	       average, nsec);
+#else
+	ARG_UNUSED(tag);
+
+	printk("%-60s : %7llu cycles (%7u nsec)\n", str, average, nsec);
+#endif
+}
+
+int main(void)
+{
+	uint64_t arm_sorted = 0;
+	uint64_t arm_random = 0;
+	uint64_t query = 0;
+	uint64_t next_expiry = 0;
+	uint64_t cancel = 0;
+
+	timing_init();
+
+	printk("Time Measurements for %u timeouts, %s timeout queue\n",
+	       NUM_TIMEOUTS, IS_ENABLED(CONFIG_TIMEOUT_QUEUE_WHEEL) ?
+	       "timing wheel" : "delta list");
+	printk("Timing results: Clock frequency: %u MHz\n",
+	       timing_freq_get_mhz());
+
+	for (uint32_t i = 0; i < NUM_TIMEOUTS; i++) {
+		z_init_timeout(&timeouts[i]);
+	}
+
+	timing_start();
+
+	for (int iter = 0; iter < CONFIG_BENCHMARK_NUM_ITERATIONS; iter++) {
+		/* Increasing durations: every timeout lands behind all
+		 * the pending ones.
+		 */
+		for (uint32_t i = 0; i < NUM_TIMEOUTS; i++) {
+			durations[i] = MIN_TICKS +
+				       (k_ticks_t)(((uint64_t)i * SPREAD_MASK) / NUM_TIMEOUTS);
+		}
+		shuffle_order();
+
+		arm_sorted += arm_all();
+		cancel += cancel_all();
+
+		for (uint32_t i = 0; i < NUM_TIMEOUTS; i++) {
+			durations[i] = MIN_TICKS + (next_rand() & SPREAD_MASK);
+		}
+		shuffle_order();
+
+		arm_random += arm_all();
+		query += query_all();
+		next_expiry += next_expiry_all();
+		cancel += cancel_all();
+	}
+
+	timing_stop();
+
+	report("timeout.add.increasing", "Arm timeout, increasing durations",
+	       arm_sorted);
+	report("timeout.add.random", "Arm timeout, random durations", arm_random);
+	report("timeout.remaining", "Query remaining time of timeout", query);
+	report("timeout.next_expiry", "Get next timeout expiry", next_expiry);
+	report("timeout.abort.random", "Cancel timeout, random order",
+	       cancel / 2);
+
+	if (num_expired != 0) {
+		TC_ERROR("%u timeouts expired\n", num_expired);
+		status = TC_FAIL;
+	}
+
+	TC_END_REPORT(status);
+
+	return 0;
+}
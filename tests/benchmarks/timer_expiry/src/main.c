@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * @file
+ * This file contains a benchmark that shows on which CPUs the expiry
+ * functions of a set of periodic timers run, and how many expirations
+ * are lost because the expiry functions can't keep up.  The timers are
+ * spread evenly over the CPUs with k_timer_cpu_set() when available.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/tc_util.h>
+
+#define NUM_TIMERS  CONFIG_BENCHMARK_NUM_TIMERS
+#define PERIOD_MS   CONFIG_BENCHMARK_TIMER_PERIOD_MS
+#define WORK_US     CONFIG_BENCHMARK_EXPIRY_WORK_US
+#define DURATION_MS CONFIG_BENCHMARK_DURATION_MS
+
+static struct k_timer timers[NUM_TIMERS];
+static atomic_t expiries[CONFIG_MP_MAX_NUM_CPUS];
+
+static int status = TC_PASS;
+
+static void expiry_fn(struct k_timer *timer)
+{
+	ARG_UNUSED(timer);
+
+	atomic_inc(&expiries[arch_curr_cpu()->id]);
+	k_busy_wait(WORK_US);
+}
+
+static void report(const char *tag, const char *str, uint32_t count)
+{
+#ifdef CONFIG_BENCHMARK_RECORDING
+	printk("REC: %-40s - %-50s : %7u expiries\n", tag, str, count);
+#else
+	ARG_UNUSED(tag);
+
+	printk("%-60s : %7u expiries\n", str, count);
+#endif
+}
+
+int main(void)
+{
+	unsigned int num_cpus = arch_num_cpus();
+	uint32_t expected = 0;
+	uint32_t handled = 0;
+	char tag[40];
+	char str[60];
+
+	printk("Timer expiry measurements: %u timers, %u ms period, %u us work, %u CPUs\n",
+	       NUM_TIMERS, PERIOD_MS, WORK_US, num_cpus);
+
+	for (int i = 0; i < NUM_TIMERS; i++) {
+		k_timer_init(&timers[i], expiry_fn, NULL);
+#ifdef CONFIG_TIMER_CPU_EXPIRY
+		if (k_timer_cpu_set(&timers[i], i % num_cpus) != 0) {
+			TC_ERROR("k_timer_cpu_set() failed\n");
+			status = TC_FAIL;
+		}
+#endif
+	}
+
+	for (int i = 0; i < NUM_TIMERS; i++) {
+		k_timer_start(&timers[i], K_MSEC(PERIOD_MS), K_MSEC(PERIOD_MS));
+	}
+
+	k_msleep(DURATION_MS);
+
+	for (int i = 0; i < NUM_TIMERS; i++) {
+		k_timer_stop(&timers[i]);
+		expected += k_timer_status_get(&timers[i]);
+	}
+
+	for (unsigned int cpu = 0; cpu < num_cpus; cpu++) {
+		uint32_t count = (uint32_t)atomic_get(&expiries[cpu]);
+
+		snprintk(tag, sizeof(tag), "timer.expiry.cpu%u", cpu);
+		snprintk(str, sizeof(str), "Expiry functions run on CPU %u", cpu);
+		report(tag, str, count);
+		handled += count;
+	}
+
+	/* The status counts every expiration, the expiry function is run
+	 * only once for several of them when it falls behind.
+	 */
+	report("timer.expiry.lost", "Expirations without their own expiry function",
+	       (expected > handled) ? (expected - handled) : 0);
+
+	if (handled == 0) {
+		TC_ERROR("no expiry function ran\n");
+		status = TC_FAIL;
+	}
+
+	TC_END_REPORT(status);
+
+	return 0;
+}
@@ -0,0 +1,198 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * @file
+ * This file contains a benchmark that measures the throughput of the
+ * kernel work queues when several threads submit work items to them
+ * concurrently.  Every producer owns a fixed set of work items; in each
+ * round it submits all of them to its work queue and waits until the
+ * last one has run.  The work handlers themselves do nothing but count,
+ * so the result is dominated by the cost of submitting, dequeuing and
+ * dispatching work items.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/timing/timing.h>
+#include <zephyr/tc_util.h>
+
+#define NUM_QUEUES     CONFIG_BENCHMARK_NUM_QUEUES
+#define NUM_PRODUCERS  CONFIG_BENCHMARK_NUM_PRODUCERS
+#define NUM_ITEMS      CONFIG_BENCHMARK_ITEMS_PER_ROUND
+#define NUM_ROUNDS     CONFIG_BENCHMARK_NUM_ROUNDS
+
+#define STACK_SIZE     (1024 + CONFIG_TEST_EXTRA_STACK_SIZE)
+
+/* Producers run below the work queues so that submitted items are
+ * picked up as soon as a queue thread's CPU is free.
+ */
+#define QUEUE_PRIO     K_PRIO_PREEMPT(1)
+#define PRODUCER_PRIO  K_PRIO_PREEMPT(2)
+
+struct producer;
+
+struct item {
+	struct k_work work;
+	struct producer *producer;
+};
+
+struct producer {
+	struct item items[NUM_ITEMS];
+	struct k_work *batch[NUM_ITEMS];
+	struct k_work_q *queue;
+	atomic_t remaining;
+	struct k_sem done;
+	bool use_batch;
+};
+
+static K_THREAD_STACK_ARRAY_DEFINE(queue_stacks, NUM_QUEUES, STACK_SIZE);
+static K_THREAD_STACK_ARRAY_DEFINE(producer_stacks, NUM_PRODUCERS, STACK_SIZE);
+
+static struct k_work_q queues[NUM_QUEUES];
+static struct k_thread producer_threads[NUM_PRODUCERS];
+static struct producer producers[NUM_PRODUCERS];
+
+static int status = TC_PASS;
+
+static void work_handler(struct k_work *work)
+{
+	struct item *item = CONTAINER_OF(work, struct item, work);
+	struct producer *p = item->producer;
+
+	if (atomic_dec(&p->remaining) == 1) {
+		k_sem_give(&p->done);
+	}
+}
+
+static void producer_entry(void *p1, void *p2, void *p3)
+{
+	struct producer *p = p1;
+
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	for (int round = 0; round < NUM_ROUNDS; round++) {
+		atomic_set(&p->remaining, NUM_ITEMS);
+
+		if (p->use_batch) {
+			int ret = k_work_submit_batch_to_queue(p->queue, p->batch,
+							       NUM_ITEMS);
+
+			if (ret != NUM_ITEMS) {
+				TC_ERROR("batch submit returned %d\n", ret);
+				status = TC_FAIL;
+				return;
+			}
+		} else {
+			for (int i = 0; i < NUM_ITEMS; i++) {
+				int ret = k_work_submit_to_queue(p->queue,
+								 &p->items[i].work);
+
+				if (ret != 1) {
+					TC_ERROR("submit returned %d\n", ret);
+					status = TC_FAIL;
+					return;
+				}
+			}
+		}
+
+		k_sem_take(&p->done, K_FOREVER);
+	}
+}
+
+static uint64_t run(bool use_batch)
+{
+	timing_t start;
+	timing_t finish;
+
+	for (int n = 0; n < NUM_PRODUCERS; n++) {
+		producers[n].use_batch = use_batch;
+	}
+
+	start = timing_counter_get();
+
+	for (int n = 0; n < NUM_PRODUCERS; n++) {
+		k_thread_create(&producer_threads[n], producer_stacks[n],
+				STACK_SIZE, producer_entry, &producers[n],
+				NULL, NULL, PRODUCER_PRIO, 0, K_NO_WAIT);
+	}
+
+	for (int n = 0; n < NUM_PRODUCERS; n++) {
+		k_thread_join(&producer_threads[n], K_FOREVER);
+	}
+
+	finish = timing_counter_get();
+
+	return timing_cycles_get(&start, &finish);
+}
+
+static void report(const char *tag, const char *str, uint64_t cycles)
+{
+	uint64_t items = (uint64_t)NUM_PRODUCERS * NUM_ITEMS * NUM_ROUNDS;
+	uint64_t nsec = timing_cycles_to_ns(cycles);
+	uint64_t rate = (nsec == 0U) ? 0U : (items * NSEC_PER_SEC) / nsec;
+
+#ifdef CONFIG_BENCHMARK_RECORDING
+	printk("REC: %-40s - %3u producers : %10llu items/s\n", tag,
+	       NUM_PRODUCERS, rate);
+#else
+	ARG_UNUSED(tag);
+
+	printk("%-60s : %10llu items/s\n", str, rate);
+#endif
+}
+
+int main(void)
+{
+	struct k_work_queue_config cfg = {
+		.name = "bench_workq",
+		.batch_size = CONFIG_BENCHMARK_DRAIN_BATCH,
+	};
+	uint64_t single;
+	uint64_t batch;
+
+	timing_init();
+
+	printk("Work queue throughput: %u producers, %u queues, %u CPUs, %s locks,"
+	       " drain batch %u\n", NUM_PRODUCERS, NUM_QUEUES,
+	       arch_num_cpus(),
+	       IS_ENABLED(CONFIG_KERNEL_WORK_QUEUE_LOCKS) ? "per-queue" : "global",
+	       CONFIG_BENCHMARK_DRAIN_BATCH);
+
+	for (int q = 0; q < NUM_QUEUES; q++) {
+		k_work_queue_init(&queues[q]);
+		k_work_queue_start(&queues[q], queue_stacks[q], STACK_SIZE,
+				   QUEUE_PRIO, &cfg);
+	}
+
+	for (int n = 0; n < NUM_PRODUCERS; n++) {
+		struct producer *p = &producers[n];
+
+		p->queue = &queues[n % NUM_QUEUES];
+		k_sem_init(&p->done, 0, 1);
+
+		for (int i = 0; i < NUM_ITEMS; i++) {
+			k_work_init(&p->items[i].work, work_handler);
+			p->items[i].producer = p;
+			p->batch[i] = &p->items[i].work;
+		}
+	}
+
+	timing_start();
+
+	single = run(false);
+	batch = run(true);
+
+	timing_stop();
+
+	report("work_queue.submit.single", "Submit work items one at a time",
+	       single);
+	report("work_queue.submit.batch", "Submit work items as a batch", batch);
+
+	TC_END_REPORT(status);
+
+	return 0;
+}
@@ -0,0 +1,134 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/device.h>
+#include <zephyr/ztest.h>
+
+/* Time each fake slow device waits for its hardware */
+#define SLOW_INIT_MS 20
+
+struct slow_config {
+	int index;
+};
+
+static int64_t slow_start[3];
+static int64_t slow_end[3];
+
+static int slow_driver_init(const struct device *dev)
+{
+	const struct slow_config *config = dev->config;
+
+	slow_start[config->index] = k_uptime_ticks();
+	k_msleep(SLOW_INIT_MS);
+	slow_end[config->index] = k_uptime_ticks();
+
+	return 0;
+}
+
+#define SLOW_DEVICE_DEFINE(n)							\
+	static const struct slow_config slow_config_##n = { .index = n };	\
+	DEVICE_DT_DEFINE(DT_NODELABEL(fakeslow_##n), slow_driver_init,		\
+			 NULL, NULL, &slow_config_##n, POST_KERNEL, 34, NULL);
+
+SLOW_DEVICE_DEFINE(0)
+SLOW_DEVICE_DEFINE(1)
+SLOW_DEVICE_DEFINE(2)
+
+/* As many independent devices as a batch holds, with SYS_INIT() entries,
+ * which are not batched, right before and after them.
+ */
+#define BATCH_DEVICES 32
+
+static ATOMIC_DEFINE(batch_inited, BATCH_DEVICES);
+static int batch_inited_before;
+static int batch_inited_after;
+
+static int batch_count(void)
+{
+	int count = 0;
+
+	for (int i = 0; i < BATCH_DEVICES; i++) {
+		if (atomic_test_bit(batch_inited, i)) {
+			count++;
+		}
+	}
+
+	return count;
+}
+
+static int batch_before_init(void)
+{
+	batch_inited_before = batch_count();
+
+	return 0;
+}
+
+static int batch_after_init(void)
+{
+	batch_inited_after = batch_count();
+
+	return 0;
+}
+
+static int batch_driver_init(const struct device *dev)
+{
+	const struct slow_config *config = dev->config;
+
+	atomic_set_bit(batch_inited, config->index);
+
+	return 0;
+}
+
+#define BATCH_DEVICE_DEFINE(n, _)							static const struct slow_config batch_config_##n = { .index = n };		DEVICE_DT_DEFINE(DT_NODELABEL(fakebatch_##n), batch_driver_init,				 NULL, NULL, &batch_config_##n, POST_KERNEL, 36, NULL);
+
+SYS_INIT(batch_before_init, POST_KERNEL, 35);
+LISTIFY(BATCH_DEVICES, BATCH_DEVICE_DEFINE, ())
+SYS_INIT(batch_after_init, POST_KERNEL, 37);
+
+/**
+ * @brief Test device initialization respects devicetree dependencies
+ *
+ * @details fakeslow_2 depends on fakeslow_0, so its init function must only
+ * start after the one of fakeslow_0 has returned. With parallel device
+ * initialization, the independent fakeslow_0 and fakeslow_1 are initialized
+ * at the same time.
+ *
+ * @ingroup kernel_device_tests
+ */
+ZTEST(device, test_device_init_dependencies)
+{
+	for (int i = 0; i < ARRAY_SIZE(slow_end); i++) {
+		zassert_not_equal(slow_end[i], 0, "fakeslow_%d not initialized", i);
+	}
+
+	zassert_true(slow_start[2] >= slow_end[0],
+		     "fakeslow_2 initialized before its dependency");
+
+	if (IS_ENABLED(CONFIG_DEVICE_INIT_PARALLEL)) {
+		zassert_true(MAX(slow_start[0], slow_start[1]) <
+			     MIN(slow_end[0], slow_end[1]),
+			     "independent devices not initialized in parallel");
+	}
+}
+
+/**
+ * @brief Test a full batch of devices is initialized
+ *
+ * @details All the devices of a run of exactly as many independent devices
+ * as a batch holds must be initialized, after the init entry before them
+ * and before the one after them.
+ *
+ * @ingroup kernel_device_tests
+ */
+ZTEST(device, test_device_init_full_batch)
+{
+	zassert_equal(batch_inited_before, 0, "batch initialized too early");
+	zassert_equal(batch_inited_after, BATCH_DEVICES,
+		      "%d of %d batch devices initialized", batch_inited_after,
+		      BATCH_DEVICES);
+	zassert_equal(batch_count(), BATCH_DEVICES);
+}
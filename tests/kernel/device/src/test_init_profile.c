@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/device.h>
+#include <zephyr/init.h>
+#include <zephyr/ztest.h>
+
+#ifdef CONFIG_INIT_PROFILING
+
+/* See test_init_parallel.c */
+#define SLOW_INIT_NS (20 * NSEC_PER_MSEC)
+
+struct profile_check {
+	uint64_t prev_ns;
+	int count;
+	int slow_count;
+	bool null_driver_found;
+};
+
+static bool check_profile(const struct sys_init_profile *profile, void *user_data)
+{
+	struct profile_check *check = user_data;
+
+	zassert_not_null(profile->name);
+	zassert_true(profile->measured);
+	zassert_true(profile->level > INIT_LEVEL_ORD(PRE_KERNEL_2));
+
+	if (strncmp(profile->name, "fakeslow_", strlen("fakeslow_")) == 0) {
+		zassert_equal(profile->level, INIT_LEVEL_ORD(POST_KERNEL));
+		zassert_true(profile->duration_ns >= SLOW_INIT_NS,
+			     "%s took %llu ns", profile->name, profile->duration_ns);
+		check->slow_count++;
+	}
+
+	if (strcmp(profile->name, "null_driver_init") == 0) {
+		zassert_equal(profile->result, -EINVAL);
+		check->null_driver_found = true;
+	}
+
+	if (check->count > 0) {
+		zassert_true(profile->duration_ns <= check->prev_ns,
+			     "init entries not ranked by duration");
+	}
+	check->prev_ns = profile->duration_ns;
+	check->count++;
+
+	return true;
+}
+
+static bool count_profile(const struct sys_init_profile *profile, void *user_data)
+{
+	int *count = user_data;
+
+	/* Timing functions are started after the PRE_KERNEL_2 level */
+	zassert_equal(profile->measured, profile->level > INIT_LEVEL_ORD(PRE_KERNEL_2),
+		      "%s measured at level %d", profile->name, profile->level);
+	if (profile->measured) {
+		(*count)++;
+	}
+
+	return true;
+}
+
+static bool stop_profile(const struct sys_init_profile *profile, void *user_data)
+{
+	int *count = user_data;
+
+	return ++(*count) < 2;
+}
+
+/**
+ * @brief Test measuring the duration of init entries
+ *
+ * @details Checks that the slow devices are measured as taking at least the
+ * time they sleep for, that results of SYS_INIT() entries are recorded, that
+ * init entries are ranked by duration, and that only those run once the
+ * timing functions are started are measured.
+ *
+ * @ingroup kernel_device_tests
+ */
+ZTEST(device, test_init_profile)
+{
+	struct profile_check check = { 0 };
+	int count = 0;
+
+	sys_init_profile_foreach_ranked(check_profile, &check);
+	zassert_equal(check.slow_count, 3);
+	zassert_true(check.null_driver_found);
+
+	sys_init_profile_foreach(count_profile, &count);
+	zassert_equal(count, check.count);
+
+	count = 0;
+	sys_init_profile_foreach_ranked(stop_profile, &count);
+	zassert_equal(count, 2);
+
+	zassert_str_equal(sys_init_level_name(INIT_LEVEL_ORD(APPLICATION)),
+			  "APPLICATION");
+	zassert_str_equal(sys_init_level_name(-1), "unknown");
+}
+
+#endif /* CONFIG_INIT_PROFILING */
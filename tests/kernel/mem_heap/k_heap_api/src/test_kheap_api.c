@@ -265,3 +265,94 @@ ZTEST(k_heap_api, test_k_heap_alloc_pending_null)
 
 	k_heap_free(&k_heap_test, p);
 }
+
+/**
+ * @brief Test the per-CPU caches of small heap blocks
+ *
+ * @details Fill the heap with small blocks and free them again, which
+ * leaves some of them in the cache of the current CPU.  Verify that the
+ * block freed last is handed out first, and that a large allocation
+ * still succeeds by returning the cached blocks to the heap.
+ *
+ * @ingroup kernel_heap_tests
+ */
+ZTEST(k_heap_api, test_k_heap_cache)
+{
+	Z_TEST_SKIP_IFNDEF(CONFIG_KERNEL_HEAP_CACHE);
+
+	static void *blocks[HEAP_SIZE / 16];
+	size_t n;
+	void *p;
+
+	for (n = 0; n < ARRAY_SIZE(blocks); n++) {
+		blocks[n] = k_heap_alloc(&k_heap_test, 16, K_NO_WAIT);
+		if (blocks[n] == NULL) {
+			break;
+		}
+	}
+	zassert_true(n > 0, "k_heap_alloc operation failed");
+
+	p = k_heap_alloc(&k_heap_test, ALLOC_SIZE_1, K_NO_WAIT);
+	zassert_is_null(p, "k_heap_alloc should fail but did not");
+
+	for (size_t i = 0; i < n; i++) {
+		k_heap_free(&k_heap_test, blocks[i]);
+	}
+
+	p = k_heap_alloc(&k_heap_test, 16, K_NO_WAIT);
+	zassert_equal(p, blocks[n - 1], "cached block not reused");
+	k_heap_free(&k_heap_test, p);
+
+	p = k_heap_alloc(&k_heap_test, ALLOC_SIZE_2, K_NO_WAIT);
+	zassert_not_null(p, "cached blocks not returned to the heap");
+	k_heap_free(&k_heap_test, p);
+}
+
+static void thread_alloc_heap_forever(void *p1, void *p2, void *p3)
+{
+	char *p = (char *)k_heap_alloc(&k_heap_test, ALLOC_SIZE_1, K_FOREVER);
+
+	zassert_not_null(p, "k_heap_alloc failed to allocate memory");
+
+	k_heap_free(&k_heap_test, p);
+}
+
+/**
+ * @brief Test that small blocks freed while a thread waits wake it up
+ *
+ * @details Fill the heap with small blocks, then run a child thread which
+ * waits forever for a large allocation.  Small blocks freed while it waits
+ * must go back to the heap instead of the per-CPU cache, so that the child
+ * thread is woken up and its allocation succeeds.
+ *
+ * @ingroup kernel_heap_tests
+ */
+ZTEST(k_heap_api, test_k_heap_cache_pending)
+{
+	Z_TEST_SKIP_IFNDEF(CONFIG_KERNEL_HEAP_CACHE);
+
+	static void *blocks[HEAP_SIZE / 16];
+	size_t n;
+
+	for (n = 0; n < ARRAY_SIZE(blocks); n++) {
+		blocks[n] = k_heap_alloc(&k_heap_test, 16, K_NO_WAIT);
+		if (blocks[n] == NULL) {
+			break;
+		}
+	}
+	zassert_true(n > 0, "k_heap_alloc operation failed");
+
+	/* Create a thread which will pend on allocation */
+	k_tid_t tid = k_thread_create(&tdata, tstack, STACK_SIZE,
+				      thread_alloc_heap_forever, NULL, NULL, NULL,
+				      K_PRIO_PREEMPT(5), 0, K_NO_WAIT);
+
+	/* Sleep long enough for child thread to go into pending */
+	k_msleep(5);
+
+	for (size_t i = 0; i < n; i++) {
+		k_heap_free(&k_heap_test, blocks[i]);
+	}
+
+	zassert_ok(k_thread_join(tid, K_MSEC(1000)), "allocating thread not woken up");
+}
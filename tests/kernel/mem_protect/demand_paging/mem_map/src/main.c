@@ -113,6 +113,29 @@ static void print_paging_stats(struct k_mem_paging_stats_t *stats, const char *s
 	       stats->eviction.clean);
 	printk("    - Dirty pages evicted: %lu\n",
 	       stats->eviction.dirty);
+
+#if defined(CONFIG_EVICTION_CLOCK_PRO) || defined(CONFIG_EVICTION_ARC)
+	printk("* Eviction policy (%s):\n", scope);
+	printk("    - Hits: %lu\n", stats->policy.hit);
+	printk("    - Misses: %lu\n", stats->policy.miss);
+	printk("    - Thrashing: %lu\n", stats->policy.thrash);
+#endif
+
+#ifdef CONFIG_DEMAND_PAGING_READ_AHEAD
+	printk("* Read-ahead (%s):\n", scope);
+	printk("    - Batches: %lu\n", stats->read_ahead.batches);
+	printk("    - Pages: %lu\n", stats->read_ahead.pages);
+#endif
+
+#ifdef CONFIG_BACKING_STORE_RAM_COMPRESSED
+	printk("* Compression (%s):\n", scope);
+	printk("    - Compressed pages: %lu\n", stats->compression.compressed);
+	printk("    - Compressed bytes: %llu\n", stats->compression.compressed_bytes);
+	printk("    - Incompressible pages: %lu\n", stats->compression.incompressible);
+	printk("    - Decompressed pages: %lu\n", stats->compression.decompressed);
+	printk("    - Compression cycles: %llu\n", stats->compression.compress_cycles);
+	printk("    - Decompression cycles: %llu\n", stats->compression.decompress_cycles);
+#endif
 }
 
 static void touch_anon_pages(bool zig, bool zag)
@@ -184,6 +207,14 @@ static void touch_anon_pages(bool zig, bool zag)
 	print_paging_stats(&stats, "kernel");
 	zassert_not_equal(stats.eviction.clean, 0UL,
 			  "there should be clean pages being evicted.");
+#if defined(CONFIG_EVICTION_CLOCK_PRO) || defined(CONFIG_EVICTION_ARC)
+	zassert_not_equal(stats.policy.miss, 0UL,
+			  "paged in pages should be counted by the eviction algorithm.");
+#endif
+#ifdef CONFIG_BACKING_STORE_RAM_COMPRESSED
+	zassert_not_equal(stats.compression.compressed + stats.compression.incompressible,
+			  0UL, "paged out pages should go through compression.");
+#endif
 
 	/* per-thread statistics */
 	printk("\nPaging stats for current thread (%p):\n", tid);
@@ -252,9 +283,16 @@ static void test_k_mem_page_out(void)
 	faults = k_mem_num_pagefaults_get() - faults;
 	irq_unlock(key);
 
+#ifdef CONFIG_DEMAND_PAGING_READ_AHEAD
+	/* Sequential writes trigger read-ahead, saving page faults */
+	zassert_true(faults > 0 && faults < HALF_PAGES,
+		     "unexpected num pagefaults expected less than %lu got %d",
+		     HALF_PAGES, faults);
+#else
 	zassert_equal(faults, HALF_PAGES,
 		      "unexpected num pagefaults expected %lu got %d",
 		      HALF_PAGES, faults);
+#endif
 
 	ret = k_mem_page_out(arena, arena_size);
 	zassert_equal(ret, -ENOMEM, "k_mem_page_out should have failed");
@@ -288,6 +326,56 @@ ZTEST(demand_paging_api, test_k_mem_page_in)
 		      faults);
 }
 
+/* Data which does not compress, depending on its index only */
+static uint32_t incompressible(size_t i)
+{
+	uint32_t val = (i + 1) * 2654435761U;
+
+	val ^= val << 13;
+	val ^= val >> 17;
+	val ^= val << 5;
+
+	return val;
+}
+
+/* Show that page faults can still be handled once the compressed backing
+ * store pool is full of data pages which do not compress, with evictions
+ * competing for the room page faults free.
+ */
+ZTEST(demand_paging_api, test_k_mem_page_out_incompressible)
+{
+	uint32_t *arena_val = (uint32_t *)arena;
+	size_t count = arena_size / sizeof(uint32_t);
+
+	Z_TEST_SKIP_IFNDEF(CONFIG_BACKING_STORE_RAM_COMPRESSED);
+
+	for (size_t i = 0; i < count; i++) {
+		arena_val[i] = incompressible(i);
+	}
+
+	for (int round = 0; round < 3; round++) {
+		/* Page out as much as the pool holds */
+		for (size_t offset = 0; offset < arena_size;
+		     offset += CONFIG_MMU_PAGE_SIZE) {
+			(void)k_mem_page_out(arena + offset, CONFIG_MMU_PAGE_SIZE);
+		}
+
+		for (size_t i = 0; i < count; i++) {
+			zassert_equal(arena_val[i], incompressible(i),
+				      "arena corrupted at index %zu: got 0x%x",
+				      i, arena_val[i]);
+		}
+	}
+
+#ifdef CONFIG_BACKING_STORE_RAM_COMPRESSED
+	struct k_mem_paging_stats_t stats;
+
+	k_mem_paging_stats_get(&stats);
+	zassert_not_equal(stats.compression.incompressible, 0UL,
+			  "data pages should have been stored as is.");
+#endif
+}
+
 ZTEST(demand_paging_api, test_k_mem_pin)
 {
 	unsigned long faults;
@@ -328,6 +416,10 @@ ZTEST(demand_paging_api, test_k_mem_unpin)
 	test_k_mem_page_out();
 }
 
+/* Anonymous memory mapped to fill the backing store */
+static char *capacity_mem;
+static size_t capacity_size;
+
 /* Show that even if we map enough anonymous memory to fill the backing
  * store, we can still handle pagefaults.
  * This eats up memory so should be last in the suite.
@@ -342,6 +434,8 @@ ZTEST(demand_paging_stat, test_backing_store_capacity)
 
 	/* Consume the rest of memory */
 	mem = k_mem_map(size, K_MEM_PERM_RW);
+	capacity_mem = mem;
+	capacity_size = size;
 	zassert_not_null(mem, "k_mem_map failed");
 
 	if (!IS_ENABLED(CONFIG_DEMAND_MAPPING)) {
@@ -369,6 +463,52 @@ ZTEST(demand_paging_stat, test_backing_store_capacity)
 	zassert_not_equal(faults, 0, "should have had some pagefaults");
 }
 
+static void fill_ptrs(char *mem, size_t size)
+{
+	void **mem_ptr = (void **)mem;
+
+	for (size_t i = 0; i < size / sizeof(void *); i++) {
+		mem_ptr[i] = &mem_ptr[i];
+	}
+}
+
+static void check_ptrs(char *mem, size_t size)
+{
+	void **mem_ptr = (void **)mem;
+
+	for (size_t i = 0; i < size / sizeof(void *); i++) {
+		zassert_equal(mem_ptr[i], &mem_ptr[i],
+			      "memory corrupted at %p: got %p",
+			      &mem_ptr[i], mem_ptr[i]);
+	}
+}
+
+/* Show that data pages are preserved while the backing store is full.
+ * Reading them back sequentially triggers read-ahead, which then cannot
+ * get backing store locations for the data pages it would evict.
+ */
+ZTEST(demand_paging_stat, test_backing_store_full_read_back)
+{
+#ifdef CONFIG_BACKING_STORE_RAM_COMPRESSED
+	/* The pool may not hold a full backing store of such data. When
+	 * sized by default, it expects data pages to compress to half.
+	 */
+	if ((CONFIG_BACKING_STORE_RAM_COMPRESSED_POOL_SIZE == 0) ||
+	    (CONFIG_BACKING_STORE_RAM_COMPRESSED_POOL_SIZE <
+	     CONFIG_BACKING_STORE_RAM_PAGES * CONFIG_MMU_PAGE_SIZE)) {
+		ztest_test_skip();
+	}
+#endif
+
+	zassert_not_null(capacity_mem, "backing store not filled");
+
+	fill_ptrs(arena, arena_size);
+	fill_ptrs(capacity_mem, capacity_size);
+
+	check_ptrs(arena, arena_size);
+	check_ptrs(capacity_mem, capacity_size);
+}
+
 /* Test if we can get paging statistics under usermode */
 ZTEST_USER(demand_paging_stat, test_user_get_stats)
 {
@@ -449,6 +589,12 @@ ZTEST_USER(demand_paging_stat, test_user_get_hist)
 	zassert_true(print_histogram(&hist),
 		     "should have non-zero counts in histogram.");
 	printk("\n");
+
+	printk("Page Fault Histogram:\n");
+	k_mem_paging_histogram_page_fault_get(&hist);
+	zassert_true(print_histogram(&hist),
+		     "should have non-zero counts in histogram.");
+	printk("\n");
 }
 
 void *demand_paging_api_setup(void)
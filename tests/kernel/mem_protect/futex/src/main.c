@@ -420,6 +420,61 @@ ZTEST(futex, test_multiple_futex_wait_wake)
 	}
 }
 
+static ZTEST_BMEM atomic_t requeue_woken;
+
+static void futex_requeue_wait_task(void *p1, void *p2, void *p3)
+{
+	int ret_value;
+
+	ret_value = k_futex_wait(&multiple_futex[0], 1, K_FOREVER);
+	zassert_equal(ret_value, 0, "k_futex_wait failed");
+
+	atomic_inc(&requeue_woken);
+}
+
+ZTEST(futex, test_futex_requeue)
+{
+	int ret;
+
+	atomic_clear(&requeue_woken);
+	atomic_set(&multiple_futex[0].val, 1);
+	atomic_set(&multiple_futex[1].val, 1);
+
+	for (int i = 0; i < TOTAL_THREADS_WAITING; i++) {
+		k_thread_create(&multiple_tid[i], multiple_stack[i],
+				STACK_SIZE, futex_requeue_wait_task,
+				NULL, NULL, NULL, PRIO_WAIT,
+				K_USER | K_INHERIT_PERMS, K_NO_WAIT);
+	}
+
+	ret = k_futex_requeue(&multiple_futex[0], &multiple_futex[0], 1, 1, UINT_MAX);
+	zassert_equal(ret, -EINVAL, "requeued to the same futex");
+
+	ret = k_futex_requeue(&multiple_futex[0], &multiple_futex[1], 0, 1, UINT_MAX);
+	zassert_equal(ret, -EAGAIN, "requeued when values did not match");
+
+	/* One thread woken up, the others moved without waking up */
+	ret = k_futex_requeue(&multiple_futex[0], &multiple_futex[1], 1, 1, UINT_MAX);
+	zassert_equal(ret, TOTAL_THREADS_WAITING, "not all threads woken or moved");
+
+	k_yield();
+	zassert_equal(atomic_get(&requeue_woken), 1, "requeued threads woken");
+
+	ret = k_futex_wake(&multiple_futex[0], true);
+	zassert_equal(ret, 0, "threads left on the original futex");
+
+	ret = k_futex_wake(&multiple_futex[1], true);
+	zassert_equal(ret, TOTAL_THREADS_WAITING - 1, "threads not moved to target");
+
+	k_yield();
+	zassert_equal(atomic_get(&requeue_woken), TOTAL_THREADS_WAITING,
+		      "requeued threads not woken");
+
+	for (int i = 0; i < TOTAL_THREADS_WAITING; i++) {
+		k_thread_abort(&multiple_tid[i]);
+	}
+}
+
 ZTEST_USER(futex, test_user_futex_bad)
 {
 	int ret;
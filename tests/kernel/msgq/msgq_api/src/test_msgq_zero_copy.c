@@ -0,0 +1,249 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "test_msgq.h"
+
+#ifdef CONFIG_MSGQ_ZERO_COPY
+
+#define ZC_LEN 4
+
+K_THREAD_STACK_DECLARE(tstack, STACK_SIZE);
+extern struct k_thread tdata;
+static char __aligned(4) zc_buffer[MSG_SIZE * ZC_LEN];
+static struct k_msgq zc_msgq;
+
+static void zc_put(uint32_t value)
+{
+	void *slot;
+
+	zassert_ok(k_msgq_put_claim(&zc_msgq, &slot, K_NO_WAIT));
+	*(uint32_t *)slot = value;
+	zassert_ok(k_msgq_put_commit(&zc_msgq));
+}
+
+static uint32_t zc_get(void)
+{
+	uint32_t value;
+	void *slot;
+
+	zassert_ok(k_msgq_get_claim(&zc_msgq, &slot, K_NO_WAIT));
+	value = *(uint32_t *)slot;
+	zassert_ok(k_msgq_get_finish(&zc_msgq));
+
+	return value;
+}
+
+static void zc_before(void)
+{
+	k_msgq_init(&zc_msgq, zc_buffer, MSG_SIZE, ZC_LEN);
+}
+
+/**
+ * @addtogroup kernel_message_queue_tests
+ * @{
+ */
+
+/**
+ * @brief Test claiming slots and messages in place
+ * @see k_msgq_put_claim(), k_msgq_put_commit(), k_msgq_get_claim(),
+ * k_msgq_get_finish()
+ */
+ZTEST(msgq_api_1cpu, test_msgq_zero_copy)
+{
+	uint32_t data = MSG0;
+	void *slot;
+	void *other;
+
+	zc_before();
+
+	zassert_equal(k_msgq_get_claim(&zc_msgq, &slot, K_NO_WAIT), -ENOMSG);
+	zassert_equal(k_msgq_get_finish(&zc_msgq), -EINVAL);
+	zassert_equal(k_msgq_put_commit(&zc_msgq), -EINVAL);
+
+	/* Claimed slots come before messages sent by copy */
+	zassert_ok(k_msgq_put_claim(&zc_msgq, &slot, K_NO_WAIT));
+	zassert_equal(k_msgq_put_claim(&zc_msgq, &other, K_NO_WAIT), -EBUSY);
+	zassert_equal(k_msgq_put(&zc_msgq, &data, K_NO_WAIT), -EBUSY);
+	zassert_equal(k_msgq_num_used_get(&zc_msgq), 0);
+	*(uint32_t *)slot = MSG1;
+	zassert_ok(k_msgq_put_commit(&zc_msgq));
+	zassert_ok(k_msgq_put(&zc_msgq, &data, K_NO_WAIT));
+	zassert_equal(k_msgq_num_used_get(&zc_msgq), 2);
+
+	/* Claimed messages stay queued until finished */
+	zassert_ok(k_msgq_get_claim(&zc_msgq, &slot, K_NO_WAIT));
+	zassert_equal(*(uint32_t *)slot, MSG1);
+	zassert_equal(k_msgq_get(&zc_msgq, &data, K_NO_WAIT), -EBUSY);
+	zassert_equal(k_msgq_get_claim(&zc_msgq, &other, K_NO_WAIT), -EBUSY);
+	zassert_equal(k_msgq_num_used_get(&zc_msgq), 2);
+	zassert_ok(k_msgq_get_finish(&zc_msgq));
+	zassert_equal(zc_get(), MSG0);
+
+	/* Releasing a claim without committing sends nothing */
+	zassert_ok(k_msgq_put_claim(&zc_msgq, &slot, K_NO_WAIT));
+	zassert_ok(k_msgq_put_commit_batch(&zc_msgq, 0));
+	zassert_equal(k_msgq_num_used_get(&zc_msgq), 0);
+}
+
+/**
+ * @brief Test claiming several slots and messages at once
+ * @see k_msgq_put_claim_batch(), k_msgq_put_commit_batch(),
+ * k_msgq_get_claim_batch(), k_msgq_get_finish_batch()
+ */
+ZTEST(msgq_api_1cpu, test_msgq_zero_copy_batch)
+{
+	uint32_t *slots;
+	int ret;
+
+	zc_before();
+
+	zassert_equal(k_msgq_put_claim_batch(&zc_msgq, (void **)&slots, 0, K_NO_WAIT),
+		      -EINVAL);
+
+	ret = k_msgq_put_claim_batch(&zc_msgq, (void **)&slots, ZC_LEN + 1, K_NO_WAIT);
+	zassert_equal(ret, ZC_LEN);
+	for (int i = 0; i < ret; i++) {
+		slots[i] = i;
+	}
+	zassert_equal(k_msgq_put_commit_batch(&zc_msgq, ZC_LEN + 1), -EINVAL);
+	zassert_ok(k_msgq_put_commit_batch(&zc_msgq, 3));
+	zassert_equal(k_msgq_num_used_get(&zc_msgq), 3);
+
+	/* Finish fewer than claimed: the rest stays queued */
+	ret = k_msgq_get_claim_batch(&zc_msgq, (void **)&slots, ZC_LEN, K_NO_WAIT);
+	zassert_equal(ret, 3);
+	zassert_equal(slots[0], 0);
+	zassert_equal(slots[2], 2);
+	zassert_ok(k_msgq_get_finish_batch(&zc_msgq, 2));
+	zassert_equal(k_msgq_num_used_get(&zc_msgq), 1);
+
+	/* Claimed slots stop at the end of the ring buffer */
+	ret = k_msgq_put_claim_batch(&zc_msgq, (void **)&slots, ZC_LEN, K_NO_WAIT);
+	zassert_equal(ret, 1);
+	slots[0] = 3;
+	zassert_ok(k_msgq_put_commit(&zc_msgq));
+
+	ret = k_msgq_put_claim_batch(&zc_msgq, (void **)&slots, ZC_LEN, K_NO_WAIT);
+	zassert_equal(ret, 2);
+	zassert_equal((char *)slots, zc_buffer);
+	slots[0] = 4;
+	slots[1] = 5;
+	zassert_ok(k_msgq_put_commit_batch(&zc_msgq, 2));
+	zassert_equal(k_msgq_num_free_get(&zc_msgq), 0);
+
+	for (uint32_t i = 2; i < 6; i++) {
+		zassert_equal(zc_get(), i);
+	}
+}
+
+static void zc_producer(void *p1, void *p2, void *p3)
+{
+	k_msleep(TIMEOUT_MS >> 1);
+	zc_put(MSG0);
+}
+
+static void zc_copy_getter(void *p1, void *p2, void *p3)
+{
+	uint32_t data;
+
+	zassert_ok(k_msgq_get(&zc_msgq, &data, TIMEOUT));
+	zassert_equal(data, MSG1);
+}
+
+static void zc_consumer(void *p1, void *p2, void *p3)
+{
+	k_msleep(TIMEOUT_MS >> 1);
+	zassert_equal(zc_get(), 0);
+}
+
+/**
+ * @brief Test waiting for slots and messages to claim
+ * @see k_msgq_put_claim(), k_msgq_get_claim()
+ */
+ZTEST(msgq_api_1cpu, test_msgq_zero_copy_wait)
+{
+	void *slot;
+
+	zc_before();
+
+	zassert_equal(k_msgq_get_claim(&zc_msgq, &slot, TIMEOUT), -EAGAIN);
+
+	/* Woken by a zero-copy producer */
+	k_thread_create(&tdata, tstack, STACK_SIZE, zc_producer, NULL, NULL,
+			NULL, K_PRIO_PREEMPT(0), 0, K_NO_WAIT);
+	zassert_ok(k_msgq_get_claim(&zc_msgq, &slot, K_FOREVER));
+	zassert_equal(*(uint32_t *)slot, MSG0);
+	zassert_ok(k_msgq_get_finish(&zc_msgq));
+	k_thread_join(&tdata, K_FOREVER);
+
+	/* A thread waiting in k_msgq_get() gets the committed message */
+	k_thread_create(&tdata, tstack, STACK_SIZE, zc_copy_getter, NULL, NULL,
+			NULL, K_PRIO_PREEMPT(0), 0, K_NO_WAIT);
+	zc_put(MSG1);
+	k_thread_join(&tdata, K_FOREVER);
+	zassert_equal(k_msgq_num_used_get(&zc_msgq), 0);
+
+	/* Woken by a zero-copy consumer freeing a slot */
+	for (uint32_t i = 0; i < ZC_LEN; i++) {
+		zc_put(i);
+	}
+	zassert_equal(k_msgq_put_claim(&zc_msgq, &slot, TIMEOUT), -EAGAIN);
+	k_thread_create(&tdata, tstack, STACK_SIZE, zc_consumer, NULL, NULL,
+			NULL, K_PRIO_PREEMPT(0), 0, K_NO_WAIT);
+	zassert_ok(k_msgq_put_claim(&zc_msgq, &slot, K_FOREVER));
+	zassert_ok(k_msgq_put_commit_batch(&zc_msgq, 0));
+	k_thread_join(&tdata, K_FOREVER);
+}
+
+/**
+ * @brief Test purging a message queue with claimed messages
+ * @see k_msgq_get_claim(), k_msgq_purge()
+ */
+ZTEST(msgq_api_1cpu, test_msgq_zero_copy_purge)
+{
+	void *slot;
+
+	zc_before();
+
+	zc_put(MSG0);
+	zassert_ok(k_msgq_get_claim(&zc_msgq, &slot, K_NO_WAIT));
+	k_msgq_purge(&zc_msgq);
+	zassert_equal(k_msgq_get_finish(&zc_msgq), -EINVAL);
+
+	zc_put(MSG1);
+	zassert_equal(zc_get(), MSG1);
+}
+
+#ifdef CONFIG_POLL
+/**
+ * @brief Test polling for messages sent in place
+ * @see k_msgq_put_commit(), k_poll()
+ */
+ZTEST(msgq_api_1cpu, test_msgq_zero_copy_poll)
+{
+	struct k_poll_event event = K_POLL_EVENT_INITIALIZER(
+		K_POLL_TYPE_MSGQ_DATA_AVAILABLE, K_POLL_MODE_NOTIFY_ONLY,
+		&zc_msgq);
+
+	zc_before();
+
+	zassert_equal(k_poll(&event, 1, K_NO_WAIT), -EAGAIN);
+
+	k_thread_create(&tdata, tstack, STACK_SIZE, zc_producer, NULL, NULL,
+			NULL, K_PRIO_PREEMPT(0), 0, K_NO_WAIT);
+	zassert_ok(k_poll(&event, 1, TIMEOUT));
+	zassert_equal(event.state, K_POLL_STATE_MSGQ_DATA_AVAILABLE);
+	k_thread_join(&tdata, K_FOREVER);
+
+	zassert_equal(zc_get(), MSG0);
+}
+#endif /* CONFIG_POLL */
+
+/**
+ * @}
+ */
+
+#endif /* CONFIG_MSGQ_ZERO_COPY */
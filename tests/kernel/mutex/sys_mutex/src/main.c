@@ -48,6 +48,7 @@
 #include <zephyr/tc_util.h>
 #include <zephyr/kernel.h>
 #include <zephyr/ztest.h>
+#include <zephyr/ztest_error_hook.h>
 #include <zephyr/sys/mutex.h>
 
 #define STACKSIZE (512 + CONFIG_TEST_EXTRA_STACK_SIZE)
@@ -67,6 +68,10 @@ static SYS_MUTEX_DEFINE(no_access_mutex);
 #endif
 static ZTEST_BMEM SYS_MUTEX_DEFINE(not_my_mutex);
 static ZTEST_BMEM SYS_MUTEX_DEFINE(bad_count_mutex);
+static ZTEST_BMEM SYS_MUTEX_DEFINE(corrupt_mutex);
+static ZTEST_BMEM SYS_MUTEX_DEFINE(shared_mutex);
+static ZTEST_BMEM atomic_t shared_locked;
+static ZTEST_BMEM int contender_rv;
 
 #ifdef CONFIG_USERSPACE
 #define ZTEST_USER_OR_NOT ZTEST_USER
@@ -465,15 +470,135 @@ ZTEST(mutex_complex, test_supervisor_access)
 	zassert_true(rv == -EINVAL, "mutex wasn't locked");
 }
 
+#ifdef CONFIG_USERSPACE
+K_THREAD_STACK_DEFINE(no_access_stack_area, STACKSIZE);
+struct k_thread no_access_thread_data;
+
+static void no_access_entry(void *p1, void *p2, void *p3)
+{
+	bool lock = (bool)(uintptr_t)p1;
+
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	/* Uncontended mutexes are accessed from user mode directly */
+	ztest_set_fault_valid(true);
+	if (lock) {
+		(void)sys_mutex_lock(&no_access_mutex, K_NO_WAIT);
+	} else {
+		(void)sys_mutex_unlock(&no_access_mutex);
+	}
+
+	/* should not go here */
+	ztest_test_fail();
+}
+
+static void no_access_run(bool lock)
+{
+	k_thread_create(&no_access_thread_data, no_access_stack_area, STACKSIZE,
+			no_access_entry, (void *)(uintptr_t)lock, NULL, NULL,
+			K_PRIO_PREEMPT(0), K_USER | K_INHERIT_PERMS, K_NO_WAIT);
+	k_thread_join(&no_access_thread_data, K_FOREVER);
+}
+
+/* Exited before the tests start */
+K_THREAD_STACK_DEFINE(exited_stack_area, STACKSIZE);
+struct k_thread exited_thread_data;
+
+static void exited_entry(void *p1, void *p2, void *p3)
+{
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+}
+
+/* User threads sharing a mutex, with no access to each other */
+K_THREAD_STACK_DEFINE(holder_stack_area, STACKSIZE);
+struct k_thread holder_thread_data;
+K_THREAD_STACK_DEFINE(contender_stack_area, STACKSIZE);
+struct k_thread contender_thread_data;
+
+static void holder_entry(void *p1, void *p2, void *p3)
+{
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	if (sys_mutex_lock(&shared_mutex, K_NO_WAIT) != 0) {
+		return;
+	}
+	atomic_set(&shared_locked, 1);
+
+	k_msleep(100);
+	(void)sys_mutex_unlock(&shared_mutex);
+}
+
+static void contender_entry(void *p1, void *p2, void *p3)
+{
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	while (atomic_get(&shared_locked) == 0) {
+		k_msleep(10);
+	}
+
+	contender_rv = sys_mutex_lock(&shared_mutex, K_FOREVER);
+	if (contender_rv == 0) {
+		(void)sys_mutex_unlock(&shared_mutex);
+	}
+}
+#endif /* CONFIG_USERSPACE */
+
 ZTEST_USER_OR_NOT(mutex_complex, test_user_access)
 {
+#ifdef CONFIG_USERSPACE
+	no_access_run(true);
+	no_access_run(false);
+#else
+	ztest_test_skip();
+#endif /* CONFIG_USERSPACE */
+}
+
+/* The mutex value is writable from user mode: naming a thread which is
+ * not alive as its owner must not let the kernel act on that thread.
+ */
+ZTEST_USER_OR_NOT(mutex_complex, test_user_corrupt_owner)
+{
 #ifdef CONFIG_USERSPACE
 	int rv;
 
-	rv = sys_mutex_lock(&no_access_mutex, K_NO_WAIT);
-	zassert_true(rv == -EACCES, "accessed mutex not in memory domain");
-	rv = sys_mutex_unlock(&no_access_mutex);
-	zassert_true(rv == -EACCES, "accessed mutex not in memory domain");
+	atomic_set(&corrupt_mutex.val, (atomic_val_t)&exited_thread_data);
+
+	rv = sys_mutex_lock(&corrupt_mutex, K_NO_WAIT);
+	zassert_equal(rv, -EINVAL, "locked a mutex with a corrupted owner (%d)", rv);
+
+	atomic_set(&corrupt_mutex.val, Z_SYS_MUTEX_UNLOCKED);
+#else
+	ztest_test_skip();
+#endif /* CONFIG_USERSPACE */
+}
+
+/* Contention between user threads goes through the kernel, which must
+ * not require them to have access to each other.
+ */
+ZTEST(mutex_complex, test_user_contention)
+{
+#ifdef CONFIG_USERSPACE
+	contender_rv = -EINVAL;
+
+	k_thread_create(&holder_thread_data, holder_stack_area, STACKSIZE,
+			holder_entry, NULL, NULL, NULL,
+			K_PRIO_PREEMPT(0), K_USER, K_NO_WAIT);
+	k_thread_create(&contender_thread_data, contender_stack_area, STACKSIZE,
+			contender_entry, NULL, NULL, NULL,
+			K_PRIO_PREEMPT(0), K_USER, K_NO_WAIT);
+
+	k_thread_join(&holder_thread_data, K_FOREVER);
+	k_thread_join(&contender_thread_data, K_FOREVER);
+
+	zassert_equal(atomic_get(&shared_locked), 1, "holder did not lock the mutex");
+	zassert_equal(contender_rv, 0, "contended lock failed (%d)", contender_rv);
 #else
 	ztest_test_skip();
 #endif /* CONFIG_USERSPACE */
@@ -496,7 +621,13 @@ static void *sys_mutex_tests_setup(void)
 				&thread_08_thread_data, &thread_08_stack_area,
 				&thread_09_thread_data, &thread_09_stack_area,
 				&thread_11_thread_data, &thread_11_stack_area,
-				&thread_12_thread_data, &thread_12_stack_area);
+				&thread_12_thread_data, &thread_12_stack_area,
+				&no_access_thread_data, &no_access_stack_area);
+
+	k_thread_create(&exited_thread_data, exited_stack_area, STACKSIZE,
+			exited_entry, NULL, NULL, NULL,
+			K_PRIO_PREEMPT(0), 0, K_NO_WAIT);
+	k_thread_join(&exited_thread_data, K_FOREVER);
 #endif
 	rv = sys_mutex_lock(&not_my_mutex, K_NO_WAIT);
 	if (rv != 0) {
@@ -0,0 +1,222 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @brief Tests for single-producer/single-consumer pipes
+ * @ingroup kernel_pipe_tests
+ * @{
+ */
+
+#include <zephyr/ztest.h>
+
+#ifdef CONFIG_PIPE_SPSC
+
+#define STACK_SIZE	(1024 + CONFIG_TEST_EXTRA_STACK_SIZE)
+#define SPSC_LEN	16
+#define STREAM_LEN	1000
+#define TIMEOUT		K_MSEC(100)
+
+K_PIPE_SPSC_DEFINE(spsc_pipe, SPSC_LEN, 4);
+
+K_THREAD_STACK_DECLARE(tstack, STACK_SIZE);
+extern struct k_thread tdata;
+
+static unsigned char spsc_buffer[SPSC_LEN];
+static struct k_pipe spsc_init_pipe;
+
+static void stream_byte_put(void *p1, void *p2, void *p3)
+{
+	size_t chunk = (size_t)(uintptr_t)p1;
+	unsigned char buf[7];
+	size_t written;
+
+	for (size_t i = 0; i < STREAM_LEN; i += chunk) {
+		chunk = MIN(chunk, STREAM_LEN - i);
+		for (size_t j = 0; j < chunk; j++) {
+			buf[j] = (unsigned char)(i + j);
+		}
+		zassert_ok(k_pipe_put(&spsc_pipe, buf, chunk, &written, chunk,
+				      K_FOREVER));
+		zassert_equal(written, chunk);
+	}
+}
+
+/**
+ * @brief Test writing and reading around the end of the ring buffer
+ * @see k_pipe_spsc_init(), k_pipe_put(), k_pipe_get()
+ */
+ZTEST(pipe_api_1cpu, test_pipe_spsc_put_get)
+{
+	unsigned char in[SPSC_LEN + 1];
+	unsigned char out[SPSC_LEN + 1];
+	size_t written;
+	size_t read;
+
+	k_pipe_spsc_init(&spsc_init_pipe, spsc_buffer, sizeof(spsc_buffer));
+
+	for (int i = 0; i < sizeof(in); i++) {
+		in[i] = (unsigned char)i;
+	}
+
+	zassert_equal(k_pipe_get(&spsc_init_pipe, out, 1, &read, 1, K_NO_WAIT),
+		      -EIO);
+	zassert_equal(read, 0);
+
+	zassert_ok(k_pipe_put(&spsc_init_pipe, in, 10, &written, 10, K_NO_WAIT));
+	zassert_equal(written, 10);
+	zassert_ok(k_pipe_get(&spsc_init_pipe, out, 10, &read, 10, K_NO_WAIT));
+	zassert_equal(read, 10);
+	zassert_mem_equal(out, in, 10);
+
+	/* Wraps around the end of the buffer */
+	zassert_equal(k_pipe_put(&spsc_init_pipe, in, sizeof(in), &written,
+				 sizeof(in), K_NO_WAIT), -EIO);
+	zassert_equal(written, 0);
+	zassert_ok(k_pipe_put(&spsc_init_pipe, in, sizeof(in), &written, 1,
+			      K_NO_WAIT));
+	zassert_equal(written, SPSC_LEN);
+	zassert_equal(k_pipe_read_avail(&spsc_init_pipe), SPSC_LEN);
+	zassert_equal(k_pipe_write_avail(&spsc_init_pipe), 0);
+
+	zassert_ok(k_pipe_get(&spsc_init_pipe, out, sizeof(out), &read, 0,
+			      K_NO_WAIT));
+	zassert_equal(read, SPSC_LEN);
+	zassert_mem_equal(out, in, SPSC_LEN);
+	zassert_equal(k_pipe_read_avail(&spsc_init_pipe), 0);
+	zassert_equal(k_pipe_write_avail(&spsc_init_pipe), SPSC_LEN);
+}
+
+/**
+ * @brief Test flushing a single-producer/single-consumer pipe
+ * @see k_pipe_flush(), k_pipe_buffer_flush()
+ */
+ZTEST(pipe_api_1cpu, test_pipe_spsc_flush)
+{
+	unsigned char in[4] = { 1, 2, 3, 4 };
+	size_t written;
+
+	k_pipe_spsc_init(&spsc_init_pipe, spsc_buffer, sizeof(spsc_buffer));
+
+	zassert_ok(k_pipe_put(&spsc_init_pipe, in, sizeof(in), &written,
+			      sizeof(in), K_NO_WAIT));
+	k_pipe_flush(&spsc_init_pipe);
+	zassert_equal(k_pipe_read_avail(&spsc_init_pipe), 0);
+
+	zassert_ok(k_pipe_put(&spsc_init_pipe, in, sizeof(in), &written,
+			      sizeof(in), K_NO_WAIT));
+	k_pipe_buffer_flush(&spsc_init_pipe);
+	zassert_equal(k_pipe_read_avail(&spsc_init_pipe), 0);
+	zassert_equal(k_pipe_write_avail(&spsc_init_pipe), SPSC_LEN);
+}
+
+/**
+ * @brief Test timing out on a full and on an empty pipe
+ * @see k_pipe_put(), k_pipe_get()
+ */
+ZTEST(pipe_api_1cpu, test_pipe_spsc_timeout)
+{
+	unsigned char buf[SPSC_LEN + 4] = { 0 };
+	size_t written;
+	size_t read;
+
+	k_pipe_spsc_init(&spsc_init_pipe, spsc_buffer, sizeof(spsc_buffer));
+
+	/* Partial writes and reads below the minimum time out */
+	zassert_equal(k_pipe_put(&spsc_init_pipe, buf, sizeof(buf), &written,
+				 sizeof(buf), TIMEOUT), -EAGAIN);
+	zassert_equal(written, SPSC_LEN);
+	zassert_equal(k_pipe_get(&spsc_init_pipe, buf, sizeof(buf), &read,
+				 sizeof(buf), TIMEOUT), -EAGAIN);
+	zassert_equal(read, SPSC_LEN);
+
+	/* Reaching the minimum before timing out succeeds */
+	zassert_ok(k_pipe_put(&spsc_init_pipe, buf, sizeof(buf), &written, 0,
+			      TIMEOUT));
+	zassert_equal(written, SPSC_LEN);
+}
+
+/**
+ * @brief Test streaming data to a blocked reader and from a blocked writer
+ * @see K_PIPE_SPSC_DEFINE(), k_pipe_put(), k_pipe_get()
+ */
+ZTEST(pipe_api_1cpu, test_pipe_spsc_stream)
+{
+	unsigned char buf[11];
+	size_t total;
+	size_t read;
+
+	/* Higher priority writer: the reader keeps emptying a full pipe */
+	k_thread_create(&tdata, tstack, STACK_SIZE, stream_byte_put,
+			(void *)(uintptr_t)7, NULL, NULL,
+			K_PRIO_PREEMPT(0), 0, K_NO_WAIT);
+
+	for (total = 0; total < STREAM_LEN; total += read) {
+		zassert_ok(k_pipe_get(&spsc_pipe, buf, sizeof(buf), &read, 1,
+				      K_FOREVER));
+		for (size_t j = 0; j < read; j++) {
+			zassert_equal(buf[j], (unsigned char)(total + j));
+		}
+	}
+	zassert_equal(total, STREAM_LEN);
+	k_thread_join(&tdata, K_FOREVER);
+
+	/* Lower priority writer: the reader keeps waiting on an empty pipe */
+	k_thread_create(&tdata, tstack, STACK_SIZE, stream_byte_put,
+			(void *)(uintptr_t)3, NULL, NULL,
+			K_LOWEST_APPLICATION_THREAD_PRIO, 0, K_NO_WAIT);
+
+	for (total = 0; total < STREAM_LEN; total += read) {
+		zassert_ok(k_pipe_get(&spsc_pipe, buf, MIN(sizeof(buf),
+				      STREAM_LEN - total), &read, 1, K_FOREVER));
+		for (size_t j = 0; j < read; j++) {
+			zassert_equal(buf[j], (unsigned char)(total + j));
+		}
+	}
+	k_thread_join(&tdata, K_FOREVER);
+	zassert_equal(k_pipe_read_avail(&spsc_pipe), 0);
+}
+
+#ifdef CONFIG_POLL
+static void spsc_put_one(void *p1, void *p2, void *p3)
+{
+	unsigned char byte = 0x5a;
+	size_t written;
+
+	k_msleep(10);
+	zassert_ok(k_pipe_put(&spsc_pipe, &byte, 1, &written, 1, K_NO_WAIT));
+}
+
+/**
+ * @brief Test polling for data written to an empty pipe
+ * @see k_pipe_put(), k_poll()
+ */
+ZTEST(pipe_api_1cpu, test_pipe_spsc_poll)
+{
+	struct k_poll_event event = K_POLL_EVENT_INITIALIZER(
+		K_POLL_TYPE_PIPE_DATA_AVAILABLE, K_POLL_MODE_NOTIFY_ONLY,
+		&spsc_pipe);
+	unsigned char byte;
+	size_t read;
+
+	k_pipe_flush(&spsc_pipe);
+	zassert_equal(k_poll(&event, 1, K_NO_WAIT), -EAGAIN);
+
+	k_thread_create(&tdata, tstack, STACK_SIZE, spsc_put_one, NULL, NULL,
+			NULL, K_PRIO_PREEMPT(0), 0, K_NO_WAIT);
+	zassert_ok(k_poll(&event, 1, TIMEOUT));
+	zassert_equal(event.state, K_POLL_STATE_PIPE_DATA_AVAILABLE);
+	k_thread_join(&tdata, K_FOREVER);
+
+	zassert_ok(k_pipe_get(&spsc_pipe, &byte, 1, &read, 1, K_NO_WAIT));
+	zassert_equal(byte, 0x5a);
+}
+#endif /* CONFIG_POLL */
+
+#endif /* CONFIG_PIPE_SPSC */
+
+/**
+ * @}
+ */
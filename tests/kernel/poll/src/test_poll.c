@@ -828,3 +828,74 @@ ZTEST(poll_api_1cpu, test_poll_zero_events)
 
 	zassert_equal(k_poll(&event, 0, K_MSEC(50)), -EAGAIN);
 }
+
+#define BATCH_SIGNALS 4
+
+static struct k_poll_signal batch_signals[BATCH_SIGNALS];
+static struct k_poll_event batch_events[BATCH_SIGNALS];
+static volatile int batch_polls;
+
+static void batch_poller(void *p1, void *p2, void *p3)
+{
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	zassert_ok(k_poll(batch_events, BATCH_SIGNALS, K_FOREVER));
+	batch_polls++;
+}
+
+/**
+ * @brief Test raising several poll signals at once
+ *
+ * @details A thread polling on several signals raised together is only
+ * woken once, and sees all of them signaled.
+ *
+ * @ingroup kernel_poll_tests
+ *
+ * @see k_poll_signal_raise_batch()
+ */
+ZTEST(poll_api_1cpu, test_poll_signal_raise_batch)
+{
+	const int main_low_prio = 10;
+	int old_prio = k_thread_priority_get(k_current_get());
+	struct k_poll_signal *raised[] = {
+		&batch_signals[0], &batch_signals[1], &batch_signals[3],
+	};
+	unsigned int signaled;
+	int result;
+
+	for (int i = 0; i < BATCH_SIGNALS; i++) {
+		k_poll_signal_init(&batch_signals[i]);
+		k_poll_event_init(&batch_events[i], K_POLL_TYPE_SIGNAL,
+				  K_POLL_MODE_NOTIFY_ONLY, &batch_signals[i]);
+	}
+	batch_polls = 0;
+
+	/* The poller runs first and blocks in k_poll() */
+	k_thread_priority_set(k_current_get(), main_low_prio);
+	k_thread_create(&test_thread, test_stack,
+			K_THREAD_STACK_SIZEOF(test_stack), batch_poller,
+			NULL, NULL, NULL, main_low_prio - 1, 0, K_NO_WAIT);
+	zassert_equal(batch_polls, 0);
+
+	zassert_ok(k_poll_signal_raise_batch(raised, ARRAY_SIZE(raised),
+					     SIGNAL_RESULT));
+	zassert_ok(k_thread_join(&test_thread, K_FOREVER));
+	k_thread_priority_set(k_current_get(), old_prio);
+
+	zassert_equal(batch_polls, 1);
+
+	for (int i = 0; i < BATCH_SIGNALS; i++) {
+		k_poll_signal_check(&batch_signals[i], &signaled, &result);
+
+		if (i == 2) {
+			zassert_equal(signaled, 0);
+			zassert_equal(batch_events[i].state, K_POLL_STATE_NOT_READY);
+		} else {
+			zassert_equal(signaled, 1);
+			zassert_equal(result, SIGNAL_RESULT);
+			zassert_equal(batch_events[i].state, K_POLL_STATE_SIGNALED);
+		}
+	}
+}
@@ -1218,6 +1218,44 @@ ZTEST(smp, test_smp_affinity)
 }
 #endif
 
+#ifdef CONFIG_TIMER_CPU_EXPIRY
+static struct k_timer cpu_timers[CONFIG_MP_MAX_NUM_CPUS];
+static volatile int timer_expiry_cpu[CONFIG_MP_MAX_NUM_CPUS];
+
+static void cpu_timer_expiry(struct k_timer *timer)
+{
+	timer_expiry_cpu[timer - cpu_timers] = curr_cpu();
+}
+
+/**
+ * @brief Test that timers expire on the CPU they are bound to
+ *
+ * @ingroup kernel_common_tests
+ *
+ * @see k_timer_cpu_set()
+ */
+ZTEST(smp, test_timer_cpu_expiry)
+{
+	unsigned int num_cpus = arch_num_cpus();
+
+	zassert_equal(k_timer_cpu_set(&cpu_timers[0], num_cpus), -EINVAL);
+	zassert_equal(k_timer_cpu_set(&cpu_timers[0], -2), -EINVAL);
+
+	for (unsigned int i = 0; i < num_cpus; i++) {
+		k_timer_init(&cpu_timers[i], cpu_timer_expiry, NULL);
+		zassert_ok(k_timer_cpu_set(&cpu_timers[i], i));
+		timer_expiry_cpu[i] = -1;
+		k_timer_start(&cpu_timers[i], K_MSEC(10), K_NO_WAIT);
+	}
+
+	for (unsigned int i = 0; i < num_cpus; i++) {
+		zassert_equal(k_timer_status_sync(&cpu_timers[i]), 1);
+		zassert_equal(timer_expiry_cpu[i], i,
+			      "timer %u expired on CPU %d", i, timer_expiry_cpu[i]);
+	}
+}
+#endif /* CONFIG_TIMER_CPU_EXPIRY */
+
 static void *smp_tests_setup(void)
 {
 	/* Sleep a bit to guarantee that both CPUs enter an idle
@@ -541,5 +541,96 @@ ZTEST(usage_api, test_thread_stats_usage)
 	k_thread_abort(tid);
 }
 
+#ifdef CONFIG_SCHED_THREAD_USAGE_HISTOGRAM
+#define HISTOGRAM_WAKEUPS 10
+
+static K_SEM_DEFINE(helper_sem, 0, 1);
+
+/**
+ * @brief Helper thread to test_thread_runtime_histogram_get()
+ */
+void helper2(void *p1, void *p2, void *p3)
+{
+	while (1) {
+		k_sem_take(&helper_sem, K_FOREVER);
+	}
+}
+
+static uint32_t histogram_sum(const uint32_t *bins)
+{
+	uint32_t sum = 0;
+
+	for (int i = 0; i < CONFIG_SCHED_THREAD_USAGE_HISTOGRAM_BINS; i++) {
+		sum += bins[i];
+	}
+
+	return sum;
+}
+
+/**
+ * @brief Test the k_thread_runtime_histogram_get() APIs
+ *
+ * 1. Create a higher priority helper thread waiting on a semaphore.
+ * 2. Wake it up a number of times.
+ *    - Its latency histogram counts one more wake-up than that, for its
+ *      start, and its run histogram one more run.
+ * 3. Disable its runtime stats and wake it up again.
+ *    - Its histograms do not change, those of the CPU do.
+ */
+ZTEST(usage_api, test_thread_runtime_histogram_get)
+{
+	struct k_sched_histogram  hist1;
+	struct k_sched_histogram  hist2;
+	struct k_sched_histogram  cpu_hist1;
+	struct k_sched_histogram  cpu_hist2;
+	k_tid_t  tid;
+	int  priority;
+
+	zassert_equal(k_thread_runtime_histogram_get(NULL, &hist1), -EINVAL);
+	zassert_equal(k_thread_runtime_histogram_cpu_get(-1, &cpu_hist1), -EINVAL);
+
+	priority = k_thread_priority_get(arch_current_thread());
+	tid = k_thread_create(&helper_thread, helper_stack,
+			      K_THREAD_STACK_SIZEOF(helper_stack),
+			      helper2, NULL, NULL, NULL,
+			      priority - 1, 0, K_NO_WAIT);
+
+	/* The test thread may be cooperative */
+	k_yield();
+
+	for (int i = 0; i < HISTOGRAM_WAKEUPS; i++) {
+		k_sem_give(&helper_sem);
+		k_yield();
+	}
+
+	k_thread_runtime_histogram_get(tid, &hist1);
+	zassert_equal(histogram_sum(hist1.latency), HISTOGRAM_WAKEUPS + 1);
+	zassert_equal(histogram_sum(hist1.run), HISTOGRAM_WAKEUPS + 1);
+
+	k_thread_runtime_histogram_cpu_get(0, &cpu_hist1);
+	zassert_true(histogram_sum(cpu_hist1.latency) >= HISTOGRAM_WAKEUPS + 1);
+	zassert_true(cpu_hist1.latency_max >= hist1.latency_max);
+
+#ifdef CONFIG_SCHED_THREAD_USAGE_ANALYSIS
+	k_thread_runtime_stats_disable(tid);
+	k_sem_give(&helper_sem);
+	k_yield();
+	k_thread_runtime_stats_enable(tid);
+
+	k_thread_runtime_histogram_get(tid, &hist2);
+	zassert_mem_equal(&hist1, &hist2, sizeof(hist1));
+
+	k_thread_runtime_histogram_cpu_get(0, &cpu_hist2);
+	zassert_true(histogram_sum(cpu_hist2.latency) > histogram_sum(cpu_hist1.latency));
+	zassert_true(histogram_sum(cpu_hist2.run) > histogram_sum(cpu_hist1.run));
+#else
+	ARG_UNUSED(hist2);
+	ARG_UNUSED(cpu_hist2);
+#endif
+
+	k_thread_abort(tid);
+}
+#endif /* CONFIG_SCHED_THREAD_USAGE_HISTOGRAM */
+
 ZTEST_SUITE(usage_api, NULL, NULL,
 		ztest_simple_1cpu_before, ztest_simple_1cpu_after, NULL);
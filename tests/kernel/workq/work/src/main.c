@@ -313,6 +313,53 @@ ZTEST(work_1cpu, test_1cpu_simple_queue)
 	zassert_equal(rc, 0);
 }
 
+/* Single-CPU check of submitting a batch of work items. */
+ZTEST(work_1cpu, test_1cpu_submit_batch)
+{
+	static struct k_work batch_work[3];
+	struct k_work *items[] = {
+		&batch_work[0], &batch_work[1], &batch_work[2],
+		/* Already queued by the time it's reached */
+		&batch_work[0],
+	};
+	int rc;
+
+	reset_counters();
+	for (int i = 0; i < ARRAY_SIZE(batch_work); i++) {
+		k_work_init(&batch_work[i], counter_handler);
+	}
+
+	/* Rejected as a whole by a queue that isn't started */
+	rc = k_work_submit_batch_to_queue(&not_start_queue, items,
+					  ARRAY_SIZE(items));
+	zassert_equal(rc, -ENODEV);
+	zassert_equal(k_work_busy_get(&batch_work[0]), 0);
+
+	/* Submit to the cooperative queue */
+	rc = k_work_submit_batch_to_queue(&coophi_queue, items,
+					  ARRAY_SIZE(items));
+	zassert_equal(rc, ARRAY_SIZE(batch_work));
+	for (int i = 0; i < ARRAY_SIZE(batch_work); i++) {
+		zassert_equal(k_work_busy_get(&batch_work[i]), K_WORK_QUEUED);
+	}
+
+	/* Shouldn't have been started since test thread is
+	 * cooperative.
+	 */
+	zassert_equal(coophi_counter(), 0);
+
+	/* Let them run, then check they finished. */
+	k_sleep(K_TICKS(1));
+	zassert_equal(coophi_counter(), ARRAY_SIZE(batch_work));
+	for (int i = 0; i < ARRAY_SIZE(batch_work); i++) {
+		zassert_equal(k_work_busy_get(&batch_work[i]), 0);
+	}
+
+	/* Flush the sync state from completion */
+	rc = k_sem_take(&sync_sem, K_NO_WAIT);
+	zassert_equal(rc, 0);
+}
+
 /* Basic SMP check submitting with a non-blocking handler. */
 ZTEST(work, test_smp_simple_queue)
 {
@@ -0,0 +1,230 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/ztest.h>
+
+#define STACK_SIZE (1024 + CONFIG_TEST_EXTRA_STACK_SIZE)
+#define NUM_WORKERS 4
+#define WORKER_PRIORITY K_PRIO_PREEMPT(1)
+
+#define NUM_ITEMS 4
+#define ITEM_SLEEP_MS 20
+
+K_WORK_POOL_DEFINE(pool, NUM_WORKERS, STACK_SIZE);
+
+struct test_item {
+	struct k_work work;
+	k_tid_t thread;
+};
+
+static struct test_item items[NUM_ITEMS];
+static struct k_work_delayable dwork;
+
+/* Given by work handlers to signal completion. */
+static struct k_sem done_sem;
+
+/* Given by the test to let a blocking handler complete. */
+static struct k_sem release_sem;
+
+static atomic_t active;
+static atomic_t run_count;
+static bool overlapped;
+
+static void sleeping_handler(struct k_work *work)
+{
+	struct test_item *item = CONTAINER_OF(work, struct test_item, work);
+
+	item->thread = k_current_get();
+	k_msleep(ITEM_SLEEP_MS);
+	atomic_inc(&run_count);
+	k_sem_give(&done_sem);
+}
+
+static void blocking_handler(struct k_work *work)
+{
+	if (atomic_inc(&active) != 0) {
+		overlapped = true;
+	}
+
+	k_sem_give(&done_sem);
+	k_sem_take(&release_sem, K_FOREVER);
+
+	atomic_dec(&active);
+	atomic_inc(&run_count);
+}
+
+static void counting_handler(struct k_work *work)
+{
+	atomic_inc(&run_count);
+	k_sem_give(&done_sem);
+}
+
+static void init_items(k_work_handler_t handler)
+{
+	for (int i = 0; i < NUM_ITEMS; i++) {
+		k_work_init(&items[i].work, handler);
+		items[i].thread = NULL;
+	}
+}
+
+static bool is_worker(k_tid_t thread)
+{
+	for (int i = 0; i < NUM_WORKERS; i++) {
+		if (thread == k_work_queue_thread_get(&pool.workers[i])) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+/* Work submitted from one CPU is shared by the idle workers. */
+ZTEST(work_pool, test_pool_steal)
+{
+	int distinct = 0;
+
+	init_items(sleeping_handler);
+
+	for (int i = 0; i < NUM_ITEMS; i++) {
+		zassert_equal(k_work_pool_submit(&pool, &items[i].work), 1);
+	}
+
+	for (int i = 0; i < NUM_ITEMS; i++) {
+		zassert_ok(k_sem_take(&done_sem, K_MSEC(10 * ITEM_SLEEP_MS)));
+	}
+	zassert_equal(atomic_get(&run_count), NUM_ITEMS);
+
+	for (int i = 0; i < NUM_ITEMS; i++) {
+		bool seen = false;
+
+		zassert_true(is_worker(items[i].thread));
+
+		for (int j = 0; j < i; j++) {
+			seen |= (items[j].thread == items[i].thread);
+		}
+		distinct += seen ? 0 : 1;
+	}
+
+	/* Each handler sleeps, so the items can't all have run on the
+	 * worker they were queued to.
+	 */
+	zassert_true(distinct > 1, "all items ran on one worker");
+}
+
+/* A running item resubmitted to the pool is never run concurrently. */
+ZTEST(work_pool, test_pool_resubmit_running)
+{
+	struct k_work *work = &items[0].work;
+
+	init_items(blocking_handler);
+
+	zassert_equal(k_work_pool_submit(&pool, work), 1);
+	zassert_ok(k_sem_take(&done_sem, K_FOREVER));
+	zassert_equal(k_work_busy_get(work), K_WORK_RUNNING);
+
+	/* Queued behind itself on the worker running it */
+	zassert_equal(k_work_pool_submit(&pool, work), 2);
+	zassert_equal(k_work_busy_get(work), K_WORK_RUNNING | K_WORK_QUEUED);
+
+	/* Give the other workers a chance to pick it up */
+	k_msleep(ITEM_SLEEP_MS);
+	zassert_equal(atomic_get(&run_count), 0);
+
+	k_sem_give(&release_sem);
+	zassert_ok(k_sem_take(&done_sem, K_MSEC(10 * ITEM_SLEEP_MS)));
+	k_sem_give(&release_sem);
+
+	(void)k_work_flush(work, &(struct k_work_sync){});
+	zassert_equal(atomic_get(&run_count), 2);
+	zassert_false(overlapped);
+}
+
+/* Flushing waits for an item wherever it ends up running. */
+ZTEST(work_pool, test_pool_flush)
+{
+	struct k_work_sync sync;
+
+	init_items(sleeping_handler);
+
+	for (int i = 0; i < NUM_ITEMS; i++) {
+		zassert_equal(k_work_pool_submit(&pool, &items[i].work), 1);
+	}
+
+	for (int i = NUM_ITEMS - 1; i >= 0; i--) {
+		(void)k_work_flush(&items[i].work, &sync);
+		zassert_equal(k_work_busy_get(&items[i].work), 0);
+		zassert_not_null(items[i].thread);
+	}
+
+	zassert_equal(atomic_get(&run_count), NUM_ITEMS);
+}
+
+ZTEST(work_pool, test_pool_schedule)
+{
+	struct k_work_sync sync;
+
+	k_work_init_delayable(&dwork, counting_handler);
+
+	zassert_equal(k_work_pool_schedule(&pool, &dwork, K_MSEC(ITEM_SLEEP_MS)), 1);
+	zassert_true(k_work_delayable_is_pending(&dwork));
+	zassert_ok(k_sem_take(&done_sem, K_MSEC(10 * ITEM_SLEEP_MS)));
+	(void)k_work_flush_delayable(&dwork, &sync);
+
+	zassert_equal(k_work_pool_reschedule(&pool, &dwork, K_NO_WAIT), 1);
+	zassert_ok(k_sem_take(&done_sem, K_MSEC(10 * ITEM_SLEEP_MS)));
+
+	zassert_equal(atomic_get(&run_count), 2);
+}
+
+ZTEST(work_pool, test_pool_drain)
+{
+	init_items(sleeping_handler);
+
+	for (int i = 0; i < NUM_ITEMS; i++) {
+		zassert_equal(k_work_pool_submit(&pool, &items[i].work), 1);
+	}
+
+	zassert_ok(k_work_pool_drain(&pool, false));
+	zassert_equal(atomic_get(&run_count), NUM_ITEMS);
+
+	/* Not plugged: accepts work again */
+	zassert_equal(k_work_pool_submit(&pool, &items[0].work), 1);
+	zassert_ok(k_work_pool_drain(&pool, true));
+	zassert_equal(atomic_get(&run_count), NUM_ITEMS + 1);
+
+	zassert_equal(k_work_pool_submit(&pool, &items[0].work), -EBUSY);
+
+	for (int i = 0; i < NUM_WORKERS; i++) {
+		zassert_ok(k_work_queue_unplug(&pool.workers[i]));
+	}
+
+	zassert_equal(k_work_pool_submit(&pool, &items[0].work), 1);
+	zassert_ok(k_work_pool_drain(&pool, false));
+	zassert_equal(atomic_get(&run_count), NUM_ITEMS + 2);
+}
+
+static void *work_pool_setup(void)
+{
+	k_work_pool_start(&pool, WORKER_PRIORITY, NULL);
+
+	return NULL;
+}
+
+static void work_pool_before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	k_sem_init(&done_sem, 0, NUM_ITEMS);
+	k_sem_init(&release_sem, 0, 1);
+	atomic_clear(&active);
+	atomic_clear(&run_count);
+	overlapped = false;
+
+	/* Let the workers go idle */
+	k_msleep(1);
+}
+
+ZTEST_SUITE(work_pool, NULL, work_pool_setup, work_pool_before, NULL, NULL);
@@ -2487,6 +2487,156 @@ ZTEST(net_socket_tcp, test_keepalive_timeout)
 	test_context_cleanup();
 }
 
+ZTEST(net_socket_tcp, test_v4_recv_zc)
+{
+	int c_sock;
+	int s_sock;
+	int new_sock;
+	struct sockaddr_in c_saddr;
+	struct sockaddr_in s_saddr;
+	struct sockaddr_in addr;
+	socklen_t addrlen = sizeof(addr);
+	struct net_buf *frags;
+	uint8_t rx_buf[sizeof(TEST_STR_SMALL)];
+	size_t total = 0;
+	ssize_t ret;
+
+	prepare_sock_tcp_v4(MY_IPV4_ADDR, ANY_PORT, &c_sock, &c_saddr);
+	prepare_sock_tcp_v4(MY_IPV4_ADDR, SERVER_PORT, &s_sock, &s_saddr);
+
+	test_bind(s_sock, (struct sockaddr *)&s_saddr, sizeof(s_saddr));
+	test_listen(s_sock);
+
+	test_connect(c_sock, (struct sockaddr *)&s_saddr, sizeof(s_saddr));
+	test_send(c_sock, TEST_STR_SMALL, strlen(TEST_STR_SMALL), 0);
+
+	test_accept(s_sock, &new_sock, NULL, NULL);
+
+	ret = zsock_recv_zc(new_sock, &frags, ZSOCK_MSG_PEEK, NULL, NULL);
+	zassert_equal(ret, -1, "MSG_PEEK should not be supported");
+	zassert_equal(errno, EINVAL, "invalid errno (%d)", errno);
+
+	/* The data may be split over several segments */
+	while (total < strlen(TEST_STR_SMALL)) {
+		ret = zsock_recv_zc(new_sock, &frags, 0,
+				    (struct sockaddr *)&addr, &addrlen);
+		zassert_true(ret > 0, "recv_zc failed (%d)", -errno);
+		zassert_not_null(frags, "no fragments received");
+		zassert_equal(net_buf_frags_len(frags), ret,
+			      "invalid fragments length");
+		zassert_true(total + ret <= strlen(TEST_STR_SMALL),
+			     "too much data received");
+
+		net_buf_linearize(rx_buf + total, sizeof(rx_buf) - total, frags,
+				  0, ret);
+		net_buf_unref(frags);
+		total += ret;
+	}
+
+	zassert_mem_equal(rx_buf, TEST_STR_SMALL, strlen(TEST_STR_SMALL),
+			  "invalid data received");
+	zassert_equal(addrlen, sizeof(struct sockaddr_in), "wrong addrlen");
+
+	ret = zsock_recv_zc(new_sock, &frags, ZSOCK_MSG_DONTWAIT, NULL, NULL);
+	zassert_equal(ret, -1, "recv_zc should fail");
+	zassert_equal(errno, EAGAIN, "invalid errno (%d)", errno);
+
+	test_close(c_sock);
+
+	/* EOF is reported without any fragment */
+	ret = zsock_recv_zc(new_sock, &frags, 0, NULL, NULL);
+	zassert_equal(ret, 0, "EOF not received");
+	zassert_is_null(frags, "fragments received at EOF");
+
+	test_close(new_sock);
+	test_close(s_sock);
+
+	test_context_cleanup();
+}
+
+#define ZC_TX_LEN 4096
+
+static uint8_t zc_tx_buf[ZC_TX_LEN];
+static K_SEM_DEFINE(zc_tx_done, 0, K_SEM_MAX_LIMIT);
+
+static void zc_tx_done_cb(void *user_data)
+{
+	zassert_equal_ptr(user_data, zc_tx_buf, "invalid user data");
+
+	k_sem_give(&zc_tx_done);
+}
+
+ZTEST(net_socket_tcp, test_v4_send_zc)
+{
+	int c_sock;
+	int s_sock;
+	int new_sock;
+	struct sockaddr_in c_saddr;
+	struct sockaddr_in s_saddr;
+	static uint8_t rx_buf[ZC_TX_LEN];
+	size_t sent = 0;
+	size_t recved = 0;
+	int calls = 0;
+	ssize_t ret;
+
+	for (int i = 0; i < ZC_TX_LEN; i++) {
+		zc_tx_buf[i] = (uint8_t)i;
+	}
+
+	k_sem_reset(&zc_tx_done);
+
+	prepare_sock_tcp_v4(MY_IPV4_ADDR, ANY_PORT, &c_sock, &c_saddr);
+	prepare_sock_tcp_v4(MY_IPV4_ADDR, SERVER_PORT, &s_sock, &s_saddr);
+
+	test_bind(s_sock, (struct sockaddr *)&s_saddr, sizeof(s_saddr));
+	test_listen(s_sock);
+	test_connect(c_sock, (struct sockaddr *)&s_saddr, sizeof(s_saddr));
+	test_accept(s_sock, &new_sock, NULL, NULL);
+
+	/* Each call queues a part of the buffer, and its callback is called
+	 * once that part has been acknowledged.
+	 */
+	while (recved < ZC_TX_LEN) {
+		if (sent < ZC_TX_LEN) {
+			ret = zsock_send_zc(c_sock, zc_tx_buf + sent,
+					    ZC_TX_LEN - sent, ZSOCK_MSG_DONTWAIT,
+					    zc_tx_done_cb, zc_tx_buf);
+			if (ret > 0) {
+				sent += ret;
+				calls++;
+			} else {
+				zassert_equal(errno, EAGAIN, "send_zc failed (%d)",
+					      errno);
+			}
+		}
+
+		ret = zsock_recv(new_sock, rx_buf + recved, ZC_TX_LEN - recved, 0);
+		zassert_true(ret > 0, "recv failed (%d)", errno);
+		recved += ret;
+	}
+
+	zassert_mem_equal(rx_buf, zc_tx_buf, ZC_TX_LEN, "invalid data received");
+
+	for (int i = 0; i < calls; i++) {
+		zassert_ok(k_sem_take(&zc_tx_done, K_SECONDS(1)),
+			   "buffer not released");
+	}
+
+	zassert_equal(k_sem_take(&zc_tx_done, K_NO_WAIT), -EBUSY,
+		      "buffer released too many times");
+
+	/* The stack must not have modified the data */
+	for (int i = 0; i < ZC_TX_LEN; i++) {
+		zassert_equal(zc_tx_buf[i], (uint8_t)i, "data modified");
+	}
+
+	test_close(c_sock);
+	test_close(new_sock);
+	test_close(s_sock);
+
+	test_context_cleanup();
+}
+
 static void after(void *arg)
 {
 	ARG_UNUSED(arg);
@@ -3092,6 +3092,139 @@ ZTEST(net_socket_udp, test_40_clamp_udp_tcp_port_range)
 #endif
 }
 
+#define MMSG_COUNT 4
+
+ZTEST(net_socket_udp, test_41_v4_sendmmsg_recvmmsg)
+{
+	int rv;
+	int client_sock;
+	int server_sock;
+	struct sockaddr_in client_addr;
+	struct sockaddr_in server_addr;
+	struct mmsghdr msgs[MMSG_COUNT];
+	struct iovec iov[MMSG_COUNT];
+	char rx_buf[MMSG_COUNT][8];
+	char tx_buf[MMSG_COUNT][8];
+
+	prepare_sock_udp_v4(MY_IPV4_ADDR, ANY_PORT, &client_sock, &client_addr);
+	prepare_sock_udp_v4(MY_IPV4_ADDR, SERVER_PORT, &server_sock, &server_addr);
+
+	rv = zsock_bind(server_sock, (struct sockaddr *)&server_addr,
+			sizeof(server_addr));
+	zassert_equal(rv, 0, "server bind failed");
+
+	rv = zsock_bind(client_sock, (struct sockaddr *)&client_addr,
+			sizeof(client_addr));
+	zassert_equal(rv, 0, "client bind failed");
+
+	memset(msgs, 0, sizeof(msgs));
+
+	for (int i = 0; i < MMSG_COUNT; i++) {
+		snprintk(tx_buf[i], sizeof(tx_buf[i]), "msg%d", i);
+		iov[i].iov_base = tx_buf[i];
+		iov[i].iov_len = strlen(tx_buf[i]);
+		msgs[i].msg_hdr.msg_name = &server_addr;
+		msgs[i].msg_hdr.msg_namelen = sizeof(server_addr);
+		msgs[i].msg_hdr.msg_iov = &iov[i];
+		msgs[i].msg_hdr.msg_iovlen = 1;
+	}
+
+	rv = zsock_sendmmsg(client_sock, msgs, MMSG_COUNT, 0);
+	zassert_equal(rv, MMSG_COUNT, "sendmmsg failed (%d)", -errno);
+
+	for (int i = 0; i < MMSG_COUNT; i++) {
+		zassert_equal(msgs[i].msg_len, strlen(tx_buf[i]),
+			      "invalid msg_len %u", msgs[i].msg_len);
+	}
+
+	memset(msgs, 0, sizeof(msgs));
+	memset(rx_buf, 0, sizeof(rx_buf));
+
+	for (int i = 0; i < MMSG_COUNT; i++) {
+		iov[i].iov_base = rx_buf[i];
+		iov[i].iov_len = sizeof(rx_buf[i]);
+		msgs[i].msg_hdr.msg_iov = &iov[i];
+		msgs[i].msg_hdr.msg_iovlen = 1;
+	}
+
+	/* Wait for the first datagram, then collect the ones already queued */
+	rv = zsock_recvmmsg(server_sock, msgs, MMSG_COUNT, ZSOCK_MSG_WAITFORONE,
+			    NULL);
+	zassert_true(rv > 0, "recvmmsg failed (%d)", -errno);
+
+	for (int i = 0; i < rv; i++) {
+		zassert_equal(msgs[i].msg_len, strlen(tx_buf[i]),
+			      "invalid msg_len %u", msgs[i].msg_len);
+		zassert_mem_equal(rx_buf[i], tx_buf[i], msgs[i].msg_len,
+				  "invalid data in message %d", i);
+	}
+
+	/* Nothing left to read once all the datagrams have been received */
+	if (rv == MMSG_COUNT) {
+		rv = zsock_recvmmsg(server_sock, msgs, MMSG_COUNT,
+				    ZSOCK_MSG_DONTWAIT, NULL);
+		zassert_equal(rv, -1, "recvmmsg should fail");
+		zassert_equal(errno, EAGAIN, "invalid errno (%d)", errno);
+	}
+
+	rv = zsock_close(client_sock);
+	zassert_equal(rv, 0, "close failed");
+	rv = zsock_close(server_sock);
+	zassert_equal(rv, 0, "close failed");
+}
+
+ZTEST(net_socket_udp, test_42_v4_recv_zc)
+{
+	int rv;
+	int client_sock;
+	int server_sock;
+	struct sockaddr_in client_addr;
+	struct sockaddr_in server_addr;
+	struct sockaddr_in addr;
+	socklen_t addrlen = sizeof(addr);
+	struct net_buf *frags;
+	ssize_t ret;
+
+	prepare_sock_udp_v4(MY_IPV4_ADDR, CLIENT_PORT, &client_sock, &client_addr);
+	prepare_sock_udp_v4(MY_IPV4_ADDR, SERVER_PORT, &server_sock, &server_addr);
+
+	rv = zsock_bind(server_sock, (struct sockaddr *)&server_addr,
+			sizeof(server_addr));
+	zassert_equal(rv, 0, "server bind failed");
+
+	rv = zsock_bind(client_sock, (struct sockaddr *)&client_addr,
+			sizeof(client_addr));
+	zassert_equal(rv, 0, "client bind failed");
+
+	ret = zsock_sendto(client_sock, TEST_STR_SMALL, strlen(TEST_STR_SMALL), 0,
+			   (struct sockaddr *)&server_addr, sizeof(server_addr));
+	zassert_equal(ret, strlen(TEST_STR_SMALL), "sendto failed");
+
+	ret = zsock_recv_zc(server_sock, &frags, 0, (struct sockaddr *)&addr,
+			    &addrlen);
+	zassert_equal(ret, strlen(TEST_STR_SMALL), "recv_zc failed (%d)", -errno);
+	zassert_not_null(frags, "no fragments received");
+
+	/* Only the payload is handed over, without the headers */
+	zassert_equal(net_buf_frags_len(frags), strlen(TEST_STR_SMALL),
+		      "invalid fragments length");
+	zassert_mem_equal(frags->data, TEST_STR_SMALL, frags->len,
+			  "invalid data received");
+	net_buf_unref(frags);
+
+	zassert_equal(addrlen, sizeof(struct sockaddr_in), "wrong addrlen");
+	zassert_equal(addr.sin_port, client_addr.sin_port, "wrong source port");
+
+	ret = zsock_recv_zc(server_sock, &frags, ZSOCK_MSG_DONTWAIT, NULL, NULL);
+	zassert_equal(ret, -1, "recv_zc should fail");
+	zassert_equal(errno, EAGAIN, "invalid errno (%d)", errno);
+
+	rv = zsock_close(client_sock);
+	zassert_equal(rv, 0, "close failed");
+	rv = zsock_close(server_sock);
+	zassert_equal(rv, 0, "close failed");
+}
+
 static void after(void *arg)
 {
 	ARG_UNUSED(arg);
@@ -114,6 +114,7 @@ static enum test_case_no {
 	TEST_CLIENT_CLOSING_FAILURE_IPV6 = 16,
 	TEST_CLIENT_FIN_WAIT_2_IPV4_FAILURE = 17,
 	TEST_CLIENT_FIN_ACK_WITH_DATA = 18,
+	TEST_CLIENT_SACK_RECOVERY_IPV4 = 19,
 } test_case_no;
 
 static enum test_state t_state;
@@ -138,6 +139,8 @@ static void handle_server_rst_on_closed_port(sa_family_t af, struct tcphdr *th);
 static void handle_server_rst_on_listening_port(sa_family_t af, struct tcphdr *th);
 static void handle_syn_invalid_ack(sa_family_t af, struct tcphdr *th);
 static void handle_client_fin_ack_with_data_test(sa_family_t af, struct tcphdr *th);
+static void handle_client_sack_recovery_test(sa_family_t af, struct tcphdr *th,
+					     size_t len);
 
 static void verify_flags(struct tcphdr *th, uint8_t flags,
 			 const char *fun, int line)
@@ -235,6 +238,20 @@ static uint8_t tcp_options[20] = {
 	0x01, /* NOP */
 	0x03, 0x03, 0x07 /* Win scale*/ };
 
+/* SACK option added to the ACKs of the peer when sack_block_len is set */
+static uint8_t sack_option[12] = {
+	0x01, 0x01, /* NOP */
+	0x05, 0x0a, /* SACK, one block */
+};
+static size_t sack_block_len;
+
+static void set_sack_block(uint32_t start, uint32_t end)
+{
+	UNALIGNED_PUT(htonl(start), (uint32_t *)&sack_option[4]);
+	UNALIGNED_PUT(htonl(end), (uint32_t *)&sack_option[8]);
+	sack_block_len = sizeof(sack_option);
+}
+
 static struct net_pkt *tester_prepare_tcp_pkt(sa_family_t af,
 					      uint16_t src_port,
 					      uint16_t dst_port,
@@ -245,11 +262,18 @@ static struct net_pkt *tester_prepare_tcp_pkt(sa_family_t af,
 	NET_PKT_DATA_ACCESS_DEFINE(tcp_access, struct tcphdr);
 	struct net_pkt *pkt;
 	struct tcphdr *th;
+	const uint8_t *opts = NULL;
 	uint8_t opts_len = 0;
 	int ret = -EINVAL;
 
-	if ((test_case_no == TEST_SERVER_WITH_OPTIONS_IPV4) && (flags & SYN)) {
+	if ((test_case_no == TEST_SERVER_WITH_OPTIONS_IPV4 ||
+	     test_case_no == TEST_CLIENT_SACK_RECOVERY_IPV4) && (flags & SYN)) {
+		opts = tcp_options;
 		opts_len = sizeof(tcp_options);
+	} else if (test_case_no == TEST_CLIENT_SACK_RECOVERY_IPV4 &&
+		   flags == ACK && sack_block_len > 0) {
+		opts = sack_option;
+		opts_len = sack_block_len;
 	}
 
 	/* Allocate buffer */
@@ -284,11 +308,7 @@ static struct net_pkt *tester_prepare_tcp_pkt(sa_family_t af,
 	th->th_sport = src_port;
 	th->th_dport = dst_port;
 
-	if ((test_case_no == TEST_SERVER_WITH_OPTIONS_IPV4) && (flags & SYN)) {
-		th->th_off = 10U;
-	} else {
-		th->th_off = 5U;
-	}
+	th->th_off = 5U + opts_len / 4U;
 
 	th->th_flags = flags;
 	th->th_win = NET_IPV6_MTU;
@@ -303,9 +323,9 @@ static struct net_pkt *tester_prepare_tcp_pkt(sa_family_t af,
 		goto fail;
 	}
 
-	if ((test_case_no == TEST_SERVER_WITH_OPTIONS_IPV4) && (flags & SYN)) {
+	if (opts_len > 0) {
 		/* Add TCP Options */
-		ret = net_pkt_write(pkt, tcp_options, opts_len);
+		ret = net_pkt_write(pkt, opts, opts_len);
 		if (ret < 0) {
 			goto fail;
 		}
@@ -490,6 +510,13 @@ static int tester_send(const struct device *dev, struct net_pkt *pkt)
 	case TEST_CLIENT_FIN_ACK_WITH_DATA:
 		handle_client_fin_ack_with_data_test(net_pkt_family(pkt), &th);
 		break;
+	case TEST_CLIENT_SACK_RECOVERY_IPV4:
+		handle_client_sack_recovery_test(net_pkt_family(pkt), &th,
+						 net_pkt_get_len(pkt) -
+						 net_pkt_ip_hdr_len(pkt) -
+						 net_pkt_ip_opts_len(pkt) -
+						 th.th_off * 4U);
+		break;
 
 	default:
 		zassert_true(false, "Undefined test case");
@@ -719,6 +746,12 @@ static void handle_server_test(sa_family_t af, struct tcphdr *th)
 		break;
 	case T_SYN_ACK:
 		test_verify_flags(th, SYN | ACK);
+		if (test_case_no == TEST_SERVER_WITH_OPTIONS_IPV4) {
+			/* MSS and, if enabled, SACK permitted options */
+			zassert_equal(th->th_off,
+				      IS_ENABLED(CONFIG_NET_TCP_SACK) ? 7 : 6,
+				      "Unexpected TCP options in SYN ACK");
+		}
 		seq++;
 		ack = ntohl(th->th_seq) + 1U;
 		reply = prepare_ack_packet(af, htons(MY_PORT),
@@ -2602,4 +2635,136 @@ ZTEST(net_tcp, test_client_fin_ack_with_data)
 	}
 }
 
+static uint16_t sack_peer_port;
+static uint32_t sack_rxt_seq;
+static size_t sack_rxt_len;
+
+static void handle_client_sack_recovery_test(sa_family_t af, struct tcphdr *th,
+					     size_t len)
+{
+	struct net_pkt *reply;
+
+	switch (t_state) {
+	case T_SYN:
+		test_verify_flags(th, SYN);
+		/* MSS and SACK permitted options */
+		zassert_equal(th->th_off, 7, "SACK not offered in SYN");
+		device_initial_seq = ntohl(th->th_seq);
+		seq = 0U;
+		ack = ntohl(th->th_seq) + 1U;
+		sack_peer_port = th->th_sport;
+		reply = prepare_syn_ack_packet(af, htons(MY_PORT), sack_peer_port);
+		seq++;
+		t_state = T_SYN_ACK;
+		break;
+	case T_SYN_ACK:
+		test_verify_flags(th, ACK);
+		t_state = T_DATA;
+		test_sem_give();
+		return;
+	case T_DATA:
+		test_verify_flags(th, PSH | ACK);
+		test_sem_give();
+		return;
+	case T_DATA_ACK:
+		/* First retransmission after the SACK */
+		test_verify_flags(th, PSH | ACK);
+		sack_rxt_seq = get_rel_seq(th);
+		sack_rxt_len = len;
+		t_state = T_CLOSING;
+		test_sem_give();
+		return;
+	case T_CLOSING:
+		return;
+	default:
+		zassert_true(false, "%s unexpected state", __func__);
+		return;
+	}
+
+	zassert_ok(net_recv_data(net_iface, reply), "%s failed", __func__);
+}
+
+/* Test case scenario IPv4
+ *   expect SYN with SACK permitted,
+ *   send SYN ACK with SACK permitted,
+ *   expect ACK,
+ *   expect three data segments,
+ *   send duplicate ACK SACKing the second and third segment,
+ *   expect a retransmission of the first segment only,
+ *   send RST.
+ *   any failures cause test case to fail.
+ */
+ZTEST(net_tcp, test_client_sack_recovery)
+{
+	struct net_context *ctx;
+	struct net_pkt *reply;
+	struct tcp *conn;
+	int ret;
+
+	if (!IS_ENABLED(CONFIG_NET_TCP_SACK)) {
+		ztest_test_skip();
+	}
+
+	t_state = T_SYN;
+	test_case_no = TEST_CLIENT_SACK_RECOVERY_IPV4;
+	seq = ack = 0;
+	sack_block_len = 0;
+
+	zassert_ok(net_context_get(AF_INET, SOCK_STREAM, IPPROTO_TCP, &ctx),
+		   "Failed to get net_context");
+
+	net_context_ref(ctx);
+
+	zassert_ok(net_context_connect(ctx, (struct sockaddr *)&peer_addr_s,
+				       sizeof(struct sockaddr_in), NULL,
+				       K_MSEC(100), NULL),
+		   "Failed to connect to peer");
+
+	/* Peer will release the semaphore after it receives
+	 * proper ACK to SYN | ACK
+	 */
+	test_sem_take(K_MSEC(100), __LINE__);
+
+	/* Send each chunk of data in a segment of its own */
+	conn = ctx->tcp;
+	conn->tcp_nodelay = true;
+
+	for (int i = 0; i < 3; i++) {
+		ret = net_context_send(ctx, lorem_ipsum + i * 10, 10, NULL,
+				       K_NO_WAIT, NULL);
+		zassert_true(ret >= 0, "Failed to send data to peer (%d)", ret);
+
+		test_sem_take(K_MSEC(100), __LINE__);
+	}
+
+	/* The first segment is lost, the other two are SACKed */
+	t_state = T_DATA_ACK;
+	set_sack_block(ack + 10U, ack + 30U);
+	reply = prepare_ack_packet(AF_INET, htons(MY_PORT), sack_peer_port);
+	sack_block_len = 0;
+	zassert_not_null(reply, "Cannot create pkt");
+	zassert_ok(net_recv_data(net_iface, reply), "recv data failed");
+
+	/* Without three duplicate ACKs the hole is retransmitted once the
+	 * reordering window expires. A retransmission timeout would resend
+	 * all the data instead.
+	 */
+	test_sem_take(K_MSEC(CONFIG_NET_TCP_INIT_RETRANSMISSION_TIMEOUT),
+		      __LINE__);
+
+	zassert_equal(sack_rxt_seq, 1, "Unexpected retransmitted SEQ %u",
+		      sack_rxt_seq);
+	zassert_equal(sack_rxt_len, 10, "Unexpected retransmitted length %zu",
+		      sack_rxt_len);
+
+	/* Just send a RST packet to abort the underlying connection */
+	reply = prepare_rst_packet(AF_INET, htons(MY_PORT), sack_peer_port);
+	zassert_ok(net_recv_data(net_iface, reply), "recv data failed");
+
+	/* Let the receiving thread run */
+	k_msleep(50);
+
+	net_context_put(ctx);
+}
+
 ZTEST_SUITE(net_tcp, NULL, presetup, NULL, NULL, NULL);
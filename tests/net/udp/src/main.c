@@ -43,6 +43,7 @@ LOG_MODULE_REGISTER(net_test, NET_LOG_LEVEL);
 #endif
 
 #include "udp_internal.h"
+#include "connection.h"
 
 #if NET_LOG_LEVEL >= LOG_LEVEL_DBG
 #define NET_LOG_ENABLED 1
@@ -671,4 +672,101 @@ ZTEST(udp_fn_tests, test_udp)
 	zassert_false(test_failed, "udp tests failed");
 }
 
+#define NUM_CONNECTED 32
+#define LOOKUP_PORT 5000
+#define CONNECTED_PORT 1000
+
+ZTEST(udp_fn_tests, test_udp_conn_lookup)
+{
+	static struct ud uds[NUM_CONNECTED + 2];
+	struct net_conn_handle *handles[NUM_CONNECTED + 2];
+	struct in_addr in4addr_my = { { { 192, 0, 2, 1 } } };
+	struct in_addr in4addr_peer = { { { 192, 0, 2, 9 } } };
+	struct sockaddr_in my_addr4 = {
+		.sin_family = AF_INET,
+		.sin_addr = in4addr_my,
+	};
+	struct sockaddr_in peer_addr4 = {
+		.sin_family = AF_INET,
+		.sin_addr = in4addr_peer,
+	};
+	struct net_if *iface;
+	struct ud *listener = &uds[NUM_CONNECTED];
+	struct ud *wildcard = &uds[NUM_CONNECTED + 1];
+	int ret;
+	int i;
+
+	iface = net_if_get_first_by_type(&NET_L2_GET_NAME(DUMMY));
+	zassert_not_null(net_if_ipv4_addr_add(iface, &in4addr_my,
+					      NET_ADDR_MANUAL, 0));
+
+	k_sem_init(&recv_lock, 0, UINT_MAX);
+	fail = true;
+
+	/* A wildcard connection, registered first, and a listener on the
+	 * local port, registered last, are both less specific than the
+	 * connected ones.
+	 */
+	ret = net_udp_register(AF_UNSPEC, NULL, NULL, 0, 0, NULL, test_ok,
+			       wildcard, &handles[NUM_CONNECTED + 1]);
+	zassert_equal(ret, 0, "Cannot register wildcard (%d)", ret);
+
+	for (i = 0; i < NUM_CONNECTED; i++) {
+		ret = net_udp_register(AF_INET, (struct sockaddr *)&peer_addr4,
+				       (struct sockaddr *)&my_addr4,
+				       CONNECTED_PORT + i, LOOKUP_PORT, NULL,
+				       test_ok, &uds[i], &handles[i]);
+		zassert_equal(ret, 0, "Cannot register %d (%d)", i, ret);
+	}
+
+	ret = net_udp_register(AF_INET, NULL, (struct sockaddr *)&my_addr4,
+			       0, LOOKUP_PORT, NULL, test_ok, listener,
+			       &handles[NUM_CONNECTED]);
+	zassert_equal(ret, 0, "Cannot register listener (%d)", ret);
+
+	for (i = 0; i < NUM_CONNECTED; i++) {
+		zassert_true(send_ipv4_udp_msg(iface, &in4addr_peer, &in4addr_my,
+					       CONNECTED_PORT + i, LOOKUP_PORT,
+					       &uds[i], false));
+	}
+
+	zassert_true(send_ipv4_udp_msg(iface, &in4addr_peer, &in4addr_my,
+				       CONNECTED_PORT - 1, LOOKUP_PORT,
+				       listener, false));
+	zassert_true(send_ipv4_udp_msg(iface, &in4addr_peer, &in4addr_my,
+				       CONNECTED_PORT, LOOKUP_PORT + 1,
+				       wildcard, false));
+
+	/* Changing the remote port of a connection moves it in the lookup */
+	peer_addr4.sin_port = htons(CONNECTED_PORT - 1);
+	ret = net_conn_update(handles[0], test_ok, &uds[0],
+			      (struct sockaddr *)&peer_addr4,
+			      CONNECTED_PORT - 1);
+	zassert_equal(ret, 0, "Cannot update connection (%d)", ret);
+
+	zassert_true(send_ipv4_udp_msg(iface, &in4addr_peer, &in4addr_my,
+				       CONNECTED_PORT - 1, LOOKUP_PORT,
+				       &uds[0], false));
+	zassert_true(send_ipv4_udp_msg(iface, &in4addr_peer, &in4addr_my,
+				       CONNECTED_PORT, LOOKUP_PORT,
+				       listener, false));
+
+	/* Once unregistered, the less specific ones match again */
+	for (i = 0; i < NUM_CONNECTED + 1; i++) {
+		ret = net_udp_unregister(handles[i]);
+		zassert_equal(ret, 0, "Cannot unregister %d (%d)", i, ret);
+	}
+
+	zassert_true(send_ipv4_udp_msg(iface, &in4addr_peer, &in4addr_my,
+				       CONNECTED_PORT + 1, LOOKUP_PORT,
+				       wildcard, false));
+
+	ret = net_udp_unregister(handles[NUM_CONNECTED + 1]);
+	zassert_equal(ret, 0, "Cannot unregister wildcard (%d)", ret);
+
+	zassert_true(send_ipv4_udp_msg(iface, &in4addr_peer, &in4addr_my,
+				       CONNECTED_PORT + 1, LOOKUP_PORT,
+				       NULL, true));
+}
+
 ZTEST_SUITE(udp_fn_tests, NULL, NULL, NULL, NULL, NULL);